@@ -0,0 +1,61 @@
+#pragma once
+
+// Replaces the global allocation functions with counting versions. Include from exactly one translation unit
+// of a benchmark binary.
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace alloc_counter {
+
+inline std::atomic<bool> counting{false};
+inline std::atomic<uint64_t> allocations{0};
+
+inline void start() {
+  allocations.store(0);
+  counting.store(true);
+}
+
+// Returns the number of allocations since start()
+inline uint64_t stop() {
+  counting.store(false);
+  return allocations.load();
+}
+
+inline void *alloc(size_t n) {
+  if (counting.load(std::memory_order_relaxed)) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+  }
+  if (void *p = std::malloc(n == 0 ? 1 : n)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+inline void *aligned_alloc(size_t n, std::align_val_t align) {
+  if (counting.load(std::memory_order_relaxed)) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+  }
+  const size_t a = static_cast<size_t>(align);
+  if (void *p = std::aligned_alloc(a, (n + a - 1) / a * a)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+} // namespace alloc_counter
+
+void *operator new(size_t n) { return alloc_counter::alloc(n); }
+void *operator new[](size_t n) { return alloc_counter::alloc(n); }
+void *operator new(size_t n, std::align_val_t align) { return alloc_counter::aligned_alloc(n, align); }
+void *operator new[](size_t n, std::align_val_t align) { return alloc_counter::aligned_alloc(n, align); }
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+void operator delete[](void *p, size_t) noexcept { std::free(p); }
+void operator delete(void *p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void *p, size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void *p, size_t, std::align_val_t) noexcept { std::free(p); }
@@ -0,0 +1,128 @@
+// TopOfBookEvent parse cost on the EventReceiver path, heap-backed messages against the per-thread ParseArena:
+// heap allocations per message and per-message latency percentiles. Datagrams are fed back to back in receive
+// batches, resetting the arena after each batch the way the receive loop does.
+//
+//   arena_parse_bench [--messages N] [--batch N] [--symbol SYMBOL]
+
+#include "alloc_counter.hpp"
+#include "core/event_receiver.hpp"
+#include "core/parse_arena.hpp"
+#include "generated/messages.pb.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Options {
+  uint64_t messages = 1'000'000;
+  size_t batch = 64;
+  std::string symbol = "BTCUSDT";
+};
+
+Options parse_args(int argc, char **argv) {
+  Options opts;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    const std::string key = argv[i];
+    const char *value = argv[i + 1];
+    if (key == "--messages") {
+      opts.messages = std::strtoull(value, nullptr, 10);
+    } else if (key == "--batch") {
+      opts.batch = std::max<size_t>(1, std::strtoull(value, nullptr, 10));
+    } else if (key == "--symbol") {
+      opts.symbol = value;
+    }
+  }
+  return opts;
+}
+
+class TobSink : public EventReceiver<TobSink> {
+public:
+  TobSink() : EventReceiver<TobSink>(1, "239.255.77.4", 47104) {}
+
+  void on_event(const toysequencer::TopOfBookEvent &event) {
+    checksum += event.bid_price() + event.ask_size() + static_cast<double>(event.symbol().size());
+  }
+
+  double checksum = 0;
+};
+
+std::vector<std::string> make_datagrams(const Options &opts) {
+  std::vector<std::string> datagrams;
+  for (size_t i = 0; i < opts.batch; ++i) {
+    toysequencer::TopOfBookEvent event;
+    event.set_msg_type(toysequencer::TOB_EVENT);
+    event.set_seq(i + 1);
+    event.set_timestamp(1'700'000'000'000'000 + i);
+    event.set_sid(5);
+    event.set_tin(1);
+    event.set_symbol(opts.symbol);
+    event.set_bid_price(64000.25 + static_cast<double>(i));
+    event.set_bid_size(1.5);
+    event.set_ask_price(64000.75 + static_cast<double>(i));
+    event.set_ask_size(2.25);
+    event.set_exchange_time(1'700'000'000'000'000 + i);
+    datagrams.push_back(event.SerializeAsString());
+  }
+  return datagrams;
+}
+
+void run(const char *name, bool arena, const Options &opts, TobSink &sink,
+         const std::vector<std::string> &datagrams) {
+  ParseArena::set_enabled(arena);
+  std::vector<uint64_t> latencies(opts.messages);
+
+  auto parse_batches = [&](uint64_t messages, bool record) {
+    auto last = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < messages; ++i) {
+      const std::string &d = datagrams[i % datagrams.size()];
+      sink.on_datagram<toysequencer::TopOfBookEvent>(reinterpret_cast<const uint8_t *>(d.data()), d.size());
+      if ((i + 1) % datagrams.size() == 0) {
+        ParseArena::local().reset();
+      }
+      if (record) {
+        const auto now = std::chrono::steady_clock::now();
+        latencies[i] = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - last).count());
+        last = now;
+      }
+    }
+    ParseArena::local().reset();
+  };
+
+  parse_batches(std::min<uint64_t>(opts.messages, 10'000), false);
+
+  alloc_counter::start();
+  auto start = std::chrono::steady_clock::now();
+  parse_batches(opts.messages, true);
+  const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  const uint64_t allocations = alloc_counter::stop();
+
+  std::sort(latencies.begin(), latencies.end());
+  auto pct = [&](double p) { return latencies[static_cast<size_t>(p * static_cast<double>(latencies.size() - 1))]; };
+  std::cout << name << ": " << static_cast<double>(allocations) / opts.messages << " allocs/msg, "
+            << ns / opts.messages << " ns/msg mean, p50 " << pct(0.50) << " ns, p99 " << pct(0.99) << " ns, p99.9 "
+            << pct(0.999) << " ns" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const Options opts = parse_args(argc, argv);
+  if (opts.messages == 0) {
+    return 0;
+  }
+
+  TobSink sink;
+  const std::vector<std::string> datagrams = make_datagrams(opts);
+  std::cout << "TopOfBookEvent, " << datagrams.front().size() << " bytes, symbol \"" << opts.symbol << "\", batch "
+            << opts.batch << std::endl;
+
+  run("heap ", false, opts, sink, datagrams);
+  run("arena", true, opts, sink, datagrams);
+  std::cout << "checksum " << sink.checksum << std::endl;
+  return 0;
+}
@@ -0,0 +1,121 @@
+// Receive-side dedup cost per datagram across payload sizes: the old byte-at-a-time FNV-1a over the whole
+// payload, CRC32C over the payload (the unsequenced path), and the seq window (sequenced event streams), which
+// peeks the seq and flips a bit no matter how large the payload is. The stream repeats every 8th datagram a few
+// positions later; the run fails if the seq window misses any of those or drops anything else.
+//
+//   dedup_bench [--datagrams N]
+
+#include "core/crc32c.hpp"
+#include "core/seq_window.hpp"
+#include "core/wire_peek.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+uint64_t fnv1a(const uint8_t *data, size_t len) {
+  uint64_t h = 1469598103934665603ULL;
+  for (size_t i = 0; i < len; ++i) {
+    h ^= static_cast<uint64_t>(data[i]);
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
+// Event-shaped datagram: msg_type (field 1) and seq (field 2) up front, then a payload of `size` bytes. The
+// seq is a fixed-width (non-minimal, still valid) varint so one buffer can be restamped for every datagram.
+constexpr size_t kSeqOffset = 3;
+constexpr size_t kSeqBytes = 5;
+
+std::vector<uint8_t> make_datagram(size_t size) {
+  std::vector<uint8_t> out(kSeqOffset + kSeqBytes + size, 0x5a);
+  out[0] = 0x08;
+  out[1] = 0x01;
+  out[2] = 0x10;
+  return out;
+}
+
+void stamp_seq(std::vector<uint8_t> &datagram, uint64_t seq) {
+  for (size_t i = 0; i < kSeqBytes; ++i) {
+    datagram[kSeqOffset + i] = static_cast<uint8_t>((seq & 0x7f) | (i + 1 < kSeqBytes ? 0x80 : 0));
+    seq >>= 7;
+  }
+}
+
+// seq order with every 8th seq delivered again three datagrams later
+std::vector<uint64_t> make_stream(uint64_t datagrams, uint64_t &repeats) {
+  std::vector<uint64_t> seqs;
+  repeats = 0;
+  for (uint64_t seq = 1; seqs.size() < datagrams; ++seq) {
+    seqs.push_back(seq);
+    if (seq > 3 && seq % 8 == 0) {
+      seqs.push_back(seq - 3);
+      repeats++;
+    }
+  }
+  return seqs;
+}
+
+template <typename Fn> double ns_per_datagram(const std::vector<uint64_t> &seqs, size_t size, Fn &&fn) {
+  std::vector<uint8_t> datagram = make_datagram(size);
+  const auto start = std::chrono::steady_clock::now();
+  for (uint64_t seq : seqs) {
+    stamp_seq(datagram, seq);
+    fn(datagram.data(), datagram.size());
+  }
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / seqs.size();
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  uint64_t datagrams = 1'000'000;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (std::string(argv[i]) == "--datagrams") {
+      datagrams = std::strtoull(argv[i + 1], nullptr, 10);
+    }
+  }
+
+  uint64_t repeats = 0;
+  const std::vector<uint64_t> seqs = make_stream(datagrams, repeats);
+  std::cout << "crc32c " << (crc32c::hardware_accelerated() ? "hardware" : "software") << ", " << seqs.size()
+            << " datagrams, " << repeats << " repeated" << std::endl;
+
+  bool ok = true;
+  for (size_t size : {32, 256, 1024, 8192}) {
+    // The old receiver: hash everything, remember only the last datagram
+    uint64_t last_hash = 0;
+    uint64_t fnv_drops = 0;
+    const double fnv_ns = ns_per_datagram(seqs, size, [&](const uint8_t *data, size_t len) {
+      const uint64_t h = fnv1a(data, len);
+      fnv_drops += (h == last_hash);
+      last_hash = h;
+    });
+
+    uint32_t crc_sink = 0;
+    const double crc_ns =
+        ns_per_datagram(seqs, size, [&](const uint8_t *data, size_t len) { crc_sink ^= crc32c::compute(data, len); });
+
+    SeqWindow<4096> window;
+    uint64_t seq_drops = 0;
+    const double seq_ns = ns_per_datagram(seqs, size, [&](const uint8_t *data, size_t len) {
+      uint64_t seq = 0;
+      if (wire::find_varint_field(data, len, 2, seq)) {
+        seq_drops += (window.check(seq) == SeqWindow<4096>::Verdict::Duplicate);
+      }
+    });
+
+    std::cout << size << " B: fnv1a " << fnv_ns << " ns (" << fnv_drops << " dropped), crc32c " << crc_ns
+              << " ns, seq window " << seq_ns << " ns (" << seq_drops << " dropped), crc " << crc_sink << std::endl;
+    if (seq_drops != repeats) {
+      std::cerr << "seq window dropped " << seq_drops << " datagrams, expected " << repeats << std::endl;
+      ok = false;
+    }
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,85 @@
+// Cost of the latency probes: LatencyHistogram::record() alone, a steady-clock read, and a full
+// now_ns()/record_since() probe pair. Also checks the reported percentiles against exact ones.
+//
+//   latency_bench [--samples N]
+
+#include "core/latency_histogram.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+template <typename Fn> double ns_per_op(uint64_t n, Fn &&fn) {
+  auto start = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < n; ++i) {
+    fn(i);
+  }
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / n;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  uint64_t samples = 10'000'000;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (std::string(argv[i]) == "--samples") {
+      samples = std::strtoull(argv[i + 1], nullptr, 10);
+    }
+  }
+  if (samples == 0) {
+    return 0;
+  }
+
+  // Log-normal-ish latencies around a few microseconds with a long tail
+  std::mt19937_64 rng(42);
+  std::lognormal_distribution<double> dist(8.0, 0.8);
+  std::vector<uint64_t> values(1 << 16);
+  for (auto &v : values) {
+    v = static_cast<uint64_t>(dist(rng));
+  }
+  const size_t mask = values.size() - 1;
+
+  auto histogram = std::make_unique<LatencyHistogram>();
+  const double record_ns = ns_per_op(samples, [&](uint64_t i) { histogram->record(values[i & mask]); });
+
+  uint64_t sink = 0;
+  const double clock_ns = ns_per_op(samples, [&](uint64_t) { sink += latency::now_ns(); });
+
+  auto probed = std::make_unique<LatencyHistogram>();
+  const double probe_ns = ns_per_op(samples, [&](uint64_t) {
+    const uint64_t start = latency::now_ns();
+    probed->record_since(start);
+  });
+
+  std::cout << "record:            " << record_ns << " ns/sample" << std::endl;
+  std::cout << "now_ns:            " << clock_ns << " ns/read (sink " << sink % 10 << ")" << std::endl;
+  std::cout << "now_ns+record:     " << probe_ns << " ns/probe" << std::endl;
+
+  // Exact quantiles over what was recorded, against the histogram's
+  std::vector<uint64_t> recorded;
+  recorded.reserve(samples);
+  for (uint64_t i = 0; i < samples; ++i) {
+    recorded.push_back(values[i & mask]);
+  }
+  std::sort(recorded.begin(), recorded.end());
+  const LatencySnapshot snap = histogram->snapshot();
+  bool ok = snap.count == samples;
+  for (double q : {0.5, 0.99, 0.999}) {
+    const uint64_t exact = recorded[static_cast<size_t>(q * static_cast<double>(samples - 1))];
+    const uint64_t reported = snap.percentile(q);
+    const double error = exact == 0 ? 0.0 : (static_cast<double>(reported) - exact) / exact;
+    std::cout << "p" << q * 100 << ": exact " << exact << " ns, histogram " << reported << " ns (" << error * 100
+              << "%)" << std::endl;
+    ok = ok && error > -0.04 && error < 0.04;
+  }
+  std::cout << "max: exact " << recorded.back() << " ns, histogram " << snap.max << " ns" << std::endl;
+  ok = ok && snap.max == recorded.back();
+  return ok ? 0 : 1;
+}
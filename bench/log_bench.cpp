@@ -0,0 +1,104 @@
+// Hot-path cost of logging one TopOfBookCommand: the old synchronous `stream << cmd.DebugString()` against an
+// AsyncLogger record, and against a statement filtered out by level.
+//
+//   log_bench [--messages N] [--out PATH]
+//
+// Output goes to PATH (default /dev/null) so the terminal does not set the pace.
+
+#include "core/async_logger.hpp"
+#include "generated/messages.pb.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace {
+
+struct Options {
+  uint64_t messages = 1'000'000;
+  std::string out = "/dev/null";
+};
+
+Options parse_args(int argc, char **argv) {
+  Options opts;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    const std::string key = argv[i];
+    const char *value = argv[i + 1];
+    if (key == "--messages") {
+      opts.messages = std::strtoull(value, nullptr, 10);
+    } else if (key == "--out") {
+      opts.out = value;
+    }
+  }
+  return opts;
+}
+
+template <typename Fn> double ns_per_call(uint64_t messages, Fn &&fn) {
+  auto start = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < messages; ++i) {
+    fn(i);
+  }
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / messages;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const Options opts = parse_args(argc, argv);
+  if (opts.messages == 0) {
+    return 0;
+  }
+#ifdef _WIN32
+  _putenv_s("LOG_FILE", opts.out.c_str());
+#else
+  setenv("LOG_FILE", opts.out.c_str(), 1);
+#endif
+
+  toysequencer::TopOfBookCommand cmd;
+  cmd.set_msg_type(toysequencer::TOB_COMMAND);
+  cmd.set_symbol("BTCUSDT");
+  cmd.set_bid_price(64000.25);
+  cmd.set_bid_size(1.5);
+  cmd.set_ask_price(64000.75);
+  cmd.set_ask_size(2.25);
+  cmd.set_sid(4);
+  cmd.set_tin(0);
+
+  std::ofstream stream(opts.out);
+  const double sync_ns = ns_per_call(opts.messages, [&](uint64_t i) {
+    cmd.set_exchange_time(i);
+    stream << "Sequencer received TopOfBookCommand: " << cmd.DebugString() << std::endl;
+  });
+
+  AsyncLogger &logger = AsyncLogger::instance();
+  logger.set_level(LogLevel::Debug);
+  // Bursts that fit the per-thread ring, flushed outside the timed region, so this measures the hot path
+  // rather than how fast one core can also run the writer
+  const uint64_t burst = 2048;
+  double async_total_ns = 0;
+  for (uint64_t done = 0; done < opts.messages; done += burst) {
+    const uint64_t n = std::min(burst, opts.messages - done);
+    async_total_ns += n * ns_per_call(n, [&](uint64_t i) {
+      LOG_DEBUG("Sequencer received TopOfBookCommand sid={} tin={} symbol={} bid={}x{} ask={}x{} ts={}", cmd.sid(),
+                cmd.tin(), cmd.symbol(), cmd.bid_price(), cmd.bid_size(), cmd.ask_price(), cmd.ask_size(), done + i);
+    });
+    logger.flush();
+  }
+  const double async_ns = async_total_ns / opts.messages;
+  const LogStats stats = logger.get_stats();
+
+  logger.set_level(LogLevel::Info);
+  const double filtered_ns = ns_per_call(opts.messages, [&](uint64_t i) {
+    LOG_DEBUG("Sequencer received TopOfBookCommand sid={} tin={} symbol={} ts={}", cmd.sid(), cmd.tin(),
+              cmd.symbol(), i);
+  });
+
+  std::cout << "stream << DebugString: " << sync_ns << " ns/msg" << std::endl;
+  std::cout << "async record:          " << async_ns << " ns/msg (written " << stats.written << ", dropped "
+            << stats.dropped << " on a full ring)" << std::endl;
+  std::cout << "filtered by level:     " << filtered_ns << " ns/msg" << std::endl;
+  return 0;
+}
@@ -0,0 +1,147 @@
+// How long the market data source's I/O thread is held per read: MarketDataFeedApp decoding and sending
+// inline on it versus the two- and three-stage pipelines, where it only copies the quotes into a ring. Bursts
+// of --burst mdapi quotes are handed over the way an SSE read delivers them, --gap-us apart, and go out over
+// real multicast sends. Reports per-burst hold time on the I/O thread and end-to-end quotes/s; fails if any
+// mode sends a different number of commands than it was given quotes.
+//
+//   md_pipeline_bench [--bursts N] [--burst N] [--gap-us N] [--ring N] [--cpus io,decode,publish]
+//
+// The pipeline only takes the sendto off the I/O thread's clock; with fewer cores than stages the threads
+// still share a core and end-to-end throughput improves little.
+
+#include "applications/md/market_data_feed.hpp"
+#include "core/latency_histogram.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Options {
+  size_t bursts = 20'000;
+  size_t burst = 16;
+  uint64_t gap_us = 50;
+  size_t ring = 1024;
+  std::string cpus;
+};
+
+Options parse_args(int argc, char **argv) {
+  Options opts;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    const std::string key = argv[i];
+    const char *value = argv[i + 1];
+    if (key == "--bursts") {
+      opts.bursts = std::strtoull(value, nullptr, 10);
+    } else if (key == "--burst") {
+      opts.burst = std::clamp<size_t>(std::strtoull(value, nullptr, 10), 1, 64);
+    } else if (key == "--gap-us") {
+      opts.gap_us = std::strtoull(value, nullptr, 10);
+    } else if (key == "--ring") {
+      opts.ring = std::max<size_t>(1, std::strtoull(value, nullptr, 10));
+    } else if (key == "--cpus") {
+      opts.cpus = value;
+    }
+  }
+  return opts;
+}
+
+// Stands in for the SSE source: the bench thread plays the I/O thread
+class ReplaySource : public IMarketDataSource {
+public:
+  void start() override {}
+  void stop() override {}
+  void deliver(const std::string_view *events, size_t count) { on_top_of_book_batch(events, count); }
+};
+
+std::vector<std::string> make_quotes(size_t count) {
+  const char *symbols[] = {"AAPL", "MSFT", "GOOG", "AMZN", "NVDA", "META", "TSLA", "NFLX"};
+  std::vector<std::string> quotes;
+  quotes.reserve(count);
+  char buf[256];
+  for (size_t i = 0; i < count; ++i) {
+    const double mid = 100.0 + static_cast<double>(i % 997) * 0.01;
+    std::snprintf(buf, sizeof(buf),
+                  "{\"symbol\": \"%s\", \"bid_price\": %.2f, \"bid_size\": %d, \"ask_price\": %.2f, "
+                  "\"ask_size\": %d, \"timestamp\": %.6f}",
+                  symbols[i % 8], mid - 0.02, 10 + static_cast<int>(i % 490), mid + 0.02,
+                  500 - static_cast<int>(i % 490), 1760000000.0 + static_cast<double>(i) * 0.001);
+    quotes.emplace_back(buf);
+  }
+  return quotes;
+}
+
+void busy_wait_us(uint64_t us) {
+  const auto until = std::chrono::steady_clock::now() + std::chrono::microseconds(us);
+  while (std::chrono::steady_clock::now() < until) {
+  }
+}
+
+// Returns false if the sender did not send one command per quote
+bool run(const char *name, size_t stages, const Options &opts, const std::vector<std::string_view> &views) {
+  auto source = std::make_unique<ReplaySource>();
+  ReplaySource *replay = source.get();
+  MarketDataFeedApp md("239.255.77.61", 47161, 1, [](const std::string &s) { std::cerr << s << std::endl; },
+                       std::move(source));
+  if (stages > 1) {
+    MdPipelineConfig config;
+    config.enabled = true;
+    config.stages = stages;
+    config.ring_size = opts.ring;
+    config.cpus = ThreadUtils::parse_cpu_list(opts.cpus);
+    md.enable_pipeline(config);
+  }
+  md.start();
+
+  // Sleeping between bursts lets the stage threads run when they share the core with this one
+  const bool spare_cores = std::thread::hardware_concurrency() > stages;
+  LatencyHistogram hold;
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t b = 0; b < opts.bursts; ++b) {
+    const uint64_t t0 = latency::now_ns();
+    replay->deliver(views.data() + b * opts.burst, opts.burst);
+    hold.record_since(t0);
+    if (opts.gap_us > 0) {
+      if (spare_cores) {
+        busy_wait_us(opts.gap_us);
+      } else {
+        std::this_thread::sleep_for(std::chrono::microseconds(opts.gap_us));
+      }
+    }
+  }
+  md.stop();
+  const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  const LatencySnapshot snap = hold.snapshot();
+  const uint64_t sent = md.get_send_batch_stats().payloads;
+  std::cout << name << ": I/O thread held p50=" << snap.percentile(0.5) << "ns p99=" << snap.percentile(0.99)
+            << "ns max=" << snap.max << "ns per " << opts.burst << "-quote read, "
+            << static_cast<uint64_t>(static_cast<double>(views.size()) / seconds) << " quotes/s end to end"
+            << std::endl;
+  if (sent != views.size()) {
+    std::cerr << name << ": sent " << sent << " commands for " << views.size() << " quotes" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const Options opts = parse_args(argc, argv);
+  if (opts.bursts == 0) {
+    return 0;
+  }
+  const std::vector<std::string> quotes = make_quotes(opts.bursts * opts.burst);
+  const std::vector<std::string_view> views(quotes.begin(), quotes.end());
+
+  bool ok = run("inline", 1, opts, views);
+  ok = run("2-stage pipeline", 2, opts, views) && ok;
+  ok = run("3-stage pipeline", 3, opts, views) && ok;
+  return ok ? 0 : 1;
+}
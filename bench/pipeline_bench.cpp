@@ -0,0 +1,202 @@
+// Sequencer throughput under sustained load: everything inline on the receive thread versus the staged
+// pipeline (receive -> sequence -> [journal] -> publish on their own threads), with lanes, and with fair
+// queueing plus a token bucket on the quote sender (--quote-rate commands/s, 0 for no limit).
+// Commands are injected where the receive thread would hand them over, and events go out over real multicast
+// sends. The load is TopOfBookCommands rotating over --symbols symbols with a TextCommand every --text-every
+// commands. With --ingress N the pipeline is fed by N producer threads claiming entries on the same ring.
+//
+//   pipeline_bench [--messages N] [--ring N] [--ingress N] [--symbols N] [--text-every N] [--quote-rate R]
+//                  [--cpus recv,seq,journal,pub] [--journal DIR]
+//
+// The pipeline only pays off with a core per stage; on fewer cores the stages just take turns. Lanes cut the
+// events sent (and so the publish work) by conflating quotes whenever a batch backs up.
+
+#include "applications/sequencer/sequencer.hpp"
+#include "generated/messages.pb.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Options {
+  uint64_t messages = 1'000'000;
+  size_t ring = 4096;
+  size_t ingress = 1;
+  size_t symbols = 8;
+  size_t text_every = 64;
+  double quote_rate = 100'000;
+  std::string cpus;
+  std::string journal;
+};
+
+Options parse_args(int argc, char **argv) {
+  Options opts;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    const std::string key = argv[i];
+    const char *value = argv[i + 1];
+    if (key == "--messages") {
+      opts.messages = std::strtoull(value, nullptr, 10);
+    } else if (key == "--ring") {
+      opts.ring = std::strtoull(value, nullptr, 10);
+    } else if (key == "--ingress") {
+      opts.ingress = std::max<size_t>(1, std::strtoull(value, nullptr, 10));
+    } else if (key == "--symbols") {
+      opts.symbols = std::max<size_t>(1, std::strtoull(value, nullptr, 10));
+    } else if (key == "--text-every") {
+      opts.text_every = std::max<size_t>(1, std::strtoull(value, nullptr, 10));
+    } else if (key == "--quote-rate") {
+      opts.quote_rate = std::strtod(value, nullptr);
+    } else if (key == "--cpus") {
+      opts.cpus = value;
+    } else if (key == "--journal") {
+      opts.journal = value;
+    }
+  }
+  return opts;
+}
+
+constexpr uint64_t kTextSid = 2;
+constexpr uint64_t kQuoteSid = 5;
+
+std::vector<std::string> make_commands(const Options &opts) {
+  std::vector<std::string> commands;
+  const size_t count = opts.symbols * opts.text_every;
+  for (size_t i = 0; i < count; ++i) {
+    if (i % opts.text_every == opts.text_every - 1) {
+      toysequencer::TextCommand cmd;
+      cmd.set_msg_type(toysequencer::TEXT_COMMAND);
+      cmd.set_text("ORDER");
+      cmd.set_sid(kTextSid);
+      cmd.set_tin(i);
+      commands.push_back(cmd.SerializeAsString());
+      continue;
+    }
+    toysequencer::TopOfBookCommand cmd;
+    cmd.set_msg_type(toysequencer::TOB_COMMAND);
+    cmd.set_symbol("SYM" + std::to_string(i % opts.symbols));
+    cmd.set_bid_price(64000.25);
+    cmd.set_bid_size(1);
+    cmd.set_ask_price(64000.75);
+    cmd.set_ask_size(2);
+    cmd.set_exchange_time(1'700'000'000'000'000 + i);
+    cmd.set_sid(kQuoteSid);
+    cmd.set_tin(i);
+    commands.push_back(cmd.SerializeAsString());
+  }
+  return commands;
+}
+
+void enable_journal(Sequencer &sequencer, const Options &opts, const std::string &mode) {
+  if (opts.journal.empty()) {
+    return;
+  }
+  JournalConfig config;
+  config.directory = opts.journal + "/" + mode;
+  std::filesystem::remove_all(config.directory);
+  std::filesystem::create_directories(config.directory);
+  sequencer.enable_journal(config);
+}
+
+void report(const std::string &name, uint64_t messages, uint64_t events,
+            std::chrono::steady_clock::duration elapsed) {
+  const double seconds = std::chrono::duration<double>(elapsed).count();
+  std::cout << name << ": " << static_cast<uint64_t>(messages / seconds) << " msgs/s, "
+            << seconds * 1e9 / messages << " ns/msg, " << events << " events" << std::endl;
+}
+
+template <typename Configure>
+std::chrono::steady_clock::duration run_pipeline(const std::string &mode, const Options &opts,
+                                                 const std::vector<std::string> &commands, Configure &&configure) {
+  Sequencer sequencer("239.255.77.11", 47111, "239.255.77.12", 47112, 1);
+  sequencer.subscribe<toysequencer::TextCommand>(toysequencer::TEXT_COMMAND);
+  sequencer.subscribe<toysequencer::TopOfBookCommand>(toysequencer::TOB_COMMAND);
+  enable_journal(sequencer, opts, mode);
+  PipelineConfig config;
+  config.enabled = true;
+  config.ring_size = opts.ring;
+  config.cpus = ThreadUtils::parse_cpu_list(opts.cpus);
+  for (size_t i = 1; i < opts.ingress; ++i) {
+    config.ingress.push_back({"239.255.77." + std::to_string(20 + i), static_cast<uint16_t>(47120 + i)});
+  }
+  configure(config);
+  sequencer.enable_pipeline(config);
+  sequencer.start();
+
+  const uint64_t per_ingress = opts.messages / opts.ingress;
+  const uint64_t total = per_ingress * opts.ingress;
+  auto feed = [&](size_t ingress) {
+    for (uint64_t i = 0; i < per_ingress; ++i) {
+      const std::string &cmd = commands[i % commands.size()];
+      sequencer.ingest(ingress, reinterpret_cast<const uint8_t *>(cmd.data()), cmd.size());
+    }
+  };
+
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> producers;
+  for (size_t in = 1; in < opts.ingress; ++in) {
+    producers.emplace_back(feed, in);
+  }
+  feed(0);
+  for (std::thread &t : producers) {
+    t.join();
+  }
+  while (sequencer.get_pipeline_published() < total) {
+    std::this_thread::yield();
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  sequencer.stop();
+
+  std::string name = mode + std::string(mode.size() < 8 ? 8 - mode.size() : 0, ' ');
+  if (opts.ingress > 1) {
+    name += ", " + std::to_string(opts.ingress) + " ingress";
+  }
+  report(name, total, sequencer.get_last_seq(), elapsed);
+  return elapsed;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const Options opts = parse_args(argc, argv);
+  if (opts.messages == 0) {
+    return 0;
+  }
+  const std::vector<std::string> commands = make_commands(opts);
+  std::cout << "cores: " << std::thread::hardware_concurrency() << (opts.journal.empty() ? "" : ", journaling")
+            << std::endl;
+
+  std::chrono::steady_clock::duration inline_elapsed;
+  {
+    Sequencer sequencer("239.255.77.11", 47111, "239.255.77.12", 47112, 1);
+    sequencer.subscribe<toysequencer::TextCommand>(toysequencer::TEXT_COMMAND);
+    sequencer.subscribe<toysequencer::TopOfBookCommand>(toysequencer::TOB_COMMAND);
+    enable_journal(sequencer, opts, "inline");
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < opts.messages; ++i) {
+      const std::string &cmd = commands[i % commands.size()];
+      sequencer.dispatch_datagram(reinterpret_cast<const uint8_t *>(cmd.data()), cmd.size());
+    }
+    sequencer.flush();
+    inline_elapsed = std::chrono::steady_clock::now() - start;
+    report("inline  ", opts.messages, sequencer.get_last_seq(), inline_elapsed);
+  }
+
+  const auto pipeline_elapsed = run_pipeline("pipeline", opts, commands, [](PipelineConfig &) {});
+  const auto lanes_elapsed = run_pipeline("lanes", opts, commands, [](PipelineConfig &c) { c.lanes = true; });
+  run_pipeline("fair", opts, commands, [&](PipelineConfig &c) {
+    c.admission.fair = true;
+    c.admission.limits[kQuoteSid] = {opts.quote_rate, opts.quote_rate / 10};
+  });
+
+  const double inline_s = std::chrono::duration<double>(inline_elapsed).count();
+  std::cout << "speedup: pipeline " << inline_s / std::chrono::duration<double>(pipeline_elapsed).count()
+            << "x, lanes " << inline_s / std::chrono::duration<double>(lanes_elapsed).count() << "x" << std::endl;
+  return 0;
+}
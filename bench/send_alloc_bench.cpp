@@ -0,0 +1,113 @@
+// Heap allocations and cost per message on the send paths: sequencer commands in to events out (protobuf and
+// pass-through, with and without send batching) and command senders. Exits non-zero if any path allocates once
+// warmed up.
+//
+//   send_alloc_bench [--messages N] [--warmup N]
+
+#include "applications/ping/ping.hpp"
+#include "applications/sequencer/sequencer.hpp"
+#include "alloc_counter.hpp"
+#include "generated/messages.pb.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace {
+
+struct Options {
+  uint64_t messages = 200'000;
+  uint64_t warmup = 1'000;
+};
+
+Options parse_args(int argc, char **argv) {
+  Options opts;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    const std::string key = argv[i];
+    const char *value = argv[i + 1];
+    if (key == "--messages") {
+      opts.messages = std::strtoull(value, nullptr, 10);
+    } else if (key == "--warmup") {
+      opts.warmup = std::strtoull(value, nullptr, 10);
+    }
+  }
+  return opts;
+}
+
+// Runs `send(i)` warmup times untracked, then `messages` times while counting allocations
+template <typename Fn> bool measure(const std::string &name, const Options &opts, Fn &&send) {
+  for (uint64_t i = 0; i < opts.warmup; ++i) {
+    send(i);
+  }
+
+  alloc_counter::start();
+  auto start = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < opts.messages; ++i) {
+    send(opts.warmup + i);
+  }
+  const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  const uint64_t allocations = alloc_counter::stop();
+  std::cout << name << ": " << static_cast<double>(allocations) / opts.messages << " allocs/msg, "
+            << ns / opts.messages << " ns/msg" << std::endl;
+  return allocations == 0;
+}
+
+toysequencer::TextCommand make_text_command() {
+  toysequencer::TextCommand cmd;
+  cmd.set_msg_type(toysequencer::TEXT_COMMAND);
+  cmd.set_text("PING");
+  cmd.set_sid(2);
+  cmd.set_tin(3);
+  return cmd;
+}
+
+toysequencer::TopOfBookCommand make_tob_command() {
+  toysequencer::TopOfBookCommand cmd;
+  cmd.set_msg_type(toysequencer::TOB_COMMAND);
+  cmd.set_symbol("BTCUSDT");
+  cmd.set_bid_price(64000.25);
+  cmd.set_bid_size(1.5);
+  cmd.set_ask_price(64000.75);
+  cmd.set_ask_size(2.25);
+  cmd.set_exchange_time(1'700'000'000'000'000);
+  cmd.set_sid(5);
+  cmd.set_tin(1);
+  return cmd;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const Options opts = parse_args(argc, argv);
+  bool ok = true;
+
+  Sequencer sequencer("239.255.77.1", 47101, "239.255.77.2", 47102, 1);
+  sequencer.enable_retransmission("239.255.77.3", 47103, 4096);
+
+  const toysequencer::TextCommand text_cmd = make_text_command();
+  const toysequencer::TopOfBookCommand tob_cmd = make_tob_command();
+
+  ok &= measure("sequencer text command", opts, [&](uint64_t) { sequencer.on_command(text_cmd); });
+  ok &= measure("sequencer tob command", opts, [&](uint64_t) { sequencer.on_command(tob_cmd); });
+
+  const std::string tob_bytes = tob_cmd.SerializeAsString();
+  const auto *tob_data = reinterpret_cast<const uint8_t *>(tob_bytes.data());
+  ok &= measure("sequencer pass-through", opts,
+                [&](uint64_t) { sequencer.on_raw_command(toysequencer::TOB_COMMAND, tob_data, tob_bytes.size()); });
+
+  SendBatchPolicy policy;
+  policy.max_batch = 32;
+  sequencer.set_batch_policy(policy);
+  ok &= measure("sequencer tob command, batch 32", opts, [&](uint64_t) { sequencer.on_command(tob_cmd); });
+  sequencer.flush();
+
+  PingApp ping("239.255.77.1", 47101, 1, "239.255.77.2", 47102, [](const std::string &) {});
+  ok &= measure("ping command", opts, [&](uint64_t) { ping.send(text_cmd, text_cmd.sid()); });
+
+  if (!ok) {
+    std::cerr << "send path allocated in steady state" << std::endl;
+    return 1;
+  }
+  return 0;
+}
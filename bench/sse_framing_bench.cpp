@@ -0,0 +1,169 @@
+// SSE framing throughput on the market data read path: the old std::string framing (append every recv,
+// substr per line and per payload, erase to compact) against SseFramer (recv into its buffer, memchr line
+// scan, string_view payloads). An SSE capture, either --capture FILE or a synthetic mdapi stream, is replayed
+// in --chunk byte reads through each, with events going out through the source's std::function callback.
+// Fails if the two disagree on the events.
+//
+//   sse_framing_bench [--capture FILE] [--events N] [--chunk BYTES] [--rounds N]
+
+#include "applications/md/impl/sse_framer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+// HttpSseMarketDataSource's framing before SseFramer; headers are skipped the same way
+void frame_baseline(const std::string &capture, size_t chunk, const std::function<void(const std::string &)> &cb) {
+  std::string buffer;
+  buffer.reserve(8192);
+  bool headers_skipped = false;
+  for (size_t offset = 0; offset < capture.size(); offset += chunk) {
+    buffer.append(capture, offset, std::min(chunk, capture.size() - offset));
+    if (!headers_skipped) {
+      size_t pos = buffer.find("\r\n\r\n");
+      if (pos == std::string::npos) {
+        continue;
+      }
+      buffer.erase(0, pos + 4);
+      headers_skipped = true;
+    }
+    size_t line_start = 0;
+    for (;;) {
+      size_t nl = buffer.find('\n', line_start);
+      if (nl == std::string::npos) {
+        buffer.erase(0, line_start);
+        break;
+      }
+      std::string line = buffer.substr(line_start, nl - line_start);
+      if (!line.empty() && line.back() == '\r')
+        line.pop_back();
+      line_start = nl + 1;
+      if (line.size() >= 5) {
+        bool is_data = (line[0] == 'd' || line[0] == 'D') && (line[1] == 'a' || line[1] == 'A') &&
+                       (line[2] == 't' || line[2] == 'T') && (line[3] == 'a' || line[3] == 'A') && line[4] == ':';
+        if (is_data) {
+          size_t p = 5;
+          if (p < line.size() && line[p] == ' ')
+            ++p;
+          std::string json = line.substr(p);
+          cb(json);
+        }
+      }
+    }
+  }
+}
+
+void frame_zero_copy(const std::string &capture, size_t chunk, SseFramer &framer,
+                     const std::function<void(std::string_view)> &cb) {
+  framer.reset();
+  size_t offset = 0;
+  while (offset < capture.size()) {
+    // what recv() would have written, at most one chunk and never more than the framer has room for
+    const size_t n = std::min({chunk, capture.size() - offset, framer.write_space()});
+    std::copy_n(capture.data() + offset, n, framer.write_ptr());
+    framer.commit(n);
+    offset += n;
+    framer.drain([&cb](std::string_view json) { cb(json); });
+  }
+}
+
+// What mdapi's /stream endpoint writes: headers, a comment and retry hint, then one data line per event
+std::string synthetic_capture(size_t events) {
+  const char *symbols[] = {"AAPL", "MSFT", "GOOG", "AMZN"};
+  std::string capture = "HTTP/1.0 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\n"
+                        "Connection: keep-alive\r\n\r\n: connected\nretry: 2000\n\n";
+  char buf[256];
+  for (size_t i = 0; i < events; ++i) {
+    const double mid = 100.0 + static_cast<double>(i % 997) * 0.01;
+    std::snprintf(buf, sizeof(buf),
+                  "data: {\"symbol\": \"%s\", \"bid_price\": %.2f, \"bid_size\": %d, \"ask_price\": %.2f, "
+                  "\"ask_size\": %d, \"timestamp\": %.6f}\n\n",
+                  symbols[i % 4], mid - 0.02, 10 + static_cast<int>(i % 490), mid + 0.02,
+                  500 - static_cast<int>(i % 490), 1760000000.0 + static_cast<double>(i) * 0.001);
+    capture += buf;
+  }
+  return capture;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::string capture_path;
+  size_t events = 200'000;
+  size_t chunk = 4096;
+  size_t rounds = 5;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    const std::string key = argv[i];
+    const char *value = argv[i + 1];
+    if (key == "--capture") {
+      capture_path = value;
+    } else if (key == "--events") {
+      events = std::strtoull(value, nullptr, 10);
+    } else if (key == "--chunk") {
+      chunk = std::max<size_t>(1, std::strtoull(value, nullptr, 10));
+    } else if (key == "--rounds") {
+      rounds = std::max<size_t>(1, std::strtoull(value, nullptr, 10));
+    }
+  }
+
+  std::string capture;
+  if (!capture_path.empty()) {
+    std::ifstream in(capture_path, std::ios::binary);
+    if (!in) {
+      std::cerr << "cannot read " << capture_path << std::endl;
+      return 1;
+    }
+    capture.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  } else {
+    capture = synthetic_capture(events);
+  }
+
+  uint64_t baseline_events = 0, baseline_bytes = 0;
+  const std::function<void(const std::string &)> baseline_cb = [&](const std::string &json) {
+    baseline_events++;
+    baseline_bytes += json.size();
+  };
+  uint64_t framer_events = 0, framer_bytes = 0;
+  const std::function<void(std::string_view)> framer_cb = [&](std::string_view json) {
+    framer_events++;
+    framer_bytes += json.size();
+  };
+  SseFramer framer;
+
+  auto time_rounds = [&](auto &&fn) {
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; ++r) {
+      fn();
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  };
+  const double baseline_s = time_rounds([&] { frame_baseline(capture, chunk, baseline_cb); });
+  const double framer_s = time_rounds([&] { frame_zero_copy(capture, chunk, framer, framer_cb); });
+
+  const double mb = static_cast<double>(capture.size()) * static_cast<double>(rounds) / 1e6;
+  auto report = [&](const char *name, double seconds, uint64_t count) {
+    std::cout << name << ": " << static_cast<uint64_t>(mb / seconds) << " MB/s, "
+              << static_cast<uint64_t>(static_cast<double>(count) / seconds) << " events/s" << std::endl;
+  };
+  std::cout << capture.size() << " capture bytes in " << chunk << " byte reads, " << rounds << " rounds"
+            << std::endl;
+  report("std::string framing", baseline_s, baseline_events);
+  report("SseFramer", framer_s, framer_events);
+  std::cout << "speedup " << baseline_s / framer_s << "x" << std::endl;
+
+  if (baseline_events != framer_events || baseline_bytes != framer_bytes || framer_events == 0) {
+    std::cerr << "framers disagree: " << baseline_events << " vs " << framer_events << " events" << std::endl;
+    return 1;
+  }
+  return 0;
+}
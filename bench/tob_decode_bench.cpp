@@ -0,0 +1,175 @@
+// JSON top-of-book decoding on the market data feed thread: the old per-quote decoder (fresh simdjson parser
+// and padded_string per quote, unordered field lookups, TopOfBookCommand by value) against TobDecoder (one
+// parser and padded scratch buffer for the thread, single ordered pass, reused command). Both run on one
+// thread, so quotes/s is per core. TobDecoder::decode_many then takes the same quotes in bursts of --burst, as
+// one SSE read delivers them. A second pass uses quotes with the fields shuffled to exercise the unordered
+// fallback. Fails if the decoders disagree on any quote, or if a malformed quote in a burst costs more than
+// itself.
+//
+//   tob_decode_bench [--quotes N] [--burst N]
+
+#include "applications/md/utils/tob_decoder.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+// MDUtils::parse_json_tob before TobDecoder
+toysequencer::TopOfBookCommand parse_json_tob_baseline(const std::string &json, uint64_t target_instance) {
+  simdjson::ondemand::parser parser;
+  simdjson::padded_string padded(json);
+  simdjson::ondemand::document obj = parser.iterate(padded);
+
+  toysequencer::TopOfBookCommand out;
+  std::string_view sv;
+  double bid_p = 0.0, ask_p = 0.0, bid_s = 0.0, ask_s = 0.0, ts_sec = 0.0;
+  if (obj["symbol"].get(sv) || obj["bid_price"].get(bid_p) || obj["ask_price"].get(ask_p) ||
+      obj["bid_size"].get(bid_s) || bid_s < 0 || obj["ask_size"].get(ask_s) || ask_s < 0 ||
+      obj["timestamp"].get(ts_sec)) {
+    return out;
+  }
+  out.set_msg_type(toysequencer::TOB_COMMAND);
+  out.set_tin(target_instance);
+  out.set_sid(target_instance);
+  out.set_symbol(std::string(sv));
+  out.set_bid_price(bid_p);
+  out.set_bid_size(static_cast<uint64_t>(bid_s));
+  out.set_ask_price(ask_p);
+  out.set_ask_size(static_cast<uint64_t>(ask_s));
+  out.set_exchange_time(static_cast<uint64_t>(ts_sec * 1'000'000.0));
+  return out;
+}
+
+// Quotes as mdapi's json.dumps writes them, or with the fields in a different order
+std::vector<std::string> make_quotes(size_t count, bool shuffled) {
+  const char *symbols[] = {"AAPL", "MSFT", "GOOG", "AMZN", "NVDA", "META", "TSLA", "NFLX"};
+  std::vector<std::string> quotes;
+  quotes.reserve(count);
+  char buf[256];
+  for (size_t i = 0; i < count; ++i) {
+    const double mid = 100.0 + static_cast<double>(i % 997) * 0.01;
+    const int bid_size = 10 + static_cast<int>(i % 490);
+    const int ask_size = 500 - static_cast<int>(i % 490);
+    const double ts = 1760000000.0 + static_cast<double>(i) * 0.001;
+    const char *symbol = symbols[i % 8];
+    if (shuffled) {
+      std::snprintf(buf, sizeof(buf),
+                    "{\"timestamp\": %.6f, \"ask_size\": %d, \"ask_price\": %.2f, \"symbol\": \"%s\", "
+                    "\"bid_size\": %d, \"bid_price\": %.2f}",
+                    ts, ask_size, mid + 0.02, symbol, bid_size, mid - 0.02);
+    } else {
+      std::snprintf(buf, sizeof(buf),
+                    "{\"symbol\": \"%s\", \"bid_price\": %.2f, \"bid_size\": %d, \"ask_price\": %.2f, "
+                    "\"ask_size\": %d, \"timestamp\": %.6f}",
+                    symbol, mid - 0.02, bid_size, mid + 0.02, ask_size, ts);
+    }
+    quotes.emplace_back(buf);
+  }
+  return quotes;
+}
+
+bool same(const toysequencer::TopOfBookCommand &a, const toysequencer::TopOfBookCommand &b) {
+  return a.symbol() == b.symbol() && a.bid_price() == b.bid_price() && a.bid_size() == b.bid_size() &&
+         a.ask_price() == b.ask_price() && a.ask_size() == b.ask_size() && a.exchange_time() == b.exchange_time() &&
+         a.tin() == b.tin() && a.sid() == b.sid() && a.msg_type() == b.msg_type();
+}
+
+template <typename Fn> double quotes_per_second(size_t quotes, Fn &&fn) {
+  const auto start = std::chrono::steady_clock::now();
+  fn();
+  const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return static_cast<double>(quotes) / seconds;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  size_t count = 1'000'000;
+  size_t burst = 32;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (std::string(argv[i]) == "--quotes") {
+      count = std::strtoull(argv[i + 1], nullptr, 10);
+    } else if (std::string(argv[i]) == "--burst") {
+      burst = std::max<size_t>(1, std::strtoull(argv[i + 1], nullptr, 10));
+    }
+  }
+  if (count == 0) {
+    return 0;
+  }
+  constexpr uint64_t kTarget = 1;
+
+  for (bool shuffled : {false, true}) {
+    const std::vector<std::string> quotes = make_quotes(count, shuffled);
+    std::vector<toysequencer::TopOfBookCommand> expected(quotes.size());
+    uint64_t checksum = 0;
+
+    const double baseline = quotes_per_second(quotes.size(), [&] {
+      for (size_t i = 0; i < quotes.size(); ++i) {
+        expected[i] = parse_json_tob_baseline(quotes[i], kTarget);
+      }
+    });
+
+    TobDecoder decoder;
+    toysequencer::TopOfBookCommand cmd;
+    size_t mismatches = 0;
+    const double reused = quotes_per_second(quotes.size(), [&] {
+      for (const std::string &quote : quotes) {
+        if (decoder.decode(quote, kTarget, cmd)) {
+          checksum += cmd.bid_size();
+        }
+      }
+    });
+    for (size_t i = 0; i < quotes.size(); ++i) {
+      if (!decoder.decode(quotes[i], kTarget, cmd) || !same(cmd, expected[i])) {
+        mismatches++;
+      }
+    }
+
+    std::vector<std::string_view> views(quotes.begin(), quotes.end());
+    auto decode_bursts = [&](auto &&on_command) {
+      for (size_t i = 0; i < views.size(); i += burst) {
+        decoder.decode_many(views.data() + i, std::min(burst, views.size() - i), kTarget, cmd, on_command);
+      }
+    };
+    const double batched = quotes_per_second(quotes.size(), [&] {
+      decode_bursts([&](const toysequencer::TopOfBookCommand &c) { checksum += c.bid_size(); });
+    });
+    size_t next = 0;
+    decode_bursts([&](const toysequencer::TopOfBookCommand &c) {
+      if (next >= expected.size() || !same(c, expected[next++])) {
+        mismatches++;
+      }
+    });
+    if (next != quotes.size()) {
+      mismatches += quotes.size() - next;
+    }
+
+    std::cout << (shuffled ? "shuffled fields" : "mdapi field order") << ": baseline "
+              << static_cast<uint64_t>(baseline) << " quotes/s, TobDecoder " << static_cast<uint64_t>(reused)
+              << " quotes/s (" << reused / baseline << "x), decode_many " << static_cast<uint64_t>(batched)
+              << " quotes/s (" << batched / baseline << "x), checksum " << checksum << std::endl;
+    if (mismatches != 0) {
+      std::cerr << mismatches << " quotes decoded differently" << std::endl;
+      return 1;
+    }
+  }
+
+  // A broken quote in the middle of a burst is skipped; the ones after it still decode
+  const std::vector<std::string> quotes = make_quotes(8, false);
+  std::vector<std::string_view> views(quotes.begin(), quotes.end());
+  views[3] = "{\"symbol\": \"AAPL\", \"bid_price\": ";
+  TobDecoder decoder;
+  toysequencer::TopOfBookCommand cmd;
+  const size_t decoded = decoder.decode_many(views.data(), views.size(), kTarget, cmd, [](const auto &) {});
+  if (decoded != views.size() - 1) {
+    std::cerr << "malformed quote in a burst: " << decoded << "/" << views.size() - 1 << " decoded" << std::endl;
+    return 1;
+  }
+  return 0;
+}
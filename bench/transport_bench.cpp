@@ -0,0 +1,186 @@
+// Same-host transport comparison: classic multicast (recvmmsg / sendmmsg), io_uring multicast (multishot
+// recvmsg over a provided buffer ring / one io_uring_enter per send batch) and the shared-memory ring.
+//
+// Throughput: the sender publishes --messages payloads of --size bytes in batches of --batch as fast as it
+// can; the receiver counts what arrives. Reports send rate, payloads received and the average receive batch,
+// which is how many payloads each wakeup picked up.
+//
+// Latency: --pings payloads sent one at a time, --gap-us apart so nothing queues, each stamped with its send
+// time; the receive handler records one-way latency. Classic multicast against the shared-memory ring.
+//
+//   transport_bench [--messages N] [--size BYTES] [--batch N] [--pings N] [--gap-us US]
+//
+// Needs multicast loopback: MCAST_IF_ADDR=127.0.0.1 MCAST_LOOPBACK=1 (ctest sets both).
+
+#include "core/multicast_receiver.hpp"
+#include "core/multicast_sender.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Options {
+  uint64_t messages = 1'000'000;
+  size_t size = 64;
+  size_t batch = 32;
+  uint64_t pings = 20'000;
+  uint64_t gap_us = 20;
+};
+
+Options parse_args(int argc, char **argv) {
+  Options opts;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    const std::string key = argv[i];
+    const char *value = argv[i + 1];
+    if (key == "--messages") {
+      opts.messages = std::strtoull(value, nullptr, 10);
+    } else if (key == "--size") {
+      opts.size = std::max<size_t>(16, std::strtoull(value, nullptr, 10));
+    } else if (key == "--batch") {
+      opts.batch = std::max<size_t>(1, std::strtoull(value, nullptr, 10));
+    } else if (key == "--pings") {
+      opts.pings = std::strtoull(value, nullptr, 10);
+    } else if (key == "--gap-us") {
+      opts.gap_us = std::strtoull(value, nullptr, 10);
+    }
+  }
+  return opts;
+}
+
+struct Result {
+  Transport recv_transport;
+  Transport send_transport;
+  double send_seconds = 0;
+  uint64_t received = 0;
+  double average_fill = 0;
+};
+
+Result run(Transport transport, const Options &opts, uint16_t port) {
+  const std::string group = "239.255.77.30";
+  MulticastReceiver receiver(group, port, transport);
+  receiver.set_batch_size(kMaxRecvBatch);
+  std::atomic<uint64_t> received{0};
+  receiver.subscribe([&](const uint8_t *, size_t) { received.fetch_add(1, std::memory_order_relaxed); });
+  receiver.start();
+
+  MulticastSender sender(group, port, 1, transport);
+  SendBatchPolicy policy;
+  policy.max_batch = opts.batch;
+  policy.use_gso = false; // GSO would turn either backend into one sendmsg per batch
+  sender.set_batch_policy(policy);
+
+  // Let the receive loop join the group before traffic starts
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  std::vector<uint8_t> payload(opts.size, 0x5a);
+  const auto start = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < opts.messages; ++i) {
+    std::memcpy(payload.data(), &i, sizeof(i)); // distinct payloads so dedup keeps them all
+    sender.enqueue(payload.data(), payload.size());
+  }
+  sender.flush();
+  Result result;
+  result.send_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  // Drain: stop once nothing new has arrived for a while
+  uint64_t last = received.load();
+  for (;;) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    const uint64_t now = received.load();
+    if (now == last) {
+      break;
+    }
+    last = now;
+  }
+  receiver.stop();
+
+  result.recv_transport = receiver.get_transport();
+  result.send_transport = sender.get_transport();
+  result.received = received.load();
+  result.average_fill = receiver.get_batch_stats().average_fill();
+  return result;
+}
+
+// One-way latency of paced single sends; returns how many pings arrived
+uint64_t run_latency(Transport transport, const Options &opts, uint16_t port, LatencyHistogram &histogram) {
+  const std::string group = "239.255.77.30";
+  MulticastReceiver receiver(group, port, transport);
+  std::atomic<uint64_t> received{0};
+  receiver.subscribe([&](const uint8_t *data, size_t len) {
+    uint64_t sent_ns = 0;
+    if (len >= sizeof(sent_ns)) {
+      std::memcpy(&sent_ns, data, sizeof(sent_ns));
+      histogram.record_since(sent_ns);
+    }
+    received.fetch_add(1, std::memory_order_relaxed);
+  });
+  receiver.start();
+  MulticastSender sender(group, port, 1, transport);
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  // Busy-wait the gap so the sender is never descheduled, unless that would starve the receiver of the only CPU
+  const bool spin = std::thread::hardware_concurrency() > 1;
+  std::vector<uint8_t> payload(opts.size, 0x5a);
+  for (uint64_t i = 0; i < opts.pings; ++i) {
+    const auto next = std::chrono::steady_clock::now() + std::chrono::microseconds(opts.gap_us);
+    std::memcpy(payload.data() + sizeof(uint64_t), &i, sizeof(i));
+    const uint64_t now = latency::now_ns();
+    std::memcpy(payload.data(), &now, sizeof(now));
+    sender.send_m(payload.data(), payload.size());
+    if (!spin) {
+      std::this_thread::sleep_until(next);
+    }
+    while (std::chrono::steady_clock::now() < next) {
+    }
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  receiver.stop();
+  return received.load();
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const Options opts = parse_args(argc, argv);
+  if (opts.messages == 0) {
+    return 0;
+  }
+
+  uint16_t port = 47130;
+  for (Transport transport : {Transport::Classic, Transport::IoUring, Transport::Shm}) {
+    const Result r = run(transport, opts, port++);
+    std::cout << transport_name(transport) << " (recv " << transport_name(r.recv_transport) << ", send "
+              << transport_name(r.send_transport) << "): " << static_cast<uint64_t>(opts.messages / r.send_seconds)
+              << " sends/s, " << r.received << "/" << opts.messages << " received, " << r.average_fill
+              << " datagrams per receive batch" << std::endl;
+    if (r.received == 0) {
+      std::cerr << "nothing received over " << transport_name(transport) << std::endl;
+      return 1;
+    }
+  }
+
+  if (opts.pings == 0) {
+    return 0;
+  }
+  for (Transport transport : {Transport::Classic, Transport::Shm}) {
+    LatencyHistogram histogram;
+    const uint64_t received = run_latency(transport, opts, port++, histogram);
+    const LatencySnapshot snap = histogram.snapshot();
+    std::cout << transport_name(transport) << " one-way latency: " << received << "/" << opts.pings
+              << " received, p50 " << snap.percentile(0.5) << " ns, p99 " << snap.percentile(0.99) << " ns, max "
+              << snap.max << " ns" << std::endl;
+    if (received == 0) {
+      std::cerr << "no pings received over " << transport_name(transport) << std::endl;
+      return 1;
+    }
+  }
+  return 0;
+}
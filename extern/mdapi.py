@@ -211,7 +211,7 @@ def _serve_http(api: MarketDataAPI, host: str = "127.0.0.1", port: int = 8000) -
     import json
     import queue
     from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
-    from urllib.parse import urlparse
+    from urllib.parse import parse_qs, urlparse
 
     # Maintain the latest snapshot for each symbol
     latest_by_symbol: Dict[str, TopOfBook] = {}
@@ -267,6 +267,7 @@ def _serve_http(api: MarketDataAPI, host: str = "127.0.0.1", port: int = 8000) -
                         "/top/<symbol>",
                         "/stream",
                         "/stream/<symbol>",
+                        "/stream?symbols=<symbol>,<symbol>",
                     ]
                 })
 
@@ -278,6 +279,16 @@ def _serve_http(api: MarketDataAPI, host: str = "127.0.0.1", port: int = 8000) -
                     if symbol not in api._symbols:
                         return self._send_json({"error": f"unknown symbol: {symbol}"}, status=404)
                     symbol_filter = {symbol}
+                else:
+                    # /stream?symbols=AAPL,MSFT subscribes to a subset
+                    requested = parse_qs(parsed.query).get("symbols")
+                    if requested:
+                        names = {s.strip().upper() for v in requested for s in v.split(",") if s.strip()}
+                        unknown = sorted(names - set(api._symbols))
+                        if unknown:
+                            return self._send_json({"error": f"unknown symbol: {', '.join(unknown)}"}, status=404)
+                        if names:
+                            symbol_filter = names
 
                 self.send_response(200)
                 self.send_header("Content-Type", "text/event-stream")
@@ -11,13 +11,20 @@ struct TextCommandToTextEvent {
   toysequencer::TextEvent make_event(const toysequencer::TextCommand &command, uint64_t seq, uint64_t sender_id,
                                      uint64_t ts) const {
     toysequencer::TextEvent event;
+    fill_event(command, seq, sender_id, ts, event);
+    return event;
+  }
+
+  // Overwrites every field of `event`, so a long-lived event can be reused without reallocating its strings
+  void fill_event(const toysequencer::TextCommand &command, uint64_t seq, uint64_t sender_id, uint64_t ts,
+                  toysequencer::TextEvent &event) const {
     event.set_msg_type(toysequencer::TEXT_EVENT);
     event.set_seq(seq);
     event.set_text(command.text());
     event.set_timestamp(ts);
     event.set_sid(sender_id);
     event.set_tin(command.tin());
-    return event;
+    event.set_cseq(command.cseq());
   }
 
   std::vector<uint8_t> serialize(const toysequencer::TextEvent &event) const {
@@ -37,6 +44,12 @@ struct TopOfBookCommandToTopOfBookEvent {
   toysequencer::TopOfBookEvent make_event(const toysequencer::TopOfBookCommand &command, uint64_t seq,
                                           uint64_t sender_id, uint64_t ts) const {
     toysequencer::TopOfBookEvent event;
+    fill_event(command, seq, sender_id, ts, event);
+    return event;
+  }
+
+  void fill_event(const toysequencer::TopOfBookCommand &command, uint64_t seq, uint64_t sender_id, uint64_t ts,
+                  toysequencer::TopOfBookEvent &event) const {
     event.set_msg_type(toysequencer::TOB_EVENT);
     event.set_seq(seq);
     event.set_timestamp(ts);
@@ -49,8 +62,7 @@ struct TopOfBookCommandToTopOfBookEvent {
     event.set_ask_price(command.ask_price());
     event.set_ask_size(command.ask_size());
     event.set_exchange_time(command.exchange_time());
-
-    return event;
+    event.set_cseq(command.cseq());
   }
 
   std::vector<uint8_t> serialize(const toysequencer::TopOfBookEvent &event) const {
@@ -62,3 +74,21 @@ struct TopOfBookCommandToTopOfBookEvent {
 };
 
 } // namespace adapters
+
+// Maps an event type back to the command it is built from, so consumers can rebuild events from
+// pass-through frames that carry the original command bytes
+namespace adapters {
+
+template <typename EventT> struct EventAdapter;
+
+template <> struct EventAdapter<toysequencer::TextEvent> {
+  using command_type = toysequencer::TextCommand;
+  using adapter_type = TextCommandToTextEvent;
+};
+
+template <> struct EventAdapter<toysequencer::TopOfBookEvent> {
+  using command_type = toysequencer::TopOfBookCommand;
+  using adapter_type = TopOfBookCommandToTopOfBookEvent;
+};
+
+} // namespace adapters
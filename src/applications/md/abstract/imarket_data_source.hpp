@@ -1,7 +1,10 @@
 #pragma once
 
+#include "utils/thread_utils.hpp"
+#include <cstddef>
 #include <functional>
-#include <string>
+#include <iostream>
+#include <string_view>
 #include <vector>
 
 class IMarketDataSource {
@@ -10,14 +13,39 @@ public:
   virtual void start() = 0;
   virtual void stop() = 0;
 
-  using MdCallback = std::function<void(const std::string &)>;
+  // Views are only valid for the duration of the call
+  using MdCallback = std::function<void(std::string_view)>;
+  // Every event from one read of the source, in order
+  using MdBatchCallback = std::function<void(const std::string_view *events, size_t count)>;
   std::vector<MdCallback> callbacks{};
+  std::vector<MdBatchCallback> batch_callbacks{};
 
   void register_callback(MdCallback cb) { callbacks.emplace_back(std::move(cb)); }
+  void register_batch_callback(MdBatchCallback cb) { batch_callbacks.emplace_back(std::move(cb)); }
 
-  void on_top_of_book(const std::string &data) {
+  void on_top_of_book(std::string_view data) { on_top_of_book_batch(&data, 1); };
+
+  void on_top_of_book_batch(const std::string_view *events, size_t count) {
     for (auto &cb : callbacks) {
-      cb(data);
+      for (size_t i = 0; i < count; ++i) {
+        cb(events[i]);
+      }
+    }
+    for (auto &cb : batch_callbacks) {
+      cb(events, count);
+    }
+  }
+
+  // CPU the source's I/O thread(s) pin themselves to; -1 leaves them unpinned. Call before start().
+  void set_io_cpu(int cpu) { io_cpu_ = cpu; }
+
+protected:
+  // Called by each I/O thread as it starts
+  void pin_io_thread() const {
+    if (io_cpu_ >= 0 && !ThreadUtils::pin_current_thread(io_cpu_)) {
+      std::cerr << "md: could not pin I/O thread to cpu " << io_cpu_ << std::endl;
     }
-  };
+  }
+
+  int io_cpu_ = -1;
 };
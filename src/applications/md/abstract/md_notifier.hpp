@@ -1,9 +1,15 @@
 #pragma once
 
-#include <string>
+#include <cstddef>
+#include <string_view>
 
 class MdNotifier {
 public:
   virtual ~MdNotifier() = default;
-  virtual void notify(const std::string &data) { (void)data; }
+  virtual void notify(std::string_view data) { (void)data; }
+  virtual void notify_batch(const std::string_view *data, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      notify(data[i]);
+    }
+  }
 };
@@ -0,0 +1,374 @@
+#pragma once
+
+#include "../abstract/imarket_data_source.hpp"
+#include "core/shm_metrics.hpp"
+#include "sse_framer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <netdb.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+// Several SSE connections to the market data API, each subscribed to its own subset of symbols through the
+// `symbols` query parameter, all non-blocking and serviced by io_threads epoll loops (connection i belongs to
+// thread i % io_threads). A connection that fails or drops reconnects after an exponential backoff without
+// holding up the others. Name resolution runs on a thread of its own and is redone after a failed connection
+// attempt, so a slow DNS server never stalls a loop and an address change is picked up. Each read's events go out as one batch in that connection's order; batches from
+// different connections are serialized, so callbacks never run concurrently.
+class EpollSseMarketDataSource : public IMarketDataSource {
+public:
+  // An empty subset subscribes that connection to every symbol
+  EpollSseMarketDataSource(std::string host, std::string port, std::string path,
+                           std::vector<std::vector<std::string>> symbol_subsets, size_t io_threads = 1)
+      : host_(std::move(host)), port_(std::move(port)), path_(std::move(path)),
+        io_threads_(std::clamp<size_t>(io_threads, 1, std::max<size_t>(1, symbol_subsets.size()))) {
+    if (symbol_subsets.empty()) {
+      symbol_subsets.emplace_back();
+    }
+    for (auto &subset : symbol_subsets) {
+      auto conn = std::make_unique<Connection>();
+      conn->request = build_request(subset);
+      connections_.push_back(std::move(conn));
+    }
+    ShmMetrics &metrics = ShmMetrics::instance();
+    const uint16_t port_num = static_cast<uint16_t>(std::strtoul(port_.c_str(), nullptr, 10));
+    connects_ = metrics.counter(endpoint_metric("md", host_, port_num, "connects"));
+    disconnects_ = metrics.counter(endpoint_metric("md", host_, port_num, "disconnects"));
+    connections_up_ = metrics.gauge(endpoint_metric("md", host_, port_num, "connections up"));
+  }
+
+  ~EpollSseMarketDataSource() override { stop(); }
+
+  void start() override {
+    if (running_.exchange(true))
+      return;
+    resolve_requested_ = true;
+    resolver_ = std::thread([this]() { this->resolve_loop(); });
+    for (size_t t = 0; t < io_threads_; ++t) {
+      const int wake = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+      if (wake < 0) {
+        std::cerr << "md: eventfd failed: " << std::strerror(errno) << std::endl;
+        continue;
+      }
+      wake_fds_.push_back(wake);
+      workers_.emplace_back([this, t, wake]() { this->run(t, wake); });
+    }
+  }
+
+  void stop() override {
+    if (!running_.exchange(false))
+      return;
+    for (int fd : wake_fds_) {
+      const uint64_t one = 1;
+      (void)::write(fd, &one, sizeof(one));
+    }
+    {
+      std::lock_guard<std::mutex> lock(resolve_mutex_);
+    }
+    resolve_cv_.notify_all();
+    if (resolver_.joinable()) {
+      resolver_.join();
+    }
+    for (auto &w : workers_) {
+      if (w.joinable()) {
+        w.join();
+      }
+    }
+    workers_.clear();
+    for (int fd : wake_fds_) {
+      ::close(fd);
+    }
+    wake_fds_.clear();
+    std::lock_guard<std::mutex> lock(resolve_mutex_);
+    addrs_.reset();
+  }
+
+  size_t connection_count() const { return connections_.size(); }
+
+private:
+  enum class State { Idle, Connecting, Streaming };
+
+  struct Connection {
+    std::string request;
+    size_t request_sent = 0;
+    int fd = -1;
+    State state = State::Idle;
+    SseFramer framer;
+    std::vector<std::string_view> events;
+    std::chrono::milliseconds backoff{0};
+    std::chrono::steady_clock::time_point retry_at{};
+  };
+
+  static constexpr std::chrono::milliseconds kMinBackoff{100};
+  static constexpr std::chrono::milliseconds kMaxBackoff{5000};
+  // Reads per connection per wakeup before moving on to the next ready one; level-triggered epoll brings it back
+  static constexpr int kReadsPerWakeup = 4;
+
+  std::string build_request(const std::vector<std::string> &symbols) const {
+    std::string target = path_;
+    if (!symbols.empty()) {
+      target += target.find('?') == std::string::npos ? "?symbols=" : "&symbols=";
+      for (size_t i = 0; i < symbols.size(); ++i) {
+        if (i > 0) {
+          target += ',';
+        }
+        target += symbols[i];
+      }
+    }
+    return "GET " + target + " HTTP/1.1\r\nHost: " + host_ + ":" + port_ +
+           "\r\nAccept: text/event-stream\r\nConnection: keep-alive\r\nCache-Control: no-cache\r\n\r\n";
+  }
+
+  // `wake` becomes readable when stop() wants this loop to exit
+  void run(size_t thread_index, int wake) {
+    pin_io_thread();
+    int epfd = ::epoll_create1(EPOLL_CLOEXEC);
+    if (epfd < 0) {
+      std::cerr << "md: epoll_create1 failed: " << std::strerror(errno) << std::endl;
+      return;
+    }
+    epoll_event wev{};
+    wev.events = EPOLLIN;
+    wev.data.ptr = nullptr;
+    ::epoll_ctl(epfd, EPOLL_CTL_ADD, wake, &wev);
+
+    std::vector<Connection *> mine;
+    for (size_t i = thread_index; i < connections_.size(); i += io_threads_) {
+      mine.push_back(connections_[i].get());
+    }
+
+    std::vector<epoll_event> ready(std::max<size_t>(mine.size(), 1) + 1);
+    while (running_) {
+      // (Re)connect whatever is idle and due; a failed attempt also asks for the name to be resolved again
+      const auto now = std::chrono::steady_clock::now();
+      auto next_retry = now + std::chrono::milliseconds(100);
+      for (Connection *c : mine) {
+        if (c->state != State::Idle) {
+          continue;
+        }
+        if (c->retry_at <= now) {
+          const std::shared_ptr<const addrinfo> addrs = current_addrs();
+          if (addrs == nullptr || !begin_connect(epfd, *c, addrs.get())) {
+            request_resolve();
+            schedule_retry(*c, now);
+          }
+        }
+        if (c->state == State::Idle) {
+          next_retry = std::min(next_retry, c->retry_at);
+        }
+      }
+
+      const auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(next_retry - now).count();
+      const int n = ::epoll_wait(epfd, ready.data(), static_cast<int>(ready.size()),
+                                 static_cast<int>(std::max<int64_t>(wait, 0)));
+      for (int i = 0; i < n && running_; ++i) {
+        auto *c = static_cast<Connection *>(ready[i].data.ptr);
+        if (c == nullptr) {
+          continue; // stop() woke us
+        }
+        const bool connecting = c->state == State::Connecting;
+        if (!service(epfd, *c, ready[i].events)) {
+          if (connecting) {
+            request_resolve(); // the address we tried may be stale
+          }
+          disconnect(epfd, *c);
+          schedule_retry(*c, std::chrono::steady_clock::now());
+        }
+      }
+    }
+
+    for (Connection *c : mine) {
+      if (c->state != State::Idle) {
+        disconnect(epfd, *c);
+      }
+    }
+    ::close(epfd);
+  }
+
+  // Resolves host_ whenever a loop asks, off the loops; a failed lookup keeps the last good answer
+  void resolve_loop() {
+    std::unique_lock<std::mutex> lock(resolve_mutex_);
+    while (true) {
+      resolve_cv_.wait(lock, [this]() { return resolve_requested_ || !running_; });
+      if (!running_) {
+        return;
+      }
+      resolve_requested_ = false;
+      lock.unlock();
+      std::shared_ptr<const addrinfo> fresh(resolve(), [](const addrinfo *a) {
+        if (a != nullptr) {
+          freeaddrinfo(const_cast<addrinfo *>(a));
+        }
+      });
+      lock.lock();
+      if (fresh != nullptr) {
+        addrs_ = std::move(fresh);
+      }
+    }
+  }
+
+  void request_resolve() {
+    {
+      std::lock_guard<std::mutex> lock(resolve_mutex_);
+      resolve_requested_ = true;
+    }
+    resolve_cv_.notify_one();
+  }
+
+  // A loop keeps the list it was handed alive while it connects, even if a newer one replaces it meanwhile
+  std::shared_ptr<const addrinfo> current_addrs() {
+    std::lock_guard<std::mutex> lock(resolve_mutex_);
+    return addrs_;
+  }
+
+  addrinfo *resolve() const {
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo *res = nullptr;
+    if (getaddrinfo(host_.c_str(), port_.c_str(), &hints, &res) != 0) {
+      return nullptr;
+    }
+    return res;
+  }
+
+  bool begin_connect(int epfd, Connection &c, const addrinfo *addrs) {
+    for (const addrinfo *p = addrs; p != nullptr; p = p->ai_next) {
+      int fd = ::socket(p->ai_family, p->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, p->ai_protocol);
+      if (fd < 0) {
+        continue;
+      }
+      if (::connect(fd, p->ai_addr, p->ai_addrlen) != 0 && errno != EINPROGRESS) {
+        ::close(fd);
+        continue;
+      }
+      epoll_event ev{};
+      ev.events = EPOLLOUT | EPOLLIN | EPOLLRDHUP;
+      ev.data.ptr = &c;
+      if (::epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+        ::close(fd);
+        return false;
+      }
+      c.fd = fd;
+      c.state = State::Connecting;
+      c.request_sent = 0;
+      c.framer.reset();
+      return true;
+    }
+    return false;
+  }
+
+  // Handles one readiness notification; false drops the connection
+  bool service(int epfd, Connection &c, uint32_t events) {
+    if (c.state == State::Connecting) {
+      if ((events & (EPOLLOUT | EPOLLERR | EPOLLHUP)) == 0) {
+        return true;
+      }
+      int err = 0;
+      socklen_t len = sizeof(err);
+      if (::getsockopt(c.fd, SOL_SOCKET, SO_ERROR, &err, &len) != 0 || err != 0) {
+        return false;
+      }
+      while (c.request_sent < c.request.size()) {
+        const ssize_t sent = ::send(c.fd, c.request.data() + c.request_sent, c.request.size() - c.request_sent,
+                                    MSG_NOSIGNAL);
+        if (sent < 0) {
+          return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        c.request_sent += static_cast<size_t>(sent);
+      }
+      epoll_event ev{};
+      ev.events = EPOLLIN | EPOLLRDHUP;
+      ev.data.ptr = &c;
+      ::epoll_ctl(epfd, EPOLL_CTL_MOD, c.fd, &ev);
+      c.state = State::Streaming;
+      std::lock_guard<std::mutex> lock(deliver_mutex_);
+      connects_.add();
+      connections_up_.add();
+      return true;
+    }
+
+    if ((events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) == 0) {
+      return true;
+    }
+    for (int reads = 0; reads < kReadsPerWakeup; ++reads) {
+      const ssize_t n = ::recv(c.fd, c.framer.write_ptr(), c.framer.write_space(), 0);
+      if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+        return true;
+      }
+      if (n <= 0) {
+        return false;
+      }
+      c.framer.commit(static_cast<size_t>(n));
+      c.events.clear();
+      const SseFramer::Status status = c.framer.drain([&c](std::string_view json) { c.events.push_back(json); });
+      if (status == SseFramer::Status::HttpError) {
+        return false;
+      }
+      if (!c.events.empty()) {
+        c.backoff = std::chrono::milliseconds(0); // data flowing again
+        std::lock_guard<std::mutex> lock(deliver_mutex_);
+        try {
+          on_top_of_book_batch(c.events.data(), c.events.size());
+        } catch (...) {
+        }
+      }
+    }
+    return true;
+  }
+
+  void disconnect(int epfd, Connection &c) {
+    if (c.fd >= 0) {
+      ::epoll_ctl(epfd, EPOLL_CTL_DEL, c.fd, nullptr);
+      ::shutdown(c.fd, SHUT_RDWR);
+      ::close(c.fd);
+      c.fd = -1;
+    }
+    if (c.state == State::Streaming) {
+      std::lock_guard<std::mutex> lock(deliver_mutex_);
+      disconnects_.add();
+      connections_up_.set(connections_up_.get() - 1);
+    }
+    c.state = State::Idle;
+  }
+
+  static void schedule_retry(Connection &c, std::chrono::steady_clock::time_point now) {
+    c.backoff = c.backoff.count() == 0 ? kMinBackoff : std::min(c.backoff * 2, kMaxBackoff);
+    c.retry_at = now + c.backoff;
+  }
+
+  std::string host_;
+  std::string port_;
+  std::string path_;
+  size_t io_threads_;
+  std::vector<std::unique_ptr<Connection>> connections_;
+  std::atomic<bool> running_{false};
+  std::vector<std::thread> workers_;
+  std::vector<int> wake_fds_; // one eventfd per I/O thread
+  std::mutex deliver_mutex_;
+  std::thread resolver_;
+  std::mutex resolve_mutex_;
+  std::condition_variable resolve_cv_;
+  bool resolve_requested_ = false;
+  std::shared_ptr<const addrinfo> addrs_; // latest successful resolution of host_, null until there is one
+  // Written by every I/O thread, so only under deliver_mutex_ (a Metric has a single writer)
+  Metric connects_;
+  Metric disconnects_;
+  Metric connections_up_;
+};
@@ -1,10 +1,12 @@
 #pragma once
 
 #include "../abstract/imarket_data_source.hpp"
+#include "sse_framer.hpp"
 #include <atomic>
 #include <cstring>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <chrono>
@@ -40,6 +42,7 @@ public:
 
 private:
   void run() {
+    pin_io_thread();
     while (running_) {
       struct addrinfo hints{};
       std::memset(&hints, 0, sizeof(hints));
@@ -82,66 +85,30 @@ private:
       (void)::send(fd, request.data(), request.size(), 0);
       // std::cerr << "md: request sent" << std::endl;
 
-      // Read loop
-      std::string buffer;
-      buffer.reserve(8192);
-      std::vector<char> tmp(4096);
-      bool headers_skipped = false;
+      // Read loop: recv straight into the framer, events go out as views into its buffer
+      framer_.reset();
+      events_.reserve(256);
       while (running_) {
-        ssize_t n = ::recv(fd, tmp.data(), tmp.size(), 0);
+        ssize_t n = ::recv(fd, framer_.write_ptr(), framer_.write_space(), 0);
         if (n <= 0)
           break;
-        buffer.append(tmp.data(), static_cast<size_t>(n));
-
-        if (!headers_skipped) {
-          size_t pos = buffer.find("\r\n\r\n");
-          if (pos == std::string::npos) {
-            continue;
-          }
-          if (buffer.rfind("HTTP/", 0) == 0) {
-            size_t sp1 = buffer.find(' ');
-            if (sp1 != std::string::npos && sp1 + 4 <= buffer.size()) {
-              std::string code = buffer.substr(sp1 + 1, 3);
-              if (code != "200") {
-                int expected2 = fd;
-                if (sock_.compare_exchange_strong(expected2, -1)) {
-                  ::shutdown(fd, SHUT_RDWR);
-                  ::close(fd);
-                }
-                break;
-              }
-            }
+        framer_.commit(static_cast<size_t>(n));
+        // Everything this read completed goes out as one batch
+        events_.clear();
+        const SseFramer::Status status = framer_.drain([this](std::string_view json) { events_.push_back(json); });
+        if (!events_.empty()) {
+          try {
+            on_top_of_book_batch(events_.data(), events_.size());
+          } catch (...) {
           }
-          buffer.erase(0, pos + 4);
-          headers_skipped = true;
         }
-
-        size_t line_start = 0;
-        for (;;) {
-          size_t nl = buffer.find('\n', line_start);
-          if (nl == std::string::npos) {
-            buffer.erase(0, line_start);
-            break;
-          }
-          std::string line = buffer.substr(line_start, nl - line_start);
-          if (!line.empty() && line.back() == '\r')
-            line.pop_back();
-          line_start = nl + 1;
-
-          if (line.size() >= 5) {
-            bool is_data = (line[0] == 'd' || line[0] == 'D') && (line[1] == 'a' || line[1] == 'A') &&
-                           (line[2] == 't' || line[2] == 'T') && (line[3] == 'a' || line[3] == 'A') && line[4] == ':';
-            if (is_data) {
-              size_t p = 5;
-              if (p < line.size() && line[p] == ' ')
-                ++p;
-              std::string json = line.substr(p);
-              try {
-                on_top_of_book(json);
-              } catch (...) {
-              }
-            }
+        if (status == SseFramer::Status::HttpError) {
+          int expected2 = fd;
+          if (sock_.compare_exchange_strong(expected2, -1)) {
+            ::shutdown(fd, SHUT_RDWR);
+            ::close(fd);
           }
+          break;
         }
       }
 
@@ -163,5 +130,7 @@ private:
   std::string path_;
   std::atomic<bool> running_{false};
   std::atomic<int> sock_{-1};
+  SseFramer framer_;
+  std::vector<std::string_view> events_;
   std::thread worker_{};
 };
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+
+// Frames an HTTP text/event-stream response in place. recv() writes straight into the framer's linear buffer
+// (write_ptr/write_space, then commit); drain() finds lines with memchr and hands every `data:` payload to the
+// caller as a string_view into that buffer, valid until the next commit. Only the trailing partial line is
+// moved back to the front after a drain, so nothing is copied per event.
+//
+// Each data line is delivered as its own event (mdapi sends one per event); other SSE fields, comments and
+// blank lines are skipped. A line longer than the buffer is dropped.
+class SseFramer {
+public:
+  enum class Status { Ok, HttpError };
+
+  explicit SseFramer(size_t capacity = 64 * 1024) : buf_(new char[capacity]), capacity_(capacity) {}
+
+  // Starts over for a new connection: expects a status line and headers first
+  void reset() {
+    begin_ = end_ = 0;
+    headers_done_ = false;
+    discarding_ = false;
+  }
+
+  char *write_ptr() { return buf_.get() + end_; }
+  size_t write_space() const { return capacity_ - end_; }
+  void commit(size_t n) { end_ += n; }
+
+  // Delivers every complete data line received so far to on_data(std::string_view). HttpError if the response
+  // status is not 200, after which the connection should be dropped.
+  template <typename Fn> Status drain(Fn &&on_data) {
+    if (!headers_done_ && !skip_headers()) {
+      return status_ok_ ? Status::Ok : Status::HttpError;
+    }
+    const char *base = buf_.get();
+    size_t pos = begin_;
+    while (pos < end_) {
+      const char *nl = static_cast<const char *>(std::memchr(base + pos, '\n', end_ - pos));
+      if (nl == nullptr) {
+        break;
+      }
+      const size_t next = static_cast<size_t>(nl - base) + 1;
+      if (discarding_) {
+        discarding_ = false;
+      } else {
+        size_t len = next - 1 - pos;
+        if (len > 0 && base[pos + len - 1] == '\r') {
+          len--;
+        }
+        std::string_view payload;
+        if (data_payload(std::string_view(base + pos, len), payload)) {
+          on_data(payload);
+        }
+      }
+      pos = next;
+    }
+    begin_ = pos;
+    compact();
+    return Status::Ok;
+  }
+
+private:
+  // "data:" in any case, then an optional single space
+  static bool data_payload(std::string_view line, std::string_view &payload) {
+    if (line.size() < 5 || (line[0] | 0x20) != 'd' || (line[1] | 0x20) != 'a' || (line[2] | 0x20) != 't' ||
+        (line[3] | 0x20) != 'a' || line[4] != ':') {
+      return false;
+    }
+    const size_t start = line.size() > 5 && line[5] == ' ' ? 6 : 5;
+    payload = line.substr(start);
+    return true;
+  }
+
+  // Consumes the status line and headers once they are complete; false while they are still arriving or if
+  // the status is not 200 (status_ok_ tells which)
+  bool skip_headers() {
+    const std::string_view text(buf_.get() + begin_, end_ - begin_);
+    const size_t terminator = text.find("\r\n\r\n");
+    if (terminator == std::string_view::npos) {
+      status_ok_ = true;
+      if (write_space() == 0) {
+        begin_ = end_ = 0; // headers larger than the buffer: nothing sensible to keep
+      }
+      return false;
+    }
+    status_ok_ = true;
+    if (text.compare(0, 5, "HTTP/") == 0) {
+      const size_t sp = text.find(' ');
+      if (sp != std::string_view::npos && sp + 4 <= text.size()) {
+        status_ok_ = text.compare(sp + 1, 3, "200") == 0;
+      }
+    }
+    if (!status_ok_) {
+      return false;
+    }
+    begin_ += terminator + 4;
+    headers_done_ = true;
+    return true;
+  }
+
+  void compact() {
+    if (begin_ == end_) {
+      begin_ = end_ = 0;
+      return;
+    }
+    if (begin_ == 0 && end_ == capacity_) {
+      // One line fills the whole buffer: drop what there is and the rest of it as it arrives
+      begin_ = end_ = 0;
+      discarding_ = true;
+      return;
+    }
+    if (begin_ > 0 && write_space() < capacity_ / 4) {
+      std::memmove(buf_.get(), buf_.get() + begin_, end_ - begin_);
+      end_ -= begin_;
+      begin_ = 0;
+    }
+  }
+
+  std::unique_ptr<char[]> buf_;
+  size_t capacity_;
+  size_t begin_ = 0; // first byte not yet framed
+  size_t end_ = 0;   // one past the last received byte
+  bool headers_done_ = false;
+  bool status_ok_ = true;
+  bool discarding_ = false;
+};
@@ -4,12 +4,21 @@
 #include "abstract/imarket_data_source.hpp"
 #include "abstract/md_notifier.hpp"
 #include "core/command_sender.hpp"
+#include "core/latency_histogram.hpp"
+#include "core/send_buffer.hpp"
+#include "core/sequence_ring.hpp"
+#include "core/shm_metrics.hpp"
+#include "core/spsc_ring.hpp"
+#include "md_pipeline.hpp"
 #include "utils/instanceid_utils.hpp"
-#include "utils/md_utils.hpp"
+#include "utils/tob_decoder.hpp"
+#include <atomic>
 #include <cstdint>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <string>
+#include <thread>
 
 #include <generated/messages.pb.h>
 
@@ -17,35 +26,261 @@ class MarketDataFeedApp : public Application, public ICommandSender<MarketDataFe
 public:
   MarketDataFeedApp(const std::string &cmd_addr, uint16_t cmd_port, uint8_t ttl,
                     std::function<void(const std::string &)> log, std::unique_ptr<IMarketDataSource> src)
-      : ICommandSender<MarketDataFeedApp>(cmd_addr, cmd_port, ttl), log_(std::move(log)), source_(std::move(src)) {}
+      : ICommandSender<MarketDataFeedApp>(cmd_addr, cmd_port, ttl), log_(std::move(log)), source_(std::move(src)) {
+    // A burst goes out as one send batch, flushed at its end, unless MCAST_SEND_BATCH already set a policy
+    if (!batching_enabled()) {
+      SendBatchPolicy policy = get_batch_policy();
+      policy.max_batch = kMaxMdBatch;
+      set_batch_policy(policy);
+    }
+  }
+
+  ~MarketDataFeedApp() override { stop_pipeline(); }
+
+  // Called on the source's thread; the decoder and command are reused from quote to quote
+  void notify(std::string_view data) override {
+    if (decoder_.decode(data, seq_instance_, cmd_)) {
+      this->send_command(cmd_, get_instance_id());
+    }
+  }
+
+  // Every quote from one read of the source, decoded as one document stream and sent as one batch, or with
+  // the pipeline enabled only copied into its ring
+  void notify_batch(const std::string_view *data, size_t count) override {
+    if (quotes_) {
+      ingest(data, count);
+      return;
+    }
+    decoder_.decode_many(data, count, seq_instance_, cmd_, [this](const toysequencer::TopOfBookCommand &cmd) {
+      if (send_buf_.serialize(cmd)) {
+        this->enqueue_numbered(send_buf_);
+      }
+    });
+    this->flush_numbered();
+  }
 
-  void notify(const std::string &data) override {
-    toysequencer::TopOfBookCommand cmd =
-        MDUtils::parse_json_tob(data, get_instance_id(), InstanceIdUtils::get_instance_id("SEQ"));
-    this->send_command(cmd, get_instance_id());
+  void send_command(const toysequencer::TopOfBookCommand &command, const uint64_t /*sender_id*/) {
+    if (send_buf_.serialize(command)) {
+      this->send_numbered(send_buf_);
+    }
   }
 
-  void send_command(const toysequencer::TopOfBookCommand &command, const uint64_t sender_id) {
-    std::string bytes = command.SerializeAsString();
-    std::vector<uint8_t> data(bytes.begin(), bytes.end());
-    this->send_m(data);
+  // Moves decoding and publishing off the source's I/O thread onto stage threads connected by pre-allocated
+  // SpscRings (see md_pipeline.hpp). Call before start().
+  void enable_pipeline(const MdPipelineConfig &config) {
+    pipeline_config_ = config;
+    quotes_ = std::make_unique<SpscRing<MdQuoteSlot>>(config.ring_size);
+    if (config.stages >= 3) {
+      commands_ = std::make_unique<SpscRing<MdCommandSlot>>(config.ring_size);
+    }
+    ShmMetrics &metrics = ShmMetrics::instance();
+    quote_depth_ = metrics.gauge("md pipeline quote depth");
+    command_depth_ = metrics.gauge("md pipeline command depth");
+    quote_full_waits_ = metrics.counter("md pipeline quote full waits");
+    command_full_waits_ = metrics.counter("md pipeline command full waits");
+    oversized_drops_ = metrics.counter("md pipeline oversized drops");
+    if (source_) {
+      source_->set_io_cpu(config.cpu_for(MdPipelineConfig::IoStage));
+    }
   }
 
+  bool pipeline_enabled() const { return quotes_ != nullptr; }
+  size_t get_pipeline_stages() const { return commands_ ? 3 : 2; }
+  size_t get_pipeline_capacity() const { return quotes_ ? quotes_->capacity() : 0; }
+
+  // Pipeline stage histograms (LATENCY_STATS=1); send lives in the sender base
+  // I/O thread handing a quote over to the decode stage picking it up
+  const LatencyHistogram &get_queue_latency() const { return queue_latency_; }
+  // Decoding and serializing one batch of quotes taken from the ring
+  const LatencyHistogram &get_decode_latency() const { return decode_latency_; }
+  // Three stages only: decode stage handing a command over to the publish stage picking it up
+  const LatencyHistogram &get_publish_queue_latency() const { return publish_queue_latency_; }
+
   void start() override {
     if (!source_)
       return;
-    source_->register_callback([this](const std::string &data) { this->notify(data); });
+    if (quotes_ && !pipeline_running_.exchange(true)) {
+      decode_done_.store(false);
+      decode_thread_ = std::thread([this] { this->run_decode_stage(); });
+      if (commands_) {
+        publish_thread_ = std::thread([this] { this->run_publish_stage(); });
+      }
+    }
+    source_->register_batch_callback(
+        [this](const std::string_view *data, size_t count) { this->notify_batch(data, count); });
     source_->start();
   }
 
   void stop() override {
     if (source_)
       source_->stop();
+    stop_pipeline();
   }
 
   uint64_t get_instance_id() const override { return InstanceIdUtils::get_instance_id("MD"); }
 
 private:
+  static constexpr size_t kMaxMdBatch = 64;
+
+  // I/O stage: copies each quote into the next ring slot. The epoll source calls this from several threads,
+  // but one at a time, so the ring still has a single producer. A full ring makes the I/O thread wait rather
+  // than drop quotes.
+  void ingest(const std::string_view *data, size_t count) {
+    const uint64_t now = latency::enabled() ? latency::now_ns() : 0;
+    for (size_t i = 0; i < count; ++i) {
+      if (data[i].size() > MdQuoteSlot::kQuoteBytes) {
+        oversized_drops_.add();
+        continue;
+      }
+      MdQuoteSlot *slot = quotes_->claim();
+      if (slot == nullptr) {
+        quote_full_waits_.add();
+        PhasedWait wait;
+        while ((slot = quotes_->claim()) == nullptr) {
+          if (!pipeline_running_.load(std::memory_order_relaxed)) {
+            return;
+          }
+          wait.pause();
+        }
+      }
+      std::memcpy(slot->json, data[i].data(), data[i].size());
+      slot->len = static_cast<uint32_t>(data[i].size());
+      slot->ingest_ns = now;
+      quotes_->publish();
+    }
+  }
+
+  // Decode stage: decodes up to kMaxMdBatch quotes at a time as one document stream, then hands the commands
+  // to the publish stage, or numbers and sends them itself with two stages. Exits once the source has stopped
+  // and the ring is empty.
+  void run_decode_stage() {
+    pin_stage(MdPipelineConfig::DecodeStage);
+    std::string_view views[kMaxMdBatch];
+    PhasedWait idle;
+    for (;;) {
+      const size_t n = quotes_->readable(kMaxMdBatch);
+      if (n == 0) {
+        if (!pipeline_running_.load() && quotes_->readable(1) == 0) {
+          break;
+        }
+        idle.pause();
+        continue;
+      }
+      idle = PhasedWait();
+      const uint64_t start_ns = latency::enabled() ? latency::now_ns() : 0;
+      for (size_t i = 0; i < n; ++i) {
+        const MdQuoteSlot &slot = quotes_->peek(i);
+        views[i] = std::string_view(slot.json, slot.len);
+        if (start_ns != 0 && slot.ingest_ns != 0) {
+          queue_latency_.record(start_ns - slot.ingest_ns);
+        }
+      }
+      decoder_.decode_many(views, n, seq_instance_, cmd_, [this](const toysequencer::TopOfBookCommand &cmd) {
+        if (commands_) {
+          this->hand_off(cmd);
+        } else if (send_buf_.serialize(cmd)) {
+          this->enqueue_numbered(send_buf_);
+        }
+      });
+      quotes_->release(n);
+      if (!commands_) {
+        this->flush_numbered();
+      }
+      if (start_ns != 0) {
+        decode_latency_.record_since(start_ns);
+      }
+      quote_depth_.set(quotes_->size());
+    }
+  }
+
+  // Serializes a decoded command straight into the next publish slot, waiting for one if the ring is full
+  void hand_off(const toysequencer::TopOfBookCommand &cmd) {
+    MdCommandSlot *slot = commands_->claim();
+    if (slot == nullptr) {
+      command_full_waits_.add();
+      PhasedWait wait;
+      while ((slot = commands_->claim()) == nullptr) {
+        wait.pause();
+      }
+    }
+    if (!slot->command.serialize(cmd)) {
+      return; // cannot happen for a quote that fit its MdQuoteSlot
+    }
+    slot->decoded_ns = latency::enabled() ? latency::now_ns() : 0;
+    commands_->publish();
+  }
+
+  // Publish stage: numbers and sends whatever the decode stage has handed over as one send batch. Exits once
+  // the decode stage has and the ring is empty.
+  void run_publish_stage() {
+    pin_stage(MdPipelineConfig::PublishStage);
+    PhasedWait idle;
+    for (;;) {
+      const size_t n = commands_->readable(kMaxMdBatch);
+      if (n == 0) {
+        if (decode_done_.load() && commands_->readable(1) == 0) {
+          break;
+        }
+        idle.pause();
+        continue;
+      }
+      idle = PhasedWait();
+      const uint64_t start_ns = latency::enabled() ? latency::now_ns() : 0;
+      for (size_t i = 0; i < n; ++i) {
+        MdCommandSlot &slot = commands_->peek(i);
+        if (start_ns != 0 && slot.decoded_ns != 0) {
+          publish_queue_latency_.record(start_ns - slot.decoded_ns);
+        }
+        this->enqueue_numbered(slot.command);
+      }
+      commands_->release(n);
+      this->flush_numbered();
+      command_depth_.set(commands_->size());
+    }
+  }
+
+  void pin_stage(MdPipelineConfig::Stage stage) {
+    const int cpu = pipeline_config_.cpu_for(stage);
+    if (cpu >= 0 && !ThreadUtils::pin_current_thread(cpu)) {
+      log_("md: could not pin pipeline stage " + std::to_string(static_cast<int>(stage)) + " to cpu " +
+           std::to_string(cpu));
+    }
+  }
+
+  // The source has stopped by now; each stage drains what it was handed before exiting
+  void stop_pipeline() {
+    if (!pipeline_running_.exchange(false)) {
+      return;
+    }
+    if (decode_thread_.joinable()) {
+      decode_thread_.join();
+    }
+    decode_done_.store(true);
+    if (publish_thread_.joinable()) {
+      publish_thread_.join();
+    }
+  }
+
   std::function<void(const std::string &)> log_;
   std::unique_ptr<IMarketDataSource> source_;
+  SendBuffer send_buf_;
+  TobDecoder decoder_;
+  toysequencer::TopOfBookCommand cmd_;
+  const uint64_t seq_instance_ = InstanceIdUtils::get_instance_id("SEQ");
+
+  MdPipelineConfig pipeline_config_;
+  std::unique_ptr<SpscRing<MdQuoteSlot>> quotes_;
+  std::unique_ptr<SpscRing<MdCommandSlot>> commands_;
+  std::atomic<bool> pipeline_running_{false};
+  std::atomic<bool> decode_done_{false};
+  std::thread decode_thread_;
+  std::thread publish_thread_;
+  LatencyHistogram queue_latency_;
+  LatencyHistogram decode_latency_;
+  LatencyHistogram publish_queue_latency_;
+  Metric quote_depth_;
+  Metric command_depth_;
+  Metric quote_full_waits_;   // I/O thread
+  Metric command_full_waits_; // decode stage
+  Metric oversized_drops_;
 };
@@ -1,20 +1,81 @@
 #include "../../utils/env_utils.hpp"
+#include "core/latency_reporter.hpp"
+#include "core/shm_metrics.hpp"
 #include "abstract/imarket_data_source.hpp"
 #include "impl/http_market_data_source.hpp"
+#ifdef __linux__
+#include "impl/epoll_sse_market_data_source.hpp"
+#endif
 #include "market_data_feed.hpp"
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <csignal>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <sstream>
+#include <string>
 #include <thread>
+#include <vector>
 
 static std::atomic<bool> running{true};
 static void handle_signal(int) { running.store(false); }
+#ifndef _WIN32
+static void handle_dump_signal(int) { LatencyReporter::request_dump(); }
+#endif
+
+// A count from the environment; unset, empty or not a positive number gives 0
+static size_t count_from_env(const char *name) {
+  const char *value = std::getenv(name);
+  if (value == nullptr || value[0] == '\0') {
+    return 0;
+  }
+  char *end = nullptr;
+  long n = std::strtol(value, &end, 10);
+  return *end == '\0' && n > 0 ? static_cast<size_t>(n) : 0;
+}
+
+// MD_SOURCE_SYMBOLS (comma separated) dealt round-robin over at most `connections` subsets. No symbols means a
+// single connection streaming every symbol: more of them would each carry every quote and send it again.
+static std::vector<std::vector<std::string>> split_symbols(const char *list, size_t connections) {
+  std::vector<std::vector<std::string>> subsets(connections);
+  std::stringstream ss(list ? list : "");
+  std::string symbol;
+  size_t next = 0;
+  while (std::getline(ss, symbol, ',')) {
+    if (!symbol.empty()) {
+      subsets[next++ % connections].push_back(symbol);
+    }
+  }
+  subsets.resize(std::max<size_t>(1, std::min(next, connections)));
+  return subsets;
+}
+
+static std::unique_ptr<IMarketDataSource> make_source() {
+  const char *host = std::getenv("MD_SOURCE_HOST");
+  const char *port = std::getenv("MD_SOURCE_PORT");
+  const char *path = std::getenv("MD_SOURCE_PATH");
+#ifdef __linux__
+  // MD_SOURCE_CONNECTIONS=N spreads the symbols over N SSE connections on MD_IO_THREADS epoll loops
+  const size_t connections = count_from_env("MD_SOURCE_CONNECTIONS");
+  if (connections > 0) {
+    auto subsets = split_symbols(std::getenv("MD_SOURCE_SYMBOLS"), connections);
+    if (connections > 1 && subsets.size() == 1 && subsets[0].empty()) {
+      std::cout << "md: MD_SOURCE_CONNECTIONS=" << connections
+                << " needs MD_SOURCE_SYMBOLS to split the stream; using one connection" << std::endl;
+    }
+    return std::make_unique<EpollSseMarketDataSource>(host, port, path, std::move(subsets),
+                                                      std::max<size_t>(1, count_from_env("MD_IO_THREADS")));
+  }
+#endif
+  return std::make_unique<HttpSseMarketDataSource>(host, port, path);
+}
 
 int main() {
   try {
     EnvUtils::load_env();
+    ShmMetrics::init("market_data");
 
     std::signal(SIGINT, handle_signal);
     std::signal(SIGTERM, handle_signal);
@@ -24,14 +85,46 @@ int main() {
 
     uint64_t md_instance_id = 3;
 
-    std::unique_ptr<IMarketDataSource> src = std::make_unique<HttpSseMarketDataSource>(
-        std::getenv("MD_SOURCE_HOST"), std::getenv("MD_SOURCE_PORT"), std::getenv("MD_SOURCE_PATH"));
+    std::unique_ptr<IMarketDataSource> src = make_source();
 
     const std::string cmd_addr = std::getenv("CMD_ADDR");
     const uint16_t cmd_port = std::stoi(std::getenv("CMD_PORT"));
     const uint8_t mcast_ttl = 1;
 
     MarketDataFeedApp md(cmd_addr, cmd_port, mcast_ttl, log, std::move(src));
+    // The feed does not consume events itself; with CMD_RETRANSMIT_MS set it listens to them for acks
+    const char *events_addr = std::getenv("EVENTS_ADDR");
+    const char *events_port = std::getenv("EVENTS_PORT");
+    if (events_addr && events_port) {
+      md.listen_for_acks(events_addr, static_cast<uint16_t>(std::stoi(events_port)), md.get_instance_id());
+    }
+
+    const MdPipelineConfig pipeline_config = MdPipelineConfig::from_env();
+    if (pipeline_config.enabled) {
+      md.enable_pipeline(pipeline_config);
+      std::cout << "md: pipeline enabled (" << md.get_pipeline_stages() << " stages, ring "
+                << md.get_pipeline_capacity() << " slots)" << std::endl;
+    }
+
+    LatencyReporter latency_reporter("md");
+    if (md.pipeline_enabled()) {
+      latency_reporter.add("queue", md.get_queue_latency());
+      latency_reporter.add("decode", md.get_decode_latency());
+      if (md.get_pipeline_stages() > 2) {
+        latency_reporter.add("publish queue", md.get_publish_queue_latency());
+      }
+    }
+    latency_reporter.add("send", md.get_send_latency());
+    if (latency::enabled()) {
+      long interval_s = 0;
+      if (const char *interval_env = std::getenv("LATENCY_DUMP_S")) {
+        interval_s = std::max(0L, std::strtol(interval_env, nullptr, 10));
+      }
+#ifndef _WIN32
+      std::signal(SIGUSR1, handle_dump_signal);
+#endif
+      latency_reporter.start(std::chrono::seconds(interval_s));
+    }
 
     md.start();
 
@@ -40,6 +133,10 @@ int main() {
     }
 
     md.stop();
+    latency_reporter.stop();
+    if (latency::enabled()) {
+      latency_reporter.dump(std::cout);
+    }
     return 0;
   } catch (const std::exception &e) {
     std::cerr << "md error: " << e.what() << std::endl;
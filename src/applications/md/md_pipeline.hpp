@@ -0,0 +1,61 @@
+#pragma once
+
+#include "core/send_buffer.hpp"
+#include "utils/thread_utils.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Staged market data feed: the source's I/O thread only copies quotes into a ring, a decode stage turns them
+// into serialized TopOfBookCommands and a publish stage sends them, so a slow sendto never holds up the socket
+// reads. With two stages the decode stage also publishes.
+struct MdPipelineConfig {
+  enum Stage { IoStage = 0, DecodeStage = 1, PublishStage = 2 };
+
+  bool enabled = false;
+  size_t stages = 3;
+  size_t ring_size = 1024;
+  std::vector<int> cpus; // indexed by Stage; missing or -1 leaves the stage unpinned
+
+  int cpu_for(Stage stage) const { return static_cast<size_t>(stage) < cpus.size() ? cpus[stage] : -1; }
+
+  // MD_PIPELINE=1 enables it, MD_PIPELINE_STAGES=2 folds publishing into the decode stage, MD_PIPELINE_RING
+  // sets the slots per ring and MD_PIPELINE_CPUS="io,decode,publish" pins the stages
+  static MdPipelineConfig from_env() {
+    MdPipelineConfig config;
+    const char *enabled = std::getenv("MD_PIPELINE");
+    config.enabled = enabled && enabled[0] == '1';
+    if (const char *stages = std::getenv("MD_PIPELINE_STAGES")) {
+      config.stages = std::strtol(stages, nullptr, 10) == 2 ? 2 : 3;
+    }
+    if (const char *ring = std::getenv("MD_PIPELINE_RING")) {
+      long n = std::strtol(ring, nullptr, 10);
+      if (n > 0) {
+        config.ring_size = static_cast<size_t>(n);
+      }
+    }
+    if (const char *cpus = std::getenv("MD_PIPELINE_CPUS")) {
+      config.cpus = ThreadUtils::parse_cpu_list(cpus);
+    }
+    return config;
+  }
+};
+
+// One quote as the I/O thread handed it over; allocated once with the ring
+struct MdQuoteSlot {
+  static constexpr size_t kQuoteBytes = 512;
+
+  uint64_t ingest_ns = 0; // set with LATENCY_STATS=1
+  uint32_t len = 0;
+  char json[kQuoteBytes];
+};
+
+// One decoded quote, serialized and waiting for the publish stage to number and send it
+struct MdCommandSlot {
+  // The symbol is no longer than the quote it came from; the other fields, sender epoch and cseq fit in the rest
+  static constexpr size_t kCommandBytes = MdQuoteSlot::kQuoteBytes + 128;
+
+  uint64_t decoded_ns = 0; // set with LATENCY_STATS=1
+  SendBuffer command{kCommandBytes};
+};
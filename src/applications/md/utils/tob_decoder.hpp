@@ -0,0 +1,204 @@
+#pragma once
+
+#include "generated/messages.pb.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <simdjson.h>
+#include <string_view>
+#include <vector>
+
+// Stateful top-of-book decoder: keeps one simdjson parser and one padded scratch buffer alive across quotes,
+// so a warmed-up decoder does not allocate. Not thread-safe; use one per thread (for_thread()).
+//
+// mdapi always emits symbol, bid_price, bid_size, ask_price, ask_size, timestamp in that order, so fields are
+// read front to back in one pass. A payload in any other order is re-read with unordered lookups. Bursts go
+// through decode_many, which parses them as one document stream.
+class TobDecoder {
+public:
+  static TobDecoder &for_thread() {
+    thread_local TobDecoder decoder;
+    return decoder;
+  }
+
+  // Fills `out` (reusing its storage) from one JSON quote; false, with `out` unspecified, if it does not parse
+  bool decode(std::string_view json, uint64_t target_instance, toysequencer::TopOfBookCommand &out) {
+    if (!reserve(json.size())) {
+      return false;
+    }
+    std::memcpy(scratch_.get(), json.data(), json.size());
+    std::memset(scratch_.get() + json.size(), 0, simdjson::SIMDJSON_PADDING);
+    simdjson::ondemand::document doc;
+    if (parser_.iterate(scratch_.get(), json.size(), capacity_).get(doc)) {
+      return false;
+    }
+    Fields fields;
+    return read(doc, fields) && fill(fields, target_instance, out);
+  }
+
+  // Decodes a burst of quotes as one simdjson document stream, calling on_command(out) for each one that parses,
+  // in order. on_command must not use this decoder. Returns how many decoded.
+  template <typename Fn>
+  size_t decode_many(const std::string_view *quotes, size_t count, uint64_t target_instance,
+                     toysequencer::TopOfBookCommand &out, Fn &&on_command) {
+    if (count == 1) {
+      return decode(quotes[0], target_instance, out) ? (on_command(out), 1) : 0;
+    }
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+      total += quotes[i].size() + 1;
+    }
+    if (count == 0 || !reserve(total)) {
+      return 0;
+    }
+    // Newline-separated, as iterate_many expects; offsets_ remembers where each quote starts
+    offsets_.resize(count + 1);
+    char *dst = scratch_.get();
+    for (size_t i = 0; i < count; ++i) {
+      offsets_[i] = static_cast<size_t>(dst - scratch_.get());
+      std::memcpy(dst, quotes[i].data(), quotes[i].size());
+      dst += quotes[i].size();
+      *dst++ = '\n';
+    }
+    offsets_[count] = total;
+    std::memset(dst, 0, simdjson::SIMDJSON_PADDING);
+
+    size_t decoded = 0;
+    size_t next = 0;
+    {
+      simdjson::ondemand::document_stream stream;
+      if (!parser_.iterate_many(scratch_.get(), total, std::max(total, kStreamBatchBytes)).get(stream)) {
+        for (auto it = stream.begin(); it != stream.end() && next < count; ++it) {
+          // A document that does not start inside the quote we expect means a malformed quote threw the stream
+          // off; the rest are decoded one by one below
+          const size_t at = it.current_index();
+          if (at < offsets_[next] || at >= offsets_[next + 1]) {
+            break;
+          }
+          simdjson::ondemand::document_reference doc;
+          if ((*it).get(doc)) {
+            break;
+          }
+          Fields fields;
+          if (read(doc, fields) && fill(fields, target_instance, out)) {
+            on_command(out);
+            decoded++;
+          }
+          next++;
+        }
+      }
+    }
+    for (; next < count; ++next) {
+      if (decode(quotes[next], target_instance, out)) {
+        on_command(out);
+        decoded++;
+      }
+    }
+    return decoded;
+  }
+
+private:
+  struct Fields {
+    std::string_view symbol;
+    double bid_price = 0.0;
+    double bid_size = 0.0;
+    double ask_price = 0.0;
+    double ask_size = 0.0;
+    double timestamp = 0.0;
+  };
+
+  // iterate_many batch size: one batch covers any burst a single read can bring in
+  static constexpr size_t kStreamBatchBytes = 64 * 1024;
+
+  // Room for `len` bytes plus SIMDJSON_PADDING in the scratch buffer, growing it if needed
+  bool reserve(size_t len) {
+    const size_t needed = len + simdjson::SIMDJSON_PADDING;
+    if (needed > capacity_) {
+      size_t capacity = capacity_ == 0 ? 512 : capacity_;
+      while (capacity < needed) {
+        capacity *= 2;
+      }
+      scratch_.reset(new (std::nothrow) char[capacity]);
+      capacity_ = scratch_ ? capacity : 0;
+      if (!scratch_) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Only a field missing from where mdapi puts it means another order; any other error is malformed JSON, after
+  // which simdjson has abandoned the document and it cannot be rewound
+  template <typename Doc> static bool read(Doc &doc, Fields &fields) {
+    const simdjson::error_code error = read_ordered(doc, fields);
+    if (error != simdjson::NO_SUCH_FIELD) {
+      return error == simdjson::SUCCESS;
+    }
+    doc.rewind();
+    return read_unordered(doc, fields) == simdjson::SUCCESS;
+  }
+
+  static bool fill(const Fields &fields, uint64_t target_instance, toysequencer::TopOfBookCommand &out) {
+    if (fields.bid_size < 0 || fields.ask_size < 0) {
+      return false;
+    }
+    out.set_msg_type(toysequencer::TOB_COMMAND);
+    out.set_tin(target_instance);
+    out.set_sid(target_instance);
+    out.mutable_symbol()->assign(fields.symbol.data(), fields.symbol.size());
+    out.set_bid_price(fields.bid_price);
+    out.set_bid_size(static_cast<uint64_t>(fields.bid_size));
+    out.set_ask_price(fields.ask_price);
+    out.set_ask_size(static_cast<uint64_t>(fields.ask_size));
+    out.set_exchange_time(static_cast<uint64_t>(fields.timestamp * 1'000'000.0));
+    return true;
+  }
+
+  template <typename Doc> static simdjson::error_code read_ordered(Doc &doc, Fields &f) {
+    simdjson::ondemand::object obj;
+    if (auto error = doc.get_object().get(obj)) {
+      return error;
+    }
+    if (auto error = obj.find_field("symbol").get_string().get(f.symbol)) {
+      return error;
+    }
+    if (auto error = obj.find_field("bid_price").get_double().get(f.bid_price)) {
+      return error;
+    }
+    if (auto error = obj.find_field("bid_size").get_double().get(f.bid_size)) {
+      return error;
+    }
+    if (auto error = obj.find_field("ask_price").get_double().get(f.ask_price)) {
+      return error;
+    }
+    if (auto error = obj.find_field("ask_size").get_double().get(f.ask_size)) {
+      return error;
+    }
+    return obj.find_field("timestamp").get_double().get(f.timestamp);
+  }
+
+  template <typename Doc> static simdjson::error_code read_unordered(Doc &doc, Fields &f) {
+    if (auto error = doc["symbol"].get_string().get(f.symbol)) {
+      return error;
+    }
+    if (auto error = doc["bid_price"].get_double().get(f.bid_price)) {
+      return error;
+    }
+    if (auto error = doc["bid_size"].get_double().get(f.bid_size)) {
+      return error;
+    }
+    if (auto error = doc["ask_price"].get_double().get(f.ask_price)) {
+      return error;
+    }
+    if (auto error = doc["ask_size"].get_double().get(f.ask_size)) {
+      return error;
+    }
+    return doc["timestamp"].get_double().get(f.timestamp);
+  }
+
+  simdjson::ondemand::parser parser_;
+  std::unique_ptr<char[]> scratch_;
+  size_t capacity_ = 0;
+  std::vector<size_t> offsets_;
+};
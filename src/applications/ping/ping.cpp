@@ -8,6 +8,9 @@ PingApp::PingApp(const std::string &commands_multicast_address, const uint16_t c
       EventReceiver<PingApp>(get_instance_id(), events_multicast_address, events_port), log_(std::move(log)) {}
 
 void PingApp::on_event(const toysequencer::TextEvent &event) {
+  if (event.sid() == get_instance_id())
+    this->ack(event.cseq());
+
   if (event.tin() != get_instance_id())
     return;
 
@@ -16,10 +19,15 @@ void PingApp::on_event(const toysequencer::TextEvent &event) {
   }
 }
 
-void PingApp::send_command(const toysequencer::TextCommand &command, uint64_t sender_id) {
-  std::string bytes = command.SerializeAsString();
-  std::vector<uint8_t> data(bytes.begin(), bytes.end());
-  this->send_m(data);
+void PingApp::on_command_dropped(uint64_t sid, uint64_t cseq) {
+  if (sid == get_instance_id())
+    this->dropped(cseq);
+}
+
+void PingApp::send_command(const toysequencer::TextCommand &command, uint64_t /*sender_id*/) {
+  if (send_buf_.serialize(command)) {
+    this->send_numbered(send_buf_);
+  }
 }
 
 void PingApp::start() { EventReceiver<PingApp>::start(); }
@@ -3,6 +3,7 @@
 #include "../application.hpp"
 #include "core/command_sender.hpp"
 #include "core/event_receiver.hpp"
+#include "core/send_buffer.hpp"
 #include "generated/messages.pb.h"
 #include <cstdint>
 #include <functional>
@@ -17,6 +18,7 @@ public:
 
   // callbacks
   void on_event(const toysequencer::TextEvent &event);
+  void on_command_dropped(uint64_t sid, uint64_t cseq);
 
   void send_command(const toysequencer::TextCommand &command, const uint64_t sender_id);
 
@@ -28,5 +30,6 @@ public:
 
 private:
   std::function<void(const std::string &)> log_;
+  SendBuffer send_buf_;
   uint64_t pong_instance_id_;
 };
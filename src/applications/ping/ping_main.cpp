@@ -1,4 +1,5 @@
 #include "../../utils/env_utils.hpp"
+#include "core/shm_metrics.hpp"
 #include "../../utils/instanceid_utils.hpp"
 #include "ping.hpp"
 #include <chrono>
@@ -13,6 +14,7 @@ static void handle_signal(int) { running.store(false); }
 int main() {
   try {
     EnvUtils::load_env();
+    ShmMetrics::init("ping");
 
     std::signal(SIGINT, handle_signal);
     std::signal(SIGTERM, handle_signal);
@@ -8,6 +8,9 @@ PongApp::PongApp(const std::string &cmd_multicast_address, const uint16_t cmd_po
       EventReceiver<PongApp>(get_instance_id(), events_multicast_address, events_port), log_(std::move(log)) {}
 
 void PongApp::on_event(const toysequencer::TextEvent &event) {
+  if (event.sid() == get_instance_id())
+    this->ack(event.cseq());
+
   if (event.tin() != get_instance_id())
     return;
 
@@ -22,10 +25,15 @@ void PongApp::on_event(const toysequencer::TextEvent &event) {
   log_("Pong sent PONG response to Ping");
 }
 
-void PongApp::send_command(const toysequencer::TextCommand &command, uint64_t sender_id) {
-  std::string bytes = command.SerializeAsString();
-  std::vector<uint8_t> data(bytes.begin(), bytes.end());
-  this->send_m(data);
+void PongApp::on_command_dropped(uint64_t sid, uint64_t cseq) {
+  if (sid == get_instance_id())
+    this->dropped(cseq);
+}
+
+void PongApp::send_command(const toysequencer::TextCommand &command, uint64_t /*sender_id*/) {
+  if (send_buf_.serialize(command)) {
+    this->send_numbered(send_buf_);
+  }
 }
 
 void PongApp::start() { EventReceiver<PongApp>::start(); }
@@ -1,4 +1,5 @@
 #include "../../utils/env_utils.hpp"
+#include "core/shm_metrics.hpp"
 #include "pong.hpp"
 #include <chrono>
 #include <csignal>
@@ -11,6 +12,7 @@ static void handle_signal(int) { running.store(false); }
 int main() {
   try {
     EnvUtils::load_env();
+    ShmMetrics::init("pong");
 
     std::signal(SIGINT, handle_signal);
     std::signal(SIGTERM, handle_signal);
@@ -1,4 +1,5 @@
 #include "scrappy.hpp"
+#include "core/async_logger.hpp"
 #include "utils/instanceid_utils.hpp"
 #include <iostream>
 
@@ -20,8 +21,8 @@ void ScrappyApp::on_event(const toysequencer::TextEvent &event) {
 }
 
 void ScrappyApp::on_event(const toysequencer::TopOfBookEvent &event) {
-  std::cout << "Scrappy: on_event(TopOfBookEvent) seq=" << event.seq() << " sid=" << event.sid()
-            << " tin=" << event.tin() << " symbol=" << event.symbol() << std::endl;
+  LOG_DEBUG("Scrappy: on_event(TopOfBookEvent) seq={} sid={} tin={} symbol={}", event.seq(), event.sid(), event.tin(),
+            event.symbol());
   if (output_file_.is_open()) {
     output_file_ << "#=" << event.seq() << "|" << "SID=" << event.sid() << "|"
                  << "TIN=" << event.tin() << "|" << "SYMBOL=" << event.symbol() << "|"
@@ -1,4 +1,5 @@
 #include "../../utils/env_utils.hpp"
+#include "core/shm_metrics.hpp"
 #include "messages.pb.h"
 #include "scrappy.hpp"
 #include <chrono>
@@ -13,6 +14,7 @@ static void handle_signal(int) { running.store(false); }
 int main(int argc, char **argv) {
   try {
     EnvUtils::load_env();
+    ShmMetrics::init("scrappy");
 
     std::signal(SIGINT, handle_signal);
     std::signal(SIGTERM, handle_signal);
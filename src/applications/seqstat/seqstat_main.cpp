@@ -0,0 +1,174 @@
+// Live view of a process's shared-memory metrics, in the spirit of vmstat.
+//
+//   seqstat                              list published segments
+//   seqstat <app|pid|path> [interval_s] [count]
+//
+// The segment is mapped PROT_READ, so watching a process never writes to the cache lines it updates.
+
+#include "core/shm_metrics.hpp"
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace {
+
+std::atomic<bool> running{true};
+void handle_signal(int) { running.store(false); }
+
+const char *kPrefix = "toyseq.";
+
+bool pid_alive(uint64_t pid) { return pid != 0 && (::kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM); }
+
+const shm_metrics::Layout *map_segment(const std::string &path) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+  void *addr = mmap(nullptr, sizeof(shm_metrics::Layout), PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (addr == MAP_FAILED) {
+    return nullptr;
+  }
+  const auto *layout = static_cast<const shm_metrics::Layout *>(addr);
+  if (layout->header.magic != shm_metrics::kMagic || layout->header.version != shm_metrics::kVersion) {
+    munmap(addr, sizeof(shm_metrics::Layout));
+    return nullptr;
+  }
+  return layout;
+}
+
+std::vector<std::string> list_segments() {
+  std::vector<std::string> names;
+  DIR *dir = opendir(shm_metrics::directory().c_str());
+  if (dir == nullptr) {
+    return names;
+  }
+  while (dirent *entry = readdir(dir)) {
+    if (std::strncmp(entry->d_name, kPrefix, std::strlen(kPrefix)) == 0) {
+      names.emplace_back(entry->d_name);
+    }
+  }
+  closedir(dir);
+  return names;
+}
+
+// An explicit path, or the segment whose app name or pid matches (the live one wins over stale files)
+std::string resolve(const std::string &target) {
+  if (target.find('/') != std::string::npos) {
+    return target;
+  }
+  std::string fallback;
+  for (const std::string &name : list_segments()) {
+    const std::string rest = name.substr(std::strlen(kPrefix));
+    const size_t dot = rest.rfind('.');
+    if (dot == std::string::npos) {
+      continue;
+    }
+    const std::string app = rest.substr(0, dot);
+    const std::string pid = rest.substr(dot + 1);
+    if (target != app && target != pid) {
+      continue;
+    }
+    const std::string path = shm_metrics::directory() + "/" + name;
+    if (pid_alive(std::strtoull(pid.c_str(), nullptr, 10))) {
+      return path;
+    }
+    fallback = path;
+  }
+  return fallback;
+}
+
+int list() {
+  const std::vector<std::string> names = list_segments();
+  if (names.empty()) {
+    std::cout << "no metric segments in " << shm_metrics::directory() << std::endl;
+    return 0;
+  }
+  std::printf("%-12s %8s %8s %7s  %s\n", "APP", "PID", "METRICS", "STATE", "PATH");
+  for (const std::string &name : names) {
+    const std::string path = shm_metrics::directory() + "/" + name;
+    const shm_metrics::Layout *layout = map_segment(path);
+    if (layout == nullptr) {
+      continue;
+    }
+    const shm_metrics::Header &h = layout->header;
+    std::printf("%-12s %8llu %8u %7s  %s\n", h.app, static_cast<unsigned long long>(h.pid),
+                h.count.load(std::memory_order_acquire), pid_alive(h.pid) ? "live" : "stale", path.c_str());
+    munmap(const_cast<shm_metrics::Layout *>(layout), sizeof(shm_metrics::Layout));
+  }
+  return 0;
+}
+
+int watch(const std::string &target, double interval_s, long count) {
+  const std::string path = resolve(target);
+  const shm_metrics::Layout *layout = path.empty() ? nullptr : map_segment(path);
+  if (layout == nullptr) {
+    std::cerr << "seqstat: no metric segment for '" << target << "' in " << shm_metrics::directory() << std::endl;
+    return 1;
+  }
+  const shm_metrics::Header &h = layout->header;
+  std::cout << h.app << " pid " << h.pid << " (" << path << ")" << std::endl;
+
+  std::vector<uint64_t> previous;
+  auto last = std::chrono::steady_clock::now();
+  for (long round = 0; running.load() && (count <= 0 || round < count); ++round) {
+    if (round > 0) {
+      std::this_thread::sleep_for(std::chrono::duration<double>(interval_s));
+    }
+    const auto now = std::chrono::steady_clock::now();
+    const double elapsed = std::chrono::duration<double>(now - last).count();
+    last = now;
+
+    const uint32_t n = h.count.load(std::memory_order_acquire);
+    previous.resize(n, 0);
+    std::printf("%-56s %16s %14s\n", "METRIC", "VALUE", "RATE/S");
+    for (uint32_t i = 0; i < n; ++i) {
+      const shm_metrics::Descriptor &d = layout->descriptors[i];
+      const uint64_t value = layout->slots[i].value.load(std::memory_order_relaxed);
+      if (d.kind == shm_metrics::Kind::Counter && round > 0) {
+        std::printf("%-56.*s %16llu %14.0f\n", static_cast<int>(shm_metrics::kNameBytes), d.name,
+                    static_cast<unsigned long long>(value), (value - previous[i]) / elapsed);
+      } else {
+        std::printf("%-56.*s %16llu %14s\n", static_cast<int>(shm_metrics::kNameBytes), d.name,
+                    static_cast<unsigned long long>(value), "-");
+      }
+      previous[i] = value;
+    }
+    if (!pid_alive(h.pid)) {
+      std::cout << "(process " << h.pid << " has exited)" << std::endl;
+      break;
+    }
+    std::cout << std::endl;
+  }
+  munmap(const_cast<shm_metrics::Layout *>(layout), sizeof(shm_metrics::Layout));
+  return 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::signal(SIGINT, handle_signal);
+  std::signal(SIGTERM, handle_signal);
+
+  if (argc < 2) {
+    return list();
+  }
+  const double interval_s = argc > 2 ? std::strtod(argv[2], nullptr) : 1.0;
+  const long count = argc > 3 ? std::strtol(argv[3], nullptr, 10) : 0;
+  return watch(argv[1], interval_s > 0 ? interval_s : 1.0, count);
+}
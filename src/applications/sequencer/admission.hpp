@@ -0,0 +1,135 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <unordered_map>
+
+// Per-sender (sid) admission control for the sequence stage: a token bucket per sid rejects commands beyond
+// its rate, and deficit round-robin orders what is left of each batch across sids so one busy sender cannot
+// push everyone else's commands to the back.
+struct AdmissionConfig {
+  struct Limit {
+    double rate = 0;  // commands per second; 0 is unlimited
+    double burst = 0; // bucket size; 0 means one second's worth, and never less than one command
+  };
+
+  Limit default_limit;
+  std::unordered_map<uint64_t, Limit> limits; // per-sid overrides
+  bool fair = false;
+  size_t quantum_bytes = 256; // DRR credit per sid per round
+  // Bounds on per-sid state: at most max_sids buckets (sids with a limit of their own always get one), dropped
+  // once idle for idle_ms, and metrics of their own for the first metric_sids; everyone else shares one
+  // default bucket and one set of "sid other" metrics
+  size_t max_sids = 1024;
+  uint64_t idle_ms = 60000;
+  size_t metric_sids = 16;
+
+  bool enabled() const { return fair || default_limit.rate > 0 || !limits.empty(); }
+
+  Limit limit_for(uint64_t sid) const {
+    auto it = limits.find(sid);
+    return it == limits.end() ? default_limit : it->second;
+  }
+
+  // SEQ_SID_RATE / SEQ_SID_BURST for every sid, SEQ_SID_LIMITS="sid:rate[:burst],..." per sid, SEQ_FAIR=1 for
+  // deficit round-robin with SEQ_DRR_QUANTUM bytes per round; SEQ_MAX_SIDS, SEQ_SID_IDLE_MS and
+  // SEQ_SID_METRICS bound the per-sid state
+  static AdmissionConfig from_env() {
+    AdmissionConfig config;
+    if (const char *rate = std::getenv("SEQ_SID_RATE")) {
+      config.default_limit.rate = std::strtod(rate, nullptr);
+    }
+    if (const char *burst = std::getenv("SEQ_SID_BURST")) {
+      config.default_limit.burst = std::strtod(burst, nullptr);
+    }
+    if (const char *limits = std::getenv("SEQ_SID_LIMITS")) {
+      config.limits = parse_limits(limits);
+    }
+    if (const char *fair = std::getenv("SEQ_FAIR")) {
+      config.fair = fair[0] == '1';
+    }
+    if (const char *quantum = std::getenv("SEQ_DRR_QUANTUM")) {
+      long n = std::strtol(quantum, nullptr, 10);
+      if (n > 0) {
+        config.quantum_bytes = static_cast<size_t>(n);
+      }
+    }
+    if (const char *max_sids = std::getenv("SEQ_MAX_SIDS")) {
+      long n = std::strtol(max_sids, nullptr, 10);
+      if (n > 0) {
+        config.max_sids = static_cast<size_t>(n);
+      }
+    }
+    if (const char *idle = std::getenv("SEQ_SID_IDLE_MS")) {
+      long n = std::strtol(idle, nullptr, 10);
+      if (n > 0) {
+        config.idle_ms = static_cast<uint64_t>(n);
+      }
+    }
+    if (const char *metric_sids = std::getenv("SEQ_SID_METRICS")) {
+      long n = std::strtol(metric_sids, nullptr, 10);
+      if (n >= 0) {
+        config.metric_sids = static_cast<size_t>(n);
+      }
+    }
+    return config;
+  }
+
+  static std::unordered_map<uint64_t, Limit> parse_limits(const std::string &list) {
+    std::unordered_map<uint64_t, Limit> limits;
+    size_t begin = 0;
+    while (begin < list.size()) {
+      size_t end = list.find(',', begin);
+      if (end == std::string::npos) {
+        end = list.size();
+      }
+      const std::string item = list.substr(begin, end - begin);
+      char *p = nullptr;
+      const uint64_t sid = std::strtoull(item.c_str(), &p, 10);
+      if (p != item.c_str() && *p == ':') {
+        Limit limit;
+        limit.rate = std::strtod(p + 1, &p);
+        if (*p == ':') {
+          limit.burst = std::strtod(p + 1, nullptr);
+        }
+        limits[sid] = limit;
+      }
+      begin = end + 1;
+    }
+    return limits;
+  }
+};
+
+class TokenBucket {
+public:
+  TokenBucket() = default;
+  // A bucket holds at least one token, or a fractional rate with no burst could never admit anything
+  TokenBucket(double rate, double burst)
+      : rate_(rate), burst_(std::max(1.0, burst > 0 ? burst : rate)), tokens_(burst_) {}
+
+  // Takes one token, refilling for the time since the last call; always true when unlimited
+  bool take(uint64_t now_ns) {
+    if (rate_ <= 0) {
+      return true;
+    }
+    if (last_ns_ != 0 && now_ns > last_ns_) {
+      tokens_ += rate_ * static_cast<double>(now_ns - last_ns_) * 1e-9;
+      tokens_ = tokens_ > burst_ ? burst_ : tokens_;
+    }
+    last_ns_ = now_ns;
+    if (tokens_ < 1.0) {
+      return false;
+    }
+    tokens_ -= 1.0;
+    return true;
+  }
+
+private:
+  double rate_ = 0;
+  double burst_ = 0;
+  double tokens_ = 0;
+  uint64_t last_ns_ = 0;
+};
@@ -2,14 +2,28 @@
 
 #include "../adapters.hpp"
 #include "../application.hpp"
+#include "core/async_logger.hpp"
+#include "core/client_seq.hpp"
 #include "core/command_receiver.hpp"
 #include "core/event_sender.hpp"
+#include "core/journal.hpp"
+#include "core/latency_histogram.hpp"
+#include "core/passthrough.hpp"
+#include "core/retransmission.hpp"
+#include "core/send_buffer.hpp"
+#include "core/sequence_ring.hpp"
+#include "core/shm_metrics.hpp"
+#include "core/wire_peek.hpp"
 #include "generated/messages.pb.h"
+#include "sequencer_pipeline.hpp"
 #include "utils/instanceid_utils.hpp"
 #include <atomic>
 #include <chrono>
 #include <cstdint>
-#include <iostream>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 class SequencerT : public Application, public IEventSender<SequencerT>, public CommandReceiver<SequencerT> {
@@ -17,54 +31,766 @@ public:
   SequencerT(const std::string &cmd_multicast_address, const uint16_t cmd_port,
              const std::string &events_multicast_address, const uint16_t events_port, const uint8_t ttl)
       : IEventSender<SequencerT>(events_multicast_address, events_port, ttl),
-        CommandReceiver<SequencerT>(cmd_multicast_address, cmd_port) {}
+        CommandReceiver<SequencerT>(cmd_multicast_address, cmd_port), ttl_(ttl),
+        seq_high_water_(ShmMetrics::instance().gauge("sequencer seq high water")),
+        duplicate_commands_(ShmMetrics::instance().counter("sequencer duplicate commands")),
+        stale_commands_(ShmMetrics::instance().counter("sequencer stale commands")),
+        drop_notices_(ShmMetrics::instance().counter("sequencer drop notices")) {
+    // The receive batch has drained the socket, so anything lingering in the send batch goes out now
+    flush_subscription_ = this->subscribe_batch([this](const Datagram *, size_t) { this->flush(); });
+  }
 
-  virtual ~SequencerT() = default;
+  virtual ~SequencerT() {
+    // The receive threads and pipeline stages use members that are about to go
+    stop_receivers();
+    stop_pipeline();
+  }
 
   void on_command(const toysequencer::TextCommand &cmd) {
-    std::cout << "Sequencer received TextCommand: " << cmd.DebugString() << std::endl;
+    LOG_DEBUG("Sequencer received TextCommand sid={} tin={} text={}", cmd.sid(), cmd.tin(), cmd.text());
+    if (!admit_cseq(cmd.sid(), cmd.sender_epoch(), cmd.cseq())) {
+      return;
+    }
 
+    const uint64_t start_ns = latency::enabled() ? latency::now_ns() : 0;
     uint64_t seq = next_seq_.fetch_add(1);
-    uint64_t ts = std::chrono::duration_cast<std::chrono::microseconds>(
-                      std::chrono::high_resolution_clock::now().time_since_epoch())
-                      .count();
+    uint64_t ts = now_micros();
 
-    this->send(text_adapter.make_event(cmd, seq, cmd.sid(), ts));
+    text_adapter.fill_event(cmd, seq, cmd.sid(), ts, text_event_);
+    text_event_.set_epoch(epoch_);
+    if (start_ns != 0) {
+      sequence_latency_.record_since(start_ns);
+    }
+    this->send(text_event_);
   }
 
   void on_command(const toysequencer::TopOfBookCommand &cmd) {
-    std::cout << "Sequencer received TopOfBookCommand: " << cmd.DebugString() << std::endl;
+    LOG_DEBUG("Sequencer received TopOfBookCommand sid={} tin={} symbol={} bid={}x{} ask={}x{}", cmd.sid(), cmd.tin(),
+              cmd.symbol(), cmd.bid_price(), cmd.bid_size(), cmd.ask_price(), cmd.ask_size());
+    if (!admit_cseq(cmd.sid(), cmd.sender_epoch(), cmd.cseq())) {
+      return;
+    }
 
+    const uint64_t start_ns = latency::enabled() ? latency::now_ns() : 0;
     uint64_t seq = next_seq_.fetch_add(1);
-    uint64_t ts = std::chrono::duration_cast<std::chrono::microseconds>(
-                      std::chrono::high_resolution_clock::now().time_since_epoch())
-                      .count();
+    uint64_t ts = now_micros();
+
+    tob_adapter.fill_event(cmd, seq, cmd.sid(), ts, tob_event_);
+    tob_event_.set_epoch(epoch_);
+    if (start_ns != 0) {
+      sequence_latency_.record_since(start_ns);
+    }
+    this->send(tob_event_);
+  }
+
+  // Pass-through mode: stamp the original command bytes with a binary header, no parse and no re-serialize
+  void on_raw_command(toysequencer::MessageType msg_type, const uint8_t *data, size_t len) {
+    constexpr uint32_t kSidField = 2; // TextCommand.sid and TopOfBookCommand.sid
+    uint64_t sid = 0;
+    uint64_t epoch = 0;
+    uint64_t cseq = 0;
+    if (wire::find_varint_field(data, len, client_seq::kField, cseq)) {
+      wire::find_varint_field(data, len, kSidField, sid);
+      wire::find_varint_field(data, len, client_seq::kEpochField, epoch);
+      if (!admit_cseq(sid, epoch, cseq)) {
+        return;
+      }
+    }
+    const bool timed = latency::enabled();
+    const uint64_t start_ns = timed ? latency::now_ns() : 0;
+    passthrough::Header header;
+    header.msg_type = static_cast<uint16_t>(event_type_for(msg_type));
+    header.payload_len = static_cast<uint32_t>(len);
+    header.seq = next_seq_.fetch_add(1);
+    header.timestamp = now_micros();
+    header.epoch = epoch_;
+    const uint64_t stamped_ns = timed ? latency::now_ns() : 0;
+    if (timed) {
+      sequence_latency_.record(stamped_ns - start_ns);
+    }
 
-    this->send(tob_adapter.make_event(cmd, seq, cmd.sid(), ts));
+    uint8_t *frame = out_->prepare(passthrough::kHeaderSize + len);
+    if (frame == nullptr) {
+      LOG_ERROR("Sequencer dropped oversized pass-through command seq={}", header.seq);
+      return;
+    }
+    passthrough::write_header(frame, header);
+    std::memcpy(frame + passthrough::kHeaderSize, data, len);
+    if (timed) {
+      serialize_latency_.record_since(stamped_ns);
+    }
+    publish(header.seq, frame, out_->size());
   }
 
+  // Serializes straight into the reusable send buffer (or the pipeline entry); nothing is allocated per event
   template <typename EventT> void send_event(const EventT &event) {
-    std::vector<uint8_t> data = serialize_event(event);
-    this->send_m(data);
+    const uint64_t start_ns = latency::enabled() ? latency::now_ns() : 0;
+    if (!out_->serialize(event)) {
+      LOG_ERROR("Sequencer dropped oversized event seq={}", event.seq());
+      return;
+    }
+    if (start_ns != 0) {
+      serialize_latency_.record_since(start_ns);
+    }
+    publish(event.seq(), out_->data(), out_->size());
+  }
+
+  // Opens (or recovers) the journal and continues numbering after its last record. Call before start().
+  uint64_t enable_journal(const JournalConfig &config) {
+    journal_ = std::make_unique<Journal>(config);
+    next_seq_.store(journal_->last_seq() + 1);
+    return journal_->last_seq();
+  }
+
+  const Journal *get_journal() const { return journal_.get(); }
+
+  // Keeps the last `capacity` events for NACK-driven retransmission, each with room for the largest event the
+  // sequencer publishes. Call before start().
+  void enable_retransmission(const std::string &nack_address, uint16_t nack_port, size_t capacity) {
+    retransmission_ = std::make_unique<RetransmissionService>(
+        nack_address, nack_port, IEventSender<SequencerT>::get_address(), IEventSender<SequencerT>::get_port(), ttl_,
+        capacity, PipelineEntry::kEventBytes);
+  }
+
+  const RetransmissionService *get_retransmission() const { return retransmission_.get(); }
+
+  // Moves parsing, sequencing, journaling and publishing off the receive thread onto one thread per stage,
+  // connected by a pre-allocated SequenceRing. Each extra ingress group in `config` gets its own receive thread
+  // claiming entries on the same ring, so the single sequence stage assigns seqs across all groups in one total
+  // order. Call before start(); the journal stage runs if a journal is enabled when start() is called.
+  void enable_pipeline(const PipelineConfig &config) {
+    pipeline_config_ = config;
+    const ProducerMode mode = config.ingress.empty() ? ProducerMode::Single : ProducerMode::Multi;
+    ring_ = std::make_unique<SequenceRing<PipelineEntry>>(config.ring_size, mode);
+    ring_->add_gating_sequence(&published_);
+    ring_depth_ = ShmMetrics::instance().gauge("sequencer pipeline ring depth");
+    order_.reserve(ring_->capacity());
+    admission_ = config.admission.enabled();
+    if (admission_) {
+      const AdmissionConfig::Limit limit = config.admission.default_limit;
+      shared_sender_.bucket = TokenBucket(limit.rate, limit.burst);
+      shared_sender_.metrics = make_sender_metrics("sid other ");
+    }
+    if (config.lanes) {
+      symbols_ = std::make_unique<SymbolSet>(ring_->capacity());
+      conflated_quotes_ = ShmMetrics::instance().counter("sequencer conflated quotes");
+    }
+
+    add_ingress(MulticastReceiver::get_address(), MulticastReceiver::get_port(), nullptr);
+    for (const PipelineConfig::Ingress &group : config.ingress) {
+      auto receiver = std::make_unique<MulticastReceiver>(group.address, group.port);
+      const size_t index = ingress_.size();
+      receiver->subscribe([this, index](const uint8_t *data, size_t len) { this->ingest(index, data, len); });
+      add_ingress(group.address, group.port, std::move(receiver));
+    }
+
+    // The publish stage flushes the send batch itself
+    this->unsubscribe(flush_subscription_);
+    this->redirect_datagrams([this](const uint8_t *data, size_t len) { this->ingest(0, data, len); });
+    this->set_cpu(config.cpu_for(PipelineConfig::ReceiveStage));
   }
 
-  void start() override { CommandReceiver<SequencerT>::start(); }
+  bool pipeline_enabled() const { return ring_ != nullptr; }
+  const SequenceRing<PipelineEntry> *get_pipeline_ring() const { return ring_.get(); }
+  size_t get_ingress_count() const { return ingress_.size(); }
+
+  // Receive stage: copies the datagram into the next ring entry and hands it to the sequence stage. Ingress 0
+  // is the sequencer's own command group; each ingress must be fed from a single thread.
+  void ingest(size_t ingress, const uint8_t *data, size_t len) {
+    Ingress &in = ingress_[ingress];
+    if (len > PipelineEntry::kPayloadBytes) {
+      in.oversized_drops.add();
+      LOG_ERROR("Sequencer pipeline dropped oversized command len={}", len);
+      return;
+    }
+    bool waited = false;
+    const uint64_t slot = ring_->claim(pipeline_running_, &waited);
+    if (slot == SequenceRing<PipelineEntry>::kNoEntry) {
+      return;
+    }
+    if (waited) {
+      in.full_waits.add();
+    }
+    PipelineEntry &entry = (*ring_)[slot];
+    std::memcpy(entry.command, data, len);
+    entry.len = static_cast<uint32_t>(len);
+    entry.ingress = static_cast<uint32_t>(ingress);
+    entry.ingest_ns = latency::enabled() ? latency::now_ns() : 0;
+    in.commands.add();
+    ring_->publish(slot);
+  }
+
+  void ingest(const uint8_t *data, size_t len) { ingest(0, data, len); }
+
+  // Highest seq handed out so far; 0 before the first event
+  uint64_t get_last_seq() const { return next_seq_.load() - 1; }
+
+  // Ring entries the publish stage has finished with
+  uint64_t get_pipeline_published() const { return published_.get(); }
+
+  // Stage histograms (LATENCY_STATS=1); recv, parse and send live in the receiver and sender bases
+  const LatencyHistogram &get_sequence_latency() const { return sequence_latency_; }
+  const LatencyHistogram &get_serialize_latency() const { return serialize_latency_; }
+  // Pipeline only: receive stage publishing an entry to the sequence stage picking it up
+  const LatencyHistogram &get_queue_latency() const { return queue_latency_; }
+
+  void start() override {
+    if (retransmission_) {
+      retransmission_->start();
+    }
+    if (ring_ && !pipeline_running_.exchange(true)) {
+      sequence_thread_ = std::thread([this] { this->run_sequence_stage(); });
+      if (journal_) {
+        journal_thread_ = std::thread([this] { this->run_journal_stage(); });
+      }
+      publish_thread_ = std::thread([this] { this->run_publish_stage(); });
+    }
+    CommandReceiver<SequencerT>::start();
+    for (Ingress &in : ingress_) {
+      if (in.receiver) {
+        in.receiver->start();
+      }
+    }
+  }
 
-  void stop() override { CommandReceiver<SequencerT>::stop(); }
+  void stop() override {
+    stop_receivers();
+    stop_pipeline();
+    if (retransmission_) {
+      retransmission_->stop();
+    }
+  }
 
   uint64_t get_instance_id() const override { return InstanceIdUtils::get_instance_id("SEQ"); }
 
 private:
-  template <typename EventT> std::vector<uint8_t> serialize_event(const EventT &event) {
-    std::vector<uint8_t> payload(event.ByteSizeLong());
-    event.SerializeToArray(payload.data(), static_cast<int>(payload.size()));
-    return payload;
+  // Drops a command whose (sid, sender epoch, cseq) was already sequenced: a sender retransmitting before it saw
+  // the ack, or the network duplicating a datagram. Runs on the thread that assigns seqs.
+  bool admit_cseq(uint64_t sid, uint64_t epoch, uint64_t cseq) {
+    switch (client_seqs_.check(sid, epoch, cseq)) {
+    case ClientSeqTable::Verdict::Accept:
+      return true;
+    case ClientSeqTable::Verdict::Duplicate:
+      duplicate_commands_.add();
+      LOG_DEBUG("Sequencer dropped duplicate command sid={} cseq={}", sid, cseq);
+      notify_drop(sid, cseq, client_seq::DropReason::Duplicate);
+      return false;
+    case ClientSeqTable::Verdict::Stale:
+      stale_commands_.add();
+      LOG_WARN("Sequencer dropped command sid={} cseq={} below its duplicate window", sid, cseq);
+      notify_drop(sid, cseq, client_seq::DropReason::Stale);
+      return false;
+    }
+    return false;
+  }
+
+  // Answers a numbered command that produces no event, so its sender stops retransmitting it. In the pipeline
+  // the notice waits in the entry for the publish stage, which sends it in ring order.
+  void notify_drop(uint64_t sid, uint64_t cseq, client_seq::DropReason reason) {
+    if (cseq == 0) {
+      return;
+    }
+    if (stage_entry_ != nullptr) {
+      stage_entry_->drop = reason;
+      stage_entry_->cseq = cseq;
+      stage_entry_->sid = sid;
+      return;
+    }
+    send_drop(sid, cseq, reason);
+  }
+
+  // Pipeline: conflated and rejected entries never reach dispatch, so their notice is set up here
+  void mark_dropped(PipelineEntry &entry, client_seq::DropReason reason) {
+    constexpr uint32_t kSidField = 2; // TextCommand.sid and TopOfBookCommand.sid
+    uint64_t cseq = 0;
+    if (wire::find_varint_field(entry.command, entry.len, client_seq::kField, cseq) && cseq != 0) {
+      wire::find_varint_field(entry.command, entry.len, kSidField, entry.sid);
+      entry.drop = reason;
+      entry.cseq = cseq;
+    }
+  }
+
+  // Unsequenced, so it is neither journaled nor kept for retransmission
+  void send_drop(uint64_t sid, uint64_t cseq, client_seq::DropReason reason) {
+    uint8_t buf[client_seq::kDropSize];
+    client_seq::encode_drop(sid, cseq, reason, buf);
+    drop_notices_.add();
+    if (this->batching_enabled()) {
+      this->enqueue(buf, sizeof(buf));
+    } else {
+      this->send_m(buf, sizeof(buf));
+    }
+  }
+
+  // Journal first (write-ahead), then multicast. In the pipeline the event already sits in its ring entry and
+  // the journal and publish stages take it from there.
+  void publish(uint64_t seq, const uint8_t *data, size_t len) {
+    if (stage_entry_ != nullptr) {
+      stage_entry_->seq = seq;
+      return;
+    }
+    if (journal_) {
+      journal_event(seq, data, len);
+    }
+    emit(seq, data, len);
+  }
+
+  void journal_event(uint64_t seq, const uint8_t *data, size_t len) {
+    if (!journal_->append(seq, data, len)) {
+      LOG_ERROR("Sequencer failed to journal seq={}", seq);
+    }
+  }
+
+  void emit(uint64_t seq, const uint8_t *data, size_t len) {
+    seq_high_water_.set(seq);
+    if (retransmission_) {
+      retransmission_->store(seq, data, len);
+    }
+    if (this->batching_enabled()) {
+      this->enqueue(data, len);
+    } else {
+      this->send_m(data, len);
+    }
+  }
+
+  // Parses, sequences and serializes each entry in place, then releases the batch to the journal stage
+  void run_sequence_stage() {
+    pin_stage(PipelineConfig::SequenceStage);
+    uint64_t next = 0;
+    for (;;) {
+      const uint64_t available = ring_->wait_for(next, pipeline_running_);
+      if (available == next) {
+        return;
+      }
+      emit_pos_ = next;
+      if (symbols_ || admission_) {
+        schedule_batch(next, available);
+      } else {
+        for (uint64_t pos = next; pos < available; ++pos) {
+          take_entry(pos);
+          sequence_entry(pos);
+        }
+      }
+      for (uint64_t pos = emit_pos_; pos < available; ++pos) {
+        (*ring_)[pos].emit = PipelineEntry::kNoEvent;
+      }
+      next = available;
+      stage_entry_ = nullptr;
+      out_ = &send_buf_;
+      ParseArena::local().reset();
+      for (Ingress &in : ingress_) {
+        in.depth.set(in.commands.get() - in.sequenced);
+      }
+      sequenced_.set(next);
+    }
+  }
+
+  // Decides which entries of a batch get sequenced and in what order: per-sid token buckets reject commands
+  // over their sender's rate, quotes are conflated (lanes), the priority lane goes ahead of the quotes, and
+  // each lane runs in arrival order or, with fair queueing, deficit round-robin across sids
+  void schedule_batch(uint64_t begin, uint64_t end) {
+    constexpr uint32_t kSidField = 2; // TextCommand.sid and TopOfBookCommand.sid
+    const uint64_t now_ns = admission_ ? latency::now_ns() : 0;
+    for (uint64_t pos = begin; pos < end; ++pos) {
+      PipelineEntry &entry = take_entry(pos);
+      uint64_t msg_type = 0;
+      entry.quote = symbols_ && peek_msg_type(entry.command, entry.len, msg_type) &&
+                    msg_type == toysequencer::TOB_COMMAND;
+      entry.conflated = false;
+      entry.rejected = false;
+      if (admission_) {
+        entry.sid = 0;
+        wire::find_varint_field(entry.command, entry.len, kSidField, entry.sid);
+        Sender &sender = sender_for(entry.sid, now_ns);
+        if (sender.bucket.take(now_ns)) {
+          sender.metrics.admitted.add();
+        } else {
+          entry.rejected = true;
+          sender.metrics.rejected.add();
+          mark_dropped(entry, client_seq::DropReason::Rejected);
+        }
+      }
+    }
+
+    if (symbols_ && end - begin > pipeline_config_.conflate_depth) {
+      conflate(begin, end);
+    }
+
+    order_.clear();
+    append_lane(begin, end, false);
+    if (symbols_) {
+      append_lane(begin, end, true);
+    }
+    for (uint64_t pos : order_) {
+      sequence_entry(pos);
+    }
+  }
+
+  // Keeps only the newest admitted quote per symbol in the batch
+  void conflate(uint64_t begin, uint64_t end) {
+    constexpr uint32_t kQuoteSymbolField = 4; // TopOfBookCommand.symbol
+    symbols_->clear();
+    uint64_t conflated = 0;
+    for (uint64_t pos = end; pos-- > begin;) {
+      PipelineEntry &entry = (*ring_)[pos];
+      const uint8_t *symbol = nullptr;
+      size_t symbol_len = 0;
+      if (entry.quote && !entry.rejected &&
+          wire::find_bytes_field(entry.command, entry.len, kQuoteSymbolField, symbol, symbol_len) &&
+          !symbols_->insert(std::string_view(reinterpret_cast<const char *>(symbol), symbol_len))) {
+        entry.conflated = true;
+        conflated++;
+        mark_dropped(entry, client_seq::DropReason::Conflated);
+      }
+    }
+    if (conflated > 0) {
+      conflated_quotes_.add(conflated);
+    }
+  }
+
+  static bool in_lane(const PipelineEntry &entry, bool quotes) {
+    return entry.quote == quotes && !entry.conflated && !entry.rejected;
+  }
+
+  void append_lane(uint64_t begin, uint64_t end, bool quotes) {
+    if (admission_ && pipeline_config_.admission.fair) {
+      append_fair(begin, end, quotes);
+      return;
+    }
+    for (uint64_t pos = begin; pos < end; ++pos) {
+      if (in_lane((*ring_)[pos], quotes)) {
+        order_.push_back(pos);
+      }
+    }
+  }
+
+  // Deficit round-robin over the lane's senders, with each command costing its size in bytes. A command that
+  // goes out after one which arrived later counts as delayed for its sender.
+  void append_fair(uint64_t begin, uint64_t end, bool quotes) {
+    active_.clear();
+    for (uint64_t pos = begin; pos < end; ++pos) {
+      PipelineEntry &entry = (*ring_)[pos];
+      if (!in_lane(entry, quotes)) {
+        continue;
+      }
+      entry.next_in_sid = PipelineEntry::kNoEvent;
+      Sender &sender = tracked_sender(entry.sid);
+      if (sender.head == PipelineEntry::kNoEvent) {
+        sender.head = pos;
+        sender.deficit = 0;
+        active_.push_back(&sender);
+      } else {
+        (*ring_)[sender.tail].next_in_sid = pos;
+      }
+      sender.tail = pos;
+    }
+
+    const size_t quantum = pipeline_config_.admission.quantum_bytes;
+    uint64_t latest = begin;
+    size_t remaining = active_.size();
+    while (remaining > 0) {
+      for (Sender *sender : active_) {
+        if (sender->head == PipelineEntry::kNoEvent) {
+          continue;
+        }
+        sender->deficit += quantum;
+        while (sender->head != PipelineEntry::kNoEvent && (*ring_)[sender->head].len <= sender->deficit) {
+          const uint64_t pos = sender->head;
+          sender->deficit -= (*ring_)[pos].len;
+          sender->head = (*ring_)[pos].next_in_sid;
+          if (pos < latest) {
+            sender->metrics.delayed.add();
+          }
+          latest = pos > latest ? pos : latest;
+          order_.push_back(pos);
+        }
+        if (sender->head == PipelineEntry::kNoEvent) {
+          sender->deficit = 0;
+          remaining--;
+        }
+      }
+    }
+  }
+
+  struct Sender;
+  struct SenderMetrics;
+
+  // The sid's bucket, created on its first command. Once max_sids are tracked, idle ones are swept out (at most
+  // once a second); if none are, a new sid shares the default bucket unless it has a limit of its own.
+  Sender &sender_for(uint64_t sid, uint64_t now_ns) {
+    auto it = senders_.find(sid);
+    if (it != senders_.end()) {
+      it->second.last_ns = now_ns;
+      return it->second;
+    }
+    const AdmissionConfig &admission = pipeline_config_.admission;
+    const bool own_limit = admission.limits.count(sid) != 0;
+    if (senders_.size() >= admission.max_sids && !own_limit && !evict_idle_senders(now_ns)) {
+      return shared_sender_;
+    }
+    // The only allocation on this path
+    const AdmissionConfig::Limit limit = admission.limit_for(sid);
+    Sender sender;
+    sender.bucket = TokenBucket(limit.rate, limit.burst);
+    sender.metrics = metrics_for(sid);
+    sender.last_ns = now_ns;
+    return senders_.emplace(sid, sender).first->second;
+  }
+
+  // The bucket sender_for() settled on for a sid earlier in the batch
+  Sender &tracked_sender(uint64_t sid) {
+    auto it = senders_.find(sid);
+    return it != senders_.end() ? it->second : shared_sender_;
+  }
+
+  // True if it freed room. Every sid in the batch so far was touched just now, so none of them goes.
+  bool evict_idle_senders(uint64_t now_ns) {
+    constexpr uint64_t kSweepIntervalNs = 1000000000;
+    if (now_ns < next_sweep_ns_) {
+      return false;
+    }
+    next_sweep_ns_ = now_ns + kSweepIntervalNs;
+    const uint64_t idle_ns = pipeline_config_.admission.idle_ms * 1000000;
+    const size_t before = senders_.size();
+    for (auto it = senders_.begin(); it != senders_.end();) {
+      if (now_ns - it->second.last_ns >= idle_ns) {
+        it = senders_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    return senders_.size() < before;
+  }
+
+  // Metric names outlive eviction (the segment has room for few), so a sid keeps its metrics across evictions
+  // and only the first metric_sids sids get any of their own
+  SenderMetrics metrics_for(uint64_t sid) {
+    auto it = sid_metrics_.find(sid);
+    if (it != sid_metrics_.end()) {
+      return it->second;
+    }
+    if (sid_metrics_.size() >= pipeline_config_.admission.metric_sids) {
+      return shared_sender_.metrics;
+    }
+    return sid_metrics_.emplace(sid, make_sender_metrics("sid " + std::to_string(sid) + " ")).first->second;
+  }
+
+  static SenderMetrics make_sender_metrics(const std::string &prefix) {
+    ShmMetrics &metrics = ShmMetrics::instance();
+    SenderMetrics sender;
+    sender.admitted = metrics.counter(prefix + "admitted");
+    sender.rejected = metrics.counter(prefix + "rejected");
+    sender.delayed = metrics.counter(prefix + "delayed");
+    return sender;
+  }
+
+  PipelineEntry &take_entry(uint64_t pos) {
+    PipelineEntry &entry = (*ring_)[pos];
+    if (entry.ingest_ns != 0) {
+      queue_latency_.record_since(entry.ingest_ns);
+    }
+    ingress_[entry.ingress].sequenced++;
+    entry.seq = 0;
+    entry.drop = client_seq::DropReason::None;
+    return entry;
+  }
+
+  // Sequences one entry in place and, if it produced an event, appends it to the batch's emit order
+  void sequence_entry(uint64_t pos) {
+    PipelineEntry &entry = (*ring_)[pos];
+    stage_entry_ = &entry;
+    out_ = &entry.event;
+    this->dispatch_datagram(entry.command, entry.len);
+    if (entry.seq != 0) {
+      (*ring_)[emit_pos_++].emit = pos;
+    }
+  }
+
+  // The entry whose event goes out at ring position `pos`, or nullptr
+  PipelineEntry *emitted_at(uint64_t pos) {
+    const uint64_t slot = (*ring_)[pos].emit;
+    return slot == PipelineEntry::kNoEvent ? nullptr : &(*ring_)[slot];
+  }
+
+  void run_journal_stage() {
+    pin_stage(PipelineConfig::JournalStage);
+    SequenceBarrier barrier({&sequenced_});
+    uint64_t next = 0;
+    for (;;) {
+      const uint64_t available = barrier.wait_for(next, pipeline_running_);
+      if (available == next) {
+        return;
+      }
+      for (; next < available; ++next) {
+        if (const PipelineEntry *entry = emitted_at(next)) {
+          journal_event(entry->seq, entry->event.data(), entry->event.size());
+        }
+      }
+      journaled_.set(next);
+    }
+  }
+
+  // Sends every available event and drop notice, flushes the send batch once the barrier runs dry, then frees
+  // the entries
+  void run_publish_stage() {
+    pin_stage(PipelineConfig::PublishStage);
+    SequenceBarrier barrier({journal_ ? &journaled_ : &sequenced_});
+    uint64_t next = 0;
+    for (;;) {
+      const uint64_t available = barrier.wait_for(next, pipeline_running_);
+      if (available == next) {
+        return;
+      }
+      for (; next < available; ++next) {
+        if (const PipelineEntry *entry = emitted_at(next)) {
+          emit(entry->seq, entry->event.data(), entry->event.size());
+        }
+        const PipelineEntry &at = (*ring_)[next];
+        if (at.drop != client_seq::DropReason::None) {
+          send_drop(at.sid, at.cseq, at.drop);
+        }
+      }
+      this->flush();
+      published_.set(next);
+      ring_depth_.set(ring_->depth());
+    }
+  }
+
+  void pin_stage(PipelineConfig::Stage stage) {
+    const int cpu = pipeline_config_.cpu_for(stage);
+    if (cpu >= 0 && !ThreadUtils::pin_current_thread(cpu)) {
+      LOG_WARN("Sequencer could not pin pipeline stage {} to cpu {}", static_cast<int>(stage), cpu);
+    }
+  }
+
+  void add_ingress(const std::string &address, uint16_t port, std::unique_ptr<MulticastReceiver> receiver) {
+    ShmMetrics &metrics = ShmMetrics::instance();
+    Ingress in;
+    in.receiver = std::move(receiver);
+    in.commands = metrics.counter(endpoint_metric("ingress", address, port, "commands"));
+    in.full_waits = metrics.counter(endpoint_metric("ingress", address, port, "ring full waits"));
+    in.oversized_drops = metrics.counter(endpoint_metric("ingress", address, port, "oversized drops"));
+    in.depth = metrics.gauge(endpoint_metric("ingress", address, port, "depth"));
+    ingress_.push_back(std::move(in));
+  }
+
+  void stop_receivers() {
+    CommandReceiver<SequencerT>::stop();
+    for (Ingress &in : ingress_) {
+      if (in.receiver) {
+        in.receiver->stop();
+      }
+    }
+  }
+
+  // The receive threads have stopped by now; let the stages drain what they already published
+  void stop_pipeline() {
+    if (!pipeline_running_.load()) {
+      return;
+    }
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (ring_->depth() > 0 && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    pipeline_running_.store(false);
+    for (std::thread *t : {&sequence_thread_, &journal_thread_, &publish_thread_}) {
+      if (t->joinable()) {
+        t->join();
+      }
+    }
+  }
+
+  static uint64_t now_micros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::high_resolution_clock::now().time_since_epoch())
+        .count();
+  }
+
+  static toysequencer::MessageType event_type_for(toysequencer::MessageType command_type) {
+    switch (command_type) {
+    case toysequencer::TEXT_COMMAND:
+      return toysequencer::TEXT_EVENT;
+    case toysequencer::TOB_COMMAND:
+      return toysequencer::TOB_EVENT;
+    default:
+      return toysequencer::MESSAGE_TYPE_UNSPECIFIED;
+    }
   }
 
   std::atomic<uint64_t> next_seq_{1}; // start at 1
+  const uint64_t epoch_ = now_micros(); // this run; stamped on every event so consumers see a restart
 
   adapters::TextCommandToTextEvent text_adapter;
   adapters::TopOfBookCommandToTopOfBookEvent tob_adapter;
+
+  // Scratch events and wire buffer reused for every command on the receive (or sequence stage) thread
+  toysequencer::TextEvent text_event_;
+  toysequencer::TopOfBookEvent tob_event_;
+  SendBuffer send_buf_;
+  SendBuffer *out_ = &send_buf_;
+  std::unique_ptr<Journal> journal_;
+  std::unique_ptr<RetransmissionService> retransmission_;
+  uint8_t ttl_;
+  LatencyHistogram sequence_latency_;
+  LatencyHistogram serialize_latency_;
+  Metric seq_high_water_;
+  ClientSeqTable client_seqs_;
+  Metric duplicate_commands_;
+  Metric stale_commands_;
+  Metric drop_notices_; // written by the publish stage in the pipeline, else the receive thread
+  MulticastReceiver::SubscriptionId flush_subscription_ = 0;
+
+  // Pipeline mode; stage_entry_ and out_ point into the ring while the sequence stage works on an entry
+  PipelineConfig pipeline_config_;
+  std::unique_ptr<SequenceRing<PipelineEntry>> ring_;
+  PipelineEntry *stage_entry_ = nullptr;
+  Sequence sequenced_;
+  Sequence journaled_;
+  Sequence published_;
+  std::atomic<bool> pipeline_running_{false};
+  std::thread sequence_thread_;
+  std::thread journal_thread_;
+  std::thread publish_thread_;
+  LatencyHistogram queue_latency_;
+  Metric ring_depth_;
+  uint64_t emit_pos_ = 0;
+  std::vector<uint64_t> order_; // ring positions of the current batch in the order they get sequenced
+  std::unique_ptr<SymbolSet> symbols_; // lanes only
+  Metric conflated_quotes_;
+
+  // One command group feeding the ring. Its receive thread writes the counters; the sequence stage owns
+  // `sequenced` and the depth gauge.
+  struct Ingress {
+    std::unique_ptr<MulticastReceiver> receiver; // null for the sequencer's own group
+    Metric commands;
+    Metric full_waits;
+    Metric oversized_drops;
+    Metric depth;
+    uint64_t sequenced = 0;
+  };
+  std::vector<Ingress> ingress_;
+
+  // Per-sid admission state, owned by the sequence stage
+  struct SenderMetrics {
+    Metric admitted;
+    Metric rejected;
+    Metric delayed;
+  };
+  struct Sender {
+    TokenBucket bucket;
+    SenderMetrics metrics;
+    uint64_t last_ns = 0; // last command seen, for idle eviction
+    // Round-robin queue of the sender's entries in the lane being scheduled
+    uint64_t head = PipelineEntry::kNoEvent;
+    uint64_t tail = PipelineEntry::kNoEvent;
+    size_t deficit = 0;
+  };
+  bool admission_ = false;
+  std::unordered_map<uint64_t, Sender> senders_;
+  Sender shared_sender_; // sids beyond max_sids
+  std::unordered_map<uint64_t, SenderMetrics> sid_metrics_;
+  uint64_t next_sweep_ns_ = 0;
+  std::vector<Sender *> active_;
 };
 
 using Sequencer = SequencerT;
@@ -1,6 +1,9 @@
 #include "../../utils/env_utils.hpp"
+#include "core/shm_metrics.hpp"
 #include "messages.pb.h"
+#include "core/latency_reporter.hpp"
 #include "sequencer.hpp"
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <csignal>
@@ -9,10 +12,14 @@
 
 static std::atomic<bool> running{true};
 static void handle_signal(int) { running.store(false); }
+#ifndef _WIN32
+static void handle_dump_signal(int) { LatencyReporter::request_dump(); }
+#endif
 
 int main() {
   try {
     EnvUtils::load_env();
+    ShmMetrics::init("sequencer");
 
     std::signal(SIGINT, handle_signal);
     std::signal(SIGTERM, handle_signal);
@@ -25,18 +32,101 @@ int main() {
 
     Sequencer sequencer(cmd_addr, cmd_port, events_addr, events_port, mcast_ttl);
 
-    sequencer.subscribe<toysequencer::TextCommand>(toysequencer::TEXT_COMMAND);
-    sequencer.subscribe<toysequencer::TopOfBookCommand>(toysequencer::TOB_COMMAND);
+    const JournalConfig journal_config = JournalConfig::from_env();
+    if (!journal_config.directory.empty()) {
+      const uint64_t recovered = sequencer.enable_journal(journal_config);
+      std::cout << "sequencer journal at " << journal_config.directory << ", resuming after seq " << recovered
+                << std::endl;
+    }
+
+    const char *retrans_addr = std::getenv("RETRANS_ADDR");
+    const char *retrans_port = std::getenv("RETRANS_PORT");
+    if (retrans_addr && retrans_addr[0] != '\0' && retrans_port && retrans_port[0] != '\0') {
+      size_t ring = 65536;
+      if (const char *ring_env = std::getenv("RETRANS_RING_SIZE")) {
+        ring = std::max(1L, std::strtol(ring_env, nullptr, 10));
+      }
+      sequencer.enable_retransmission(retrans_addr, static_cast<uint16_t>(std::stoi(retrans_port)), ring);
+      std::cout << "sequencer serving retransmissions for NACKs on " << retrans_addr << ":" << retrans_port
+                << " (ring " << ring << ")" << std::endl;
+    }
+
+    const char *passthrough_env = std::getenv("SEQ_PASSTHROUGH");
+    const bool passthrough = passthrough_env && passthrough_env[0] == '1';
+    if (passthrough) {
+      sequencer.subscribe_raw(toysequencer::TEXT_COMMAND);
+      sequencer.subscribe_raw(toysequencer::TOB_COMMAND);
+    } else {
+      sequencer.subscribe<toysequencer::TextCommand>(toysequencer::TEXT_COMMAND);
+      sequencer.subscribe<toysequencer::TopOfBookCommand>(toysequencer::TOB_COMMAND);
+    }
+
+    const PipelineConfig pipeline_config = PipelineConfig::from_env();
+    if (pipeline_config.enabled) {
+      sequencer.enable_pipeline(pipeline_config);
+      std::cout << "sequencer pipeline enabled (ring " << sequencer.get_pipeline_ring()->capacity() << " entries"
+                << (sequencer.get_journal() ? ", journal stage" : "")
+                << (pipeline_config.lanes ? ", priority and conflating lanes" : "") << ")" << std::endl;
+      for (const PipelineConfig::Ingress &group : pipeline_config.ingress) {
+        std::cout << "sequencer also listening for commands on " << group.address << ":" << group.port << std::endl;
+      }
+    }
+
+    LatencyReporter latency_reporter("sequencer");
+    latency_reporter.add("recv", sequencer.get_recv_latency());
+    if (sequencer.pipeline_enabled()) {
+      latency_reporter.add("queue", sequencer.get_queue_latency());
+    }
+    latency_reporter.add("parse", sequencer.get_parse_latency());
+    latency_reporter.add("sequence", sequencer.get_sequence_latency());
+    latency_reporter.add("serialize", sequencer.get_serialize_latency());
+    latency_reporter.add("send", sequencer.get_send_latency());
+    if (latency::enabled()) {
+      long interval_s = 0;
+      if (const char *interval_env = std::getenv("LATENCY_DUMP_S")) {
+        interval_s = std::max(0L, std::strtol(interval_env, nullptr, 10));
+      }
+#ifndef _WIN32
+      std::signal(SIGUSR1, handle_dump_signal);
+#endif
+      latency_reporter.start(std::chrono::seconds(interval_s));
+    }
 
     sequencer.start();
     std::cout << "sequencer started, listening for commands on " << cmd_addr << ":" << cmd_port
-              << " and publishing events to " << events_addr << ":" << events_port << std::endl;
+              << " and publishing events to " << events_addr << ":" << events_port
+              << (passthrough ? " (pass-through)" : "") << std::endl;
 
     while (running.load()) {
       std::this_thread::sleep_for(std::chrono::milliseconds(200));
     }
 
     sequencer.stop();
+    latency_reporter.stop();
+    if (latency::enabled()) {
+      latency_reporter.dump(std::cout);
+    }
+
+    const RecvBatchStats stats = sequencer.get_batch_stats();
+    std::cout << "sequencer recv batches=" << stats.batches << " datagrams=" << stats.datagrams
+              << " avg_fill=" << stats.average_fill() << " (batch size " << sequencer.get_batch_size() << ")"
+              << std::endl;
+    const SendBatchStats send_stats = sequencer.get_send_batch_stats();
+    std::cout << "sequencer send flushes=" << send_stats.flushes << " payloads=" << send_stats.payloads
+              << " gso_flushes=" << send_stats.gso_flushes << std::endl;
+    if (const Journal *journal = sequencer.get_journal()) {
+      const JournalStats journal_stats = journal->get_stats();
+      std::cout << "sequencer journal appends=" << journal_stats.appends << " bytes=" << journal_stats.bytes
+                << " syncs=" << journal_stats.syncs << " last_seq=" << journal->last_seq() << std::endl;
+    }
+    if (const RetransmissionService *retrans = sequencer.get_retransmission()) {
+      const RetransmissionStats retrans_stats = retrans->get_stats();
+      std::cout << "sequencer retransmission nacks=" << retrans_stats.nacks << " resent=" << retrans_stats.resent
+                << " misses=" << retrans_stats.misses << std::endl;
+    }
+    AsyncLogger::instance().flush();
+    const LogStats log_stats = AsyncLogger::instance().get_stats();
+    std::cout << "sequencer log records written=" << log_stats.written << " dropped=" << log_stats.dropped << std::endl;
     return 0;
   } catch (const std::exception &e) {
     std::cerr << "sequencer error: " << e.what() << std::endl;
@@ -0,0 +1,159 @@
+#pragma once
+
+#include "admission.hpp"
+#include "core/client_seq.hpp"
+#include "core/event_limits.hpp"
+#include "core/send_buffer.hpp"
+#include "utils/thread_utils.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Staged sequencer: receive, sequence, journal and publish each run on their own thread over one SequenceRing.
+// Extra ingress groups each get a receive thread of their own, all claiming entries on the same ring.
+struct PipelineConfig {
+  struct Ingress {
+    std::string address;
+    uint16_t port = 0;
+  };
+
+  enum Stage { ReceiveStage = 0, SequenceStage = 1, JournalStage = 2, PublishStage = 3 };
+
+  bool enabled = false;
+  size_t ring_size = 1024;
+  std::vector<int> cpus; // indexed by Stage; missing or -1 leaves the stage unpinned
+  std::vector<Ingress> ingress; // command groups in addition to the sequencer's own
+  // Lanes: each drained batch sequences everything but TopOfBookCommands first, then the quotes, keeping only
+  // the newest quote per symbol once the batch is deeper than conflate_depth
+  bool lanes = false;
+  size_t conflate_depth = 16;
+  AdmissionConfig admission;
+
+  int cpu_for(Stage stage) const { return static_cast<size_t>(stage) < cpus.size() ? cpus[stage] : -1; }
+
+  // SEQ_PIPELINE=1 enables it, SEQ_PIPELINE_RING sets the entry count, SEQ_PIPELINE_CPUS="recv,seq,journal,pub".
+  // SEQ_INGRESS="addr:port,addr:port" adds command groups, SEQ_LANES=1 (with SEQ_CONFLATE_DEPTH) turns on
+  // lanes and AdmissionConfig::from_env() adds per-sid admission; each implies SEQ_PIPELINE=1.
+  static PipelineConfig from_env() {
+    PipelineConfig config;
+    const char *enabled = std::getenv("SEQ_PIPELINE");
+    config.enabled = enabled && enabled[0] == '1';
+    if (const char *ingress = std::getenv("SEQ_INGRESS")) {
+      config.ingress = parse_ingress(ingress);
+      config.enabled = config.enabled || !config.ingress.empty();
+    }
+    if (const char *lanes = std::getenv("SEQ_LANES")) {
+      config.lanes = lanes[0] == '1';
+      config.enabled = config.enabled || config.lanes;
+    }
+    if (const char *depth = std::getenv("SEQ_CONFLATE_DEPTH")) {
+      long n = std::strtol(depth, nullptr, 10);
+      if (n >= 0) {
+        config.conflate_depth = static_cast<size_t>(n);
+      }
+    }
+    config.admission = AdmissionConfig::from_env();
+    config.enabled = config.enabled || config.admission.enabled();
+    if (const char *ring = std::getenv("SEQ_PIPELINE_RING")) {
+      long n = std::strtol(ring, nullptr, 10);
+      if (n > 0) {
+        config.ring_size = static_cast<size_t>(n);
+      }
+    }
+    if (const char *cpus = std::getenv("SEQ_PIPELINE_CPUS")) {
+      config.cpus = ThreadUtils::parse_cpu_list(cpus);
+    }
+    return config;
+  }
+
+  // "239.255.0.3:30103,239.255.0.4:30104"; malformed entries are skipped
+  static std::vector<Ingress> parse_ingress(const std::string &list) {
+    std::vector<Ingress> groups;
+    size_t begin = 0;
+    while (begin < list.size()) {
+      size_t end = list.find(',', begin);
+      if (end == std::string::npos) {
+        end = list.size();
+      }
+      const std::string item = list.substr(begin, end - begin);
+      const size_t colon = item.rfind(':');
+      if (colon != std::string::npos && colon > 0) {
+        const long port = std::strtol(item.c_str() + colon + 1, nullptr, 10);
+        if (port > 0 && port <= 65535) {
+          groups.push_back({item.substr(0, colon), static_cast<uint16_t>(port)});
+        }
+      }
+      begin = end + 1;
+    }
+    return groups;
+  }
+};
+
+// One command's trip through the pipeline. Allocated once with the ring; every stage works on it in place.
+struct PipelineEntry {
+  static constexpr uint64_t kNoEvent = UINT64_MAX;
+  static constexpr size_t kPayloadBytes = event_limits::kCommandBytes;
+  static constexpr size_t kEventBytes = event_limits::kEventBytes;
+
+  uint64_t ingest_ns = 0; // set with LATENCY_STATS=1
+  uint64_t seq = 0;       // 0 when the command produced no event
+  uint32_t len = 0;
+  uint32_t ingress = 0; // 0 is the sequencer's own command group
+  bool quote = false;   // TopOfBookCommand, in the conflating lane
+  bool conflated = false;
+  bool rejected = false; // over its sender's rate
+  uint64_t sid = 0;
+  // Set when a numbered command produces no event; the publish stage sends its sender a drop notice instead
+  client_seq::DropReason drop = client_seq::DropReason::None;
+  uint64_t cseq = 0;
+  uint64_t next_in_sid = kNoEvent; // the sender's next entry in this batch, for round-robin
+  // Ring position of the entry whose event goes out at this position. The sequence stage may sequence a batch
+  // out of ring order, and later stages follow this so events still leave in seq order.
+  uint64_t emit = kNoEvent;
+  alignas(64) uint8_t command[kPayloadBytes];
+  SendBuffer event{kEventBytes};
+};
+
+// Set of symbols seen in the current batch, allocated once and cleared in O(1) by bumping a generation.
+// Symbols are views into ring entries, valid until the batch is released.
+class SymbolSet {
+public:
+  explicit SymbolSet(size_t capacity) {
+    size_t size = 1;
+    while (size < capacity * 2) {
+      size <<= 1;
+    }
+    mask_ = size - 1;
+    slots_.resize(size);
+  }
+
+  void clear() { ++generation_; }
+
+  // False if the symbol is already in the set
+  bool insert(std::string_view symbol) {
+    for (size_t i = std::hash<std::string_view>{}(symbol) & mask_;; i = (i + 1) & mask_) {
+      Slot &slot = slots_[i];
+      if (slot.generation != generation_) {
+        slot.generation = generation_;
+        slot.symbol = symbol;
+        return true;
+      }
+      if (slot.symbol == symbol) {
+        return false;
+      }
+    }
+  }
+
+private:
+  struct Slot {
+    uint64_t generation = 0;
+    std::string_view symbol;
+  };
+  std::vector<Slot> slots_;
+  size_t mask_ = 0;
+  uint64_t generation_ = 1;
+};
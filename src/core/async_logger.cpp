@@ -0,0 +1,200 @@
+#include "async_logger.hpp"
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+
+namespace {
+
+LogLevel parse_level(const char *s, LogLevel fallback) {
+  if (s == nullptr || s[0] == '\0') {
+    return fallback;
+  }
+  const std::string v(s);
+  if (v == "debug") {
+    return LogLevel::Debug;
+  }
+  if (v == "info") {
+    return LogLevel::Info;
+  }
+  if (v == "warn") {
+    return LogLevel::Warn;
+  }
+  if (v == "error") {
+    return LogLevel::Error;
+  }
+  if (v == "off") {
+    return LogLevel::Off;
+  }
+  return fallback;
+}
+
+const char *level_name(LogLevel level) {
+  switch (level) {
+  case LogLevel::Debug:
+    return "DEBUG";
+  case LogLevel::Info:
+    return "INFO ";
+  case LogLevel::Warn:
+    return "WARN ";
+  case LogLevel::Error:
+    return "ERROR";
+  default:
+    return "     ";
+  }
+}
+
+} // namespace
+
+AsyncLogger &AsyncLogger::instance() {
+  static AsyncLogger logger;
+  return logger;
+}
+
+AsyncLogger::AsyncLogger() {
+  level_.store(static_cast<uint8_t>(parse_level(std::getenv("LOG_LEVEL"), LogLevel::Info)));
+  if (const char *ring = std::getenv("LOG_RING_SIZE")) {
+    long n = std::strtol(ring, nullptr, 10);
+    if (n > 0) {
+      ring_capacity_ = static_cast<size_t>(n);
+    }
+  }
+  if (const char *file = std::getenv("LOG_FILE"); file && file[0] != '\0') {
+    if (FILE *f = std::fopen(file, "a")) {
+      out_ = f;
+      owns_out_ = true;
+    } else {
+      std::cerr << "Failed to open LOG_FILE " << file << ", logging to stdout" << std::endl;
+    }
+  }
+  line_.reserve(64 * 1024);
+  running_.store(true);
+  writer_ = std::thread([this] { run_writer(); });
+}
+
+AsyncLogger::~AsyncLogger() {
+  stop();
+  if (owns_out_) {
+    std::fclose(out_);
+  }
+}
+
+std::shared_ptr<AsyncLogger::ThreadRing> AsyncLogger::register_thread() {
+  auto ring = std::make_shared<ThreadRing>(ring_capacity_);
+  std::lock_guard<std::mutex> lock(rings_mutex_);
+  rings_.push_back(ring);
+  return ring;
+}
+
+void AsyncLogger::flush() {
+  if (!running_.load()) {
+    drain();
+    return;
+  }
+  const uint64_t ticket = flush_requests_.fetch_add(1) + 1;
+  while (flushes_done_.load(std::memory_order_acquire) < ticket && running_.load()) {
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+}
+
+void AsyncLogger::stop() {
+  if (running_.exchange(false) && writer_.joinable()) {
+    writer_.join();
+  }
+  drain();
+}
+
+LogStats AsyncLogger::get_stats() const {
+  LogStats stats;
+  stats.written = written_.load(std::memory_order_relaxed);
+  stats.dropped = retired_dropped_.load(std::memory_order_relaxed);
+  std::lock_guard<std::mutex> lock(rings_mutex_);
+  for (const auto &ring : rings_) {
+    stats.dropped += ring->dropped.load(std::memory_order_relaxed);
+  }
+  return stats;
+}
+
+void AsyncLogger::run_writer() {
+  while (running_.load()) {
+    const uint64_t requested = flush_requests_.load(std::memory_order_acquire);
+    const size_t written = drain();
+    flushes_done_.store(requested, std::memory_order_release);
+    if (written == 0) {
+      std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+  }
+}
+
+size_t AsyncLogger::drain() {
+  std::lock_guard<std::mutex> lock(rings_mutex_);
+  size_t count = 0;
+  for (auto it = rings_.begin(); it != rings_.end();) {
+    ThreadRing &ring = **it;
+    while (const LogRecord *record = ring.records.front()) {
+      format_record(*record);
+      ring.records.release();
+      count++;
+    }
+    if (!line_.empty()) {
+      std::fwrite(line_.data(), 1, line_.size(), out_);
+      line_.clear();
+    }
+    // The owning thread has exited and everything it logged is written
+    if (it->use_count() == 1 && ring.records.empty()) {
+      retired_dropped_.fetch_add(ring.dropped.load(std::memory_order_relaxed), std::memory_order_relaxed);
+      it = rings_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  if (count > 0) {
+    std::fflush(out_);
+    written_.fetch_add(count, std::memory_order_relaxed);
+  }
+  return count;
+}
+
+void AsyncLogger::format_record(const LogRecord &record) {
+  const time_t secs = static_cast<time_t>(record.timestamp_ns / 1000000000ULL);
+  const unsigned micros = static_cast<unsigned>((record.timestamp_ns % 1000000000ULL) / 1000);
+  std::tm tm{};
+#ifdef _WIN32
+  gmtime_s(&tm, &secs);
+#else
+  gmtime_r(&secs, &tm);
+#endif
+  char prefix[48];
+  int n = std::snprintf(prefix, sizeof(prefix), "%02d:%02d:%02d.%06u %s ", tm.tm_hour, tm.tm_min, tm.tm_sec, micros,
+                        level_name(record.format->level));
+  line_.append(prefix, static_cast<size_t>(n));
+
+  size_t next_arg = 0;
+  for (const char *p = record.format->format; *p != '\0'; ++p) {
+    if (p[0] != '{' || p[1] != '}' || next_arg >= record.arg_count) {
+      line_.push_back(*p);
+      continue;
+    }
+    const LogRecord::Arg &arg = record.args[next_arg];
+    char buf[32];
+    switch (record.types[next_arg]) {
+    case LogRecord::ArgType::Unsigned:
+      n = std::snprintf(buf, sizeof(buf), "%llu", static_cast<unsigned long long>(arg.u));
+      line_.append(buf, static_cast<size_t>(n));
+      break;
+    case LogRecord::ArgType::Signed:
+      n = std::snprintf(buf, sizeof(buf), "%lld", static_cast<long long>(arg.i));
+      line_.append(buf, static_cast<size_t>(n));
+      break;
+    case LogRecord::ArgType::Double:
+      n = std::snprintf(buf, sizeof(buf), "%.10g", arg.d);
+      line_.append(buf, static_cast<size_t>(n));
+      break;
+    case LogRecord::ArgType::Text:
+      line_.append(record.text + arg.text.offset, arg.text.len);
+      break;
+    }
+    next_arg++;
+    ++p; // skip the closing brace
+  }
+  line_.push_back('\n');
+}
@@ -0,0 +1,192 @@
+#pragma once
+
+#include "core/spsc_ring.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+enum class LogLevel : uint8_t { Debug = 0, Info = 1, Warn = 2, Error = 3, Off = 4 };
+
+// Static description of one log statement; records point at it instead of carrying the format text
+struct LogFormat {
+  LogLevel level;
+  const char *format; // "{}" marks each argument
+};
+
+// Fixed-size binary record: the format plus up to kMaxArgs raw arguments. Strings are copied (truncated) into
+// the inline text area so the record never owns heap memory.
+struct LogRecord {
+  static constexpr size_t kMaxArgs = 8;
+  static constexpr size_t kTextBytes = 96;
+
+  enum class ArgType : uint8_t { Unsigned, Signed, Double, Text };
+
+  union Arg {
+    uint64_t u;
+    int64_t i;
+    double d;
+    struct {
+      uint16_t offset;
+      uint16_t len;
+    } text;
+  };
+
+  const LogFormat *format = nullptr;
+  uint64_t timestamp_ns = 0;
+  uint8_t arg_count = 0;
+  uint16_t text_used = 0;
+  ArgType types[kMaxArgs];
+  Arg args[kMaxArgs];
+  char text[kTextBytes];
+
+  void add(ArgType type, Arg arg) {
+    if (arg_count < kMaxArgs) {
+      types[arg_count] = type;
+      args[arg_count] = arg;
+      arg_count++;
+    }
+  }
+
+  void add_text(std::string_view s) {
+    const size_t n = std::min(s.size(), kTextBytes - text_used);
+    Arg arg;
+    arg.text.offset = text_used;
+    arg.text.len = static_cast<uint16_t>(n);
+    std::memcpy(text + text_used, s.data(), n);
+    text_used = static_cast<uint16_t>(text_used + n);
+    add(ArgType::Text, arg);
+  }
+};
+
+struct LogStats {
+  uint64_t written = 0;
+  uint64_t dropped = 0; // records lost to a full per-thread ring
+};
+
+// Asynchronous logger. Each logging thread owns an SPSC ring of LogRecords; the hot path checks the level
+// with one relaxed load, copies the raw arguments into a ring slot and returns. A background thread drains
+// the rings, formats the records and writes them out, so a slow or blocked stdout never stalls the caller.
+// A full ring drops the record (counted) rather than blocking.
+//
+// Configured from LOG_LEVEL (debug|info|warn|error|off, default info), LOG_FILE (default stdout) and
+// LOG_RING_SIZE (records per thread, default 4096).
+class AsyncLogger {
+public:
+  static AsyncLogger &instance();
+
+  static bool enabled(LogLevel level) {
+    return static_cast<uint8_t>(level) >= instance().level_.load(std::memory_order_relaxed);
+  }
+
+  void set_level(LogLevel level) { level_.store(static_cast<uint8_t>(level), std::memory_order_relaxed); }
+  LogLevel get_level() const { return static_cast<LogLevel>(level_.load(std::memory_order_relaxed)); }
+
+  template <typename... Args> void log(const LogFormat &format, const Args &...args) {
+    ThreadRing &ring = local_ring();
+    LogRecord *record = ring.records.claim();
+    if (record == nullptr) {
+      ring.dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    record->format = &format;
+    record->timestamp_ns = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+            .count());
+    record->arg_count = 0;
+    record->text_used = 0;
+    (encode(*record, args), ...);
+    ring.records.publish();
+  }
+
+  // Blocks until every record logged before the call has been written
+  void flush();
+
+  // Drains and stops the writer thread; later records are dropped
+  void stop();
+
+  LogStats get_stats() const;
+
+  ~AsyncLogger();
+
+private:
+  struct ThreadRing {
+    explicit ThreadRing(size_t capacity) : records(capacity) {}
+    SpscRing<LogRecord> records;
+    std::atomic<uint64_t> dropped{0};
+  };
+
+  AsyncLogger();
+
+  ThreadRing &local_ring() {
+    thread_local std::shared_ptr<ThreadRing> ring = register_thread();
+    return *ring;
+  }
+
+  std::shared_ptr<ThreadRing> register_thread();
+  void run_writer();
+  size_t drain();
+  void format_record(const LogRecord &record);
+
+  template <typename T> static void encode(LogRecord &record, const T &value) {
+    using V = std::decay_t<T>;
+    LogRecord::Arg arg;
+    if constexpr (std::is_same_v<V, bool>) {
+      record.add_text(value ? "true" : "false");
+    } else if constexpr (std::is_enum_v<V>) {
+      arg.i = static_cast<int64_t>(value);
+      record.add(LogRecord::ArgType::Signed, arg);
+    } else if constexpr (std::is_integral_v<V> && std::is_signed_v<V>) {
+      arg.i = static_cast<int64_t>(value);
+      record.add(LogRecord::ArgType::Signed, arg);
+    } else if constexpr (std::is_integral_v<V>) {
+      arg.u = static_cast<uint64_t>(value);
+      record.add(LogRecord::ArgType::Unsigned, arg);
+    } else if constexpr (std::is_floating_point_v<V>) {
+      arg.d = static_cast<double>(value);
+      record.add(LogRecord::ArgType::Double, arg);
+    } else {
+      record.add_text(std::string_view(value));
+    }
+  }
+
+  std::atomic<uint8_t> level_{static_cast<uint8_t>(LogLevel::Info)};
+  size_t ring_capacity_ = 4096;
+
+  mutable std::mutex rings_mutex_;
+  std::vector<std::shared_ptr<ThreadRing>> rings_;
+
+  FILE *out_ = stdout;
+  bool owns_out_ = false;
+  std::string line_;
+  std::atomic<uint64_t> written_{0};
+  std::atomic<uint64_t> retired_dropped_{0};
+
+  std::atomic<bool> running_{false};
+  std::atomic<uint64_t> flush_requests_{0};
+  std::atomic<uint64_t> flushes_done_{0};
+  std::thread writer_;
+};
+
+#define TS_LOG(LEVEL, FORMAT, ...)                                                                                     \
+  do {                                                                                                                 \
+    if (AsyncLogger::enabled(LEVEL)) {                                                                                 \
+      static constexpr LogFormat ts_log_format{LEVEL, FORMAT};                                                         \
+      AsyncLogger::instance().log(ts_log_format, ##__VA_ARGS__);                                                       \
+    }                                                                                                                  \
+  } while (0)
+
+#define LOG_DEBUG(FORMAT, ...) TS_LOG(LogLevel::Debug, FORMAT, ##__VA_ARGS__)
+#define LOG_INFO(FORMAT, ...) TS_LOG(LogLevel::Info, FORMAT, ##__VA_ARGS__)
+#define LOG_WARN(FORMAT, ...) TS_LOG(LogLevel::Warn, FORMAT, ##__VA_ARGS__)
+#define LOG_ERROR(FORMAT, ...) TS_LOG(LogLevel::Error, FORMAT, ##__VA_ARGS__)
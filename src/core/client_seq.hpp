@@ -0,0 +1,197 @@
+#pragma once
+
+#include "core/passthrough.hpp"
+#include "core/send_buffer.hpp"
+#include "core/seq_window.hpp"
+#include "core/wire_peek.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+// Client sequence numbers (cseq): every command carries a per-sender number that only ever grows, so the
+// sequencer can drop a retransmitted or network-duplicated command by (sid, sender epoch, cseq) alone, without
+// hashing it. Sids are fixed per application type, so the sender epoch is what tells two processes of one type
+// apart.
+namespace client_seq {
+
+constexpr uint32_t kField = 15;      // cseq in every command and event; the tag fits in one byte
+constexpr uint32_t kEpochField = 14; // sender epoch in every command
+
+// First cseq of a sender process. Wall-clock milliseconds in the upper bits keep numbers growing across
+// restarts as long as the sender averages fewer than 2^20 commands per millisecond of uptime.
+inline uint64_t initial() {
+  const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      std::chrono::system_clock::now().time_since_epoch())
+                      .count();
+  return static_cast<uint64_t>(ms) << 20;
+}
+
+// Identifies one sender process: its start time in milliseconds above 16 random bits, so it grows across
+// restarts and two processes started in the same millisecond still differ
+inline uint64_t sender_epoch() {
+  const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      std::chrono::system_clock::now().time_since_epoch())
+                      .count();
+  std::random_device random;
+  return (static_cast<uint64_t>(ms) << 16) | (random() & 0xffff);
+}
+
+namespace detail {
+inline size_t put_varint_field(uint8_t *out, uint32_t field_number, uint64_t value) {
+  size_t n = 0;
+  out[n++] = static_cast<uint8_t>(field_number << 3); // varint wire type
+  while (value >= 0x80) {
+    out[n++] = static_cast<uint8_t>(value | 0x80);
+    value >>= 7;
+  }
+  out[n++] = static_cast<uint8_t>(value);
+  return n;
+}
+} // namespace detail
+
+// Appends the sender epoch and cseq to a serialized command (which leaves both unset) as trailing varint
+// fields, so numbering a command never re-serializes it
+inline bool stamp(SendBuffer &buf, uint64_t epoch, uint64_t cseq) {
+  uint8_t field[22];
+  size_t n = detail::put_varint_field(field, kEpochField, epoch);
+  n += detail::put_varint_field(field + n, kField, cseq);
+  uint8_t *out = buf.extend(n);
+  if (out == nullptr) {
+    return false;
+  }
+  std::memcpy(out, field, n);
+  return true;
+}
+
+// The sid and cseq a sequenced event echoes, from a protobuf event or a pass-through frame (whose payload is
+// the original command); false if the event carries no cseq
+inline bool peek_event(const uint8_t *data, size_t len, uint64_t &sid, uint64_t &cseq) {
+  constexpr uint32_t kCommandSidField = 2;
+  constexpr uint32_t kEventSidField = 4;
+  if (passthrough::is_passthrough(data, len)) {
+    data += passthrough::kHeaderSize;
+    len -= passthrough::kHeaderSize;
+    return wire::find_varint_field(data, len, kCommandSidField, sid) && wire::find_varint_field(data, len, kField, cseq);
+  }
+  return wire::find_varint_field(data, len, kEventSidField, sid) && wire::find_varint_field(data, len, kField, cseq);
+}
+
+// Drop notice: the sequencer's answer to a numbered command it will not sequence, sent unsequenced on the events
+// group so its sender stops retransmitting it. Magic 0xA7, the reason, then sid and cseq as little-endian u64.
+enum class DropReason : uint8_t { None = 0, Duplicate = 1, Stale = 2, Conflated = 3, Rejected = 4 };
+
+constexpr uint8_t kDropMagic = 0xA7;
+constexpr size_t kDropSize = 2 + 2 * sizeof(uint64_t);
+
+inline void encode_drop(uint64_t sid, uint64_t cseq, DropReason reason, uint8_t *out) {
+  out[0] = kDropMagic;
+  out[1] = static_cast<uint8_t>(reason);
+  passthrough::detail::store_le<uint64_t>(out + 2, sid);
+  passthrough::detail::store_le<uint64_t>(out + 10, cseq);
+}
+
+inline bool is_drop(const uint8_t *data, size_t len) { return len == kDropSize && data[0] == kDropMagic; }
+
+inline bool decode_drop(const uint8_t *data, size_t len, uint64_t &sid, uint64_t &cseq, DropReason &reason) {
+  if (!is_drop(data, len)) {
+    return false;
+  }
+  reason = static_cast<DropReason>(data[1]);
+  sid = passthrough::detail::load_le<uint64_t>(data + 2);
+  cseq = passthrough::detail::load_le<uint64_t>(data + 10);
+  return true;
+}
+
+} // namespace client_seq
+
+// Duplicate filter for the sequencer: one SeqWindow of cseqs per sender process, keyed by (sid, sender epoch).
+// cseq 0 means the sender does not number its commands and is always accepted. The newest process of each
+// small sid has a direct slot; older ones still sending (another process of the same type, started earlier)
+// and large sids go to a map that keeps the kMaxOverflow most recently used windows.
+class ClientSeqTable {
+public:
+  using Window = SeqWindow<1024>;
+  using Verdict = Window::Verdict;
+
+  static constexpr size_t kMaxOverflow = 4096;
+
+  Verdict check(uint64_t sid, uint64_t epoch, uint64_t cseq) {
+    if (cseq == 0) {
+      return Verdict::Accept;
+    }
+    return window_for(sid, epoch).check(cseq);
+  }
+
+  size_t overflow_size() const { return overflow_.size(); }
+
+private:
+  static constexpr uint64_t kDirectSids = 256; // instance ids are small; larger sids fall back to the map
+
+  struct Entry {
+    uint64_t epoch = 0;
+    uint64_t used = 0; // check() count when last used; 0 for a direct slot nobody has taken yet
+    Window window;
+  };
+
+  struct Key {
+    uint64_t sid;
+    uint64_t epoch;
+    bool operator==(const Key &other) const { return sid == other.sid && epoch == other.epoch; }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key &key) const {
+      return std::hash<uint64_t>{}(key.sid * 0x9E3779B97F4A7C15ull ^ key.epoch);
+    }
+  };
+
+  Window &window_for(uint64_t sid, uint64_t epoch) {
+    ++clock_;
+    if (sid < kDirectSids) {
+      if (direct_.empty()) {
+        direct_.resize(kDirectSids);
+      }
+      Entry &entry = direct_[sid];
+      if (entry.used == 0 || entry.epoch == epoch || epoch > entry.epoch) {
+        if (entry.used != 0 && entry.epoch != epoch) {
+          // A newer process of this sid takes the slot; the one it displaces keeps its window in the map
+          overflow_slot(Key{sid, entry.epoch}) = entry;
+          entry = Entry{};
+        }
+        entry.epoch = epoch;
+        entry.used = clock_;
+        return entry.window;
+      }
+    }
+    Entry &entry = overflow_slot(Key{sid, epoch});
+    entry.used = clock_;
+    return entry.window;
+  }
+
+  Entry &overflow_slot(const Key &key) {
+    auto it = overflow_.find(key);
+    if (it != overflow_.end()) {
+      return it->second;
+    }
+    if (overflow_.size() >= kMaxOverflow) {
+      auto oldest = overflow_.begin();
+      for (auto at = overflow_.begin(); at != overflow_.end(); ++at) {
+        if (at->second.used < oldest->second.used) {
+          oldest = at;
+        }
+      }
+      overflow_.erase(oldest);
+    }
+    Entry &entry = overflow_[key];
+    entry.epoch = key.epoch;
+    return entry;
+  }
+
+  uint64_t clock_ = 0;
+  std::vector<Entry> direct_;
+  std::unordered_map<Key, Entry, KeyHash> overflow_;
+};
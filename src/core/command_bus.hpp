@@ -1,7 +1,10 @@
 #pragma once
 
+#include "core/rcu_snapshot.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <functional>
-#include <mutex>
 #include <typeindex>
 #include <unordered_map>
 #include <utility>
@@ -13,34 +16,48 @@ public:
   using CommandHandler =
       std::function<void(const CommandT &, uint64_t sender_id)>;
 
+  using SubscriptionId = uint64_t;
+
   template <typename CommandT>
-  void subscribe(CommandHandler<CommandT> handler) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto &bucket = handlers_[std::type_index(typeid(CommandT))];
-    bucket.push_back([h = std::move(handler)](const void *ptr, uint64_t sid) {
-      h(*static_cast<const CommandT *>(ptr), sid);
+  SubscriptionId subscribe(CommandHandler<CommandT> handler) {
+    const SubscriptionId id = next_id_.fetch_add(1);
+    ErasedHandler erased{id, [h = std::move(handler)](const void *ptr, uint64_t sid) {
+                           h(*static_cast<const CommandT *>(ptr), sid);
+                         }};
+    handlers_.update([&](auto &handlers) {
+      handlers[std::type_index(typeid(CommandT))].push_back(std::move(erased));
+    });
+    return id;
+  }
+
+  void unsubscribe(SubscriptionId id) {
+    handlers_.update([id](auto &handlers) {
+      for (auto &[type, bucket] : handlers) {
+        bucket.erase(std::remove_if(bucket.begin(), bucket.end(),
+                                    [id](const ErasedHandler &h) { return h.id == id; }),
+                     bucket.end());
+      }
     });
   }
 
   template <typename CommandT>
   void publish(const CommandT &command, uint64_t sender_id) const {
-    // call without holding lock to avoid handler reentrancy issues
-    std::vector<std::function<void(const void *, uint64_t)>> copy;
-    {
-      std::lock_guard<std::mutex> lock(mutex_);
-      auto it = handlers_.find(std::type_index(typeid(CommandT)));
-      if (it != handlers_.end()) {
-        copy = it->second;
-      }
+    // handlers run against an immutable snapshot, so they may (un)subscribe without deadlocking
+    auto snapshot = handlers_.read();
+    auto it = snapshot->find(std::type_index(typeid(CommandT)));
+    if (it == snapshot->end()) {
+      return;
     }
-    for (auto &erased : copy) {
-      erased(&command, sender_id);
+    for (const auto &erased : it->second) {
+      erased.fn(&command, sender_id);
     }
   }
 
 private:
-  using ErasedHandler = std::function<void(const void *, uint64_t)>;
-  mutable std::mutex mutex_;
-  mutable std::unordered_map<std::type_index, std::vector<ErasedHandler>>
-      handlers_;
+  struct ErasedHandler {
+    SubscriptionId id;
+    std::function<void(const void *, uint64_t)> fn;
+  };
+  std::atomic<SubscriptionId> next_id_{1};
+  RcuSnapshot<std::unordered_map<std::type_index, std::vector<ErasedHandler>>> handlers_;
 };
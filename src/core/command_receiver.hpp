@@ -1,6 +1,10 @@
 #pragma once
 
+#include "core/latency_histogram.hpp"
+#include "core/message_registry.hpp"
 #include "core/multicast_receiver.hpp"
+#include "core/parse_arena.hpp"
+#include "core/shm_metrics.hpp"
 #include "generated/messages.pb.h"
 #include <cstdint>
 #include <iostream>
@@ -8,7 +12,13 @@
 template <typename Derived> class CommandReceiver : public MulticastReceiver {
 public:
   explicit CommandReceiver(const std::string &multicast_address, uint16_t port)
-      : MulticastReceiver(multicast_address, port) {}
+      : MulticastReceiver(multicast_address, port),
+        parse_failures_(
+            ShmMetrics::instance().counter(endpoint_metric("rx", multicast_address, port, "parse failures"))) {
+    dispatch_subscription_ =
+        MulticastReceiver::subscribe([this](const uint8_t *data, size_t len) { this->dispatch_datagram(data, len); });
+    MulticastReceiver::subscribe_batch([](const Datagram *, size_t) { ParseArena::local().reset(); });
+  }
 
   virtual ~CommandReceiver() = default;
 
@@ -16,33 +26,53 @@ public:
 
   void stop() { MulticastReceiver::stop(); }
 
+  template <typename CommandT> void subscribe() { subscribe<CommandT>(MessageTypeOf<CommandT>::value); }
+
   template <typename CommandT> void subscribe(toysequencer::MessageType msg_type) {
-    MulticastReceiver::subscribe(
-        std::function<void(const uint8_t *data, size_t len)>([this, msg_type](const uint8_t *data, size_t len) {
-          // Peek at the first 4 bytes (protobuf varint for enum is usually 1 byte, but proto3 fields are fixed order)
-          // In our .proto, msg_type is field 1, which is a varint (enum), so it's the first field.
-          // We can parse the first byte(s) to extract the field 1 value.
-          // Protobuf wire format: <field_number << 3 | wire_type>, then value.
-          // For field 1 (msg_type), tag = 1 << 3 | 0 = 8 (0x08), then value (varint)
-          if (len >= 2 && data[0] == 0x08) { // 0x08 is the tag for field 1, varint
-            // read varint (should be 1 byte for our enum values)
-            uint8_t msg_type_val = data[1];
-            if (msg_type_val == static_cast<uint8_t>(msg_type)) {
-              on_datagram<CommandT>(data, len);
-            }
-          }
-        }));
+    dispatch_table_.set(msg_type, [](CommandReceiver *self, toysequencer::MessageType, const uint8_t *data,
+                                     size_t len) { self->template on_datagram<CommandT>(data, len); });
+  }
+
+  // Hands the unparsed command bytes to Derived::on_raw_command(msg_type, data, len)
+  void subscribe_raw(toysequencer::MessageType msg_type) {
+    dispatch_table_.set(msg_type,
+                        [](CommandReceiver *self, toysequencer::MessageType type, const uint8_t *data, size_t len) {
+                          static_cast<Derived *>(self)->on_raw_command(type, data, len);
+                        });
   }
 
+  // One varint decode and one table lookup per datagram, regardless of how many types are subscribed
+  void dispatch_datagram(const uint8_t *data, size_t len) {
+    uint64_t msg_type = 0;
+    if (peek_msg_type(data, len, msg_type)) {
+      dispatch_table_.dispatch(this, msg_type, data, len);
+    }
+  }
+
+  // Hands received datagrams to `handler` instead of dispatching them on the receive thread; the owner then
+  // calls dispatch_datagram() from the thread that should parse them
+  void redirect_datagrams(DatagramHandler handler) {
+    MulticastReceiver::unsubscribe(dispatch_subscription_);
+    dispatch_subscription_ = MulticastReceiver::subscribe(std::move(handler));
+  }
+
+  const LatencyHistogram &get_parse_latency() const { return parse_latency_; }
+
   template <typename CommandT> void on_datagram(const uint8_t *data, size_t len) {
     try {
-      CommandT command;
-      if (!command.ParseFromArray(data, static_cast<int>(len))) {
-        std::cerr << "Failed to parse command from datagram" << std::endl;
-        return;
-      }
+      with_message<CommandT>([&](CommandT &command) {
+        const uint64_t start_ns = latency::enabled() ? latency::now_ns() : 0;
+        if (!command.ParseFromArray(data, static_cast<int>(len))) {
+          parse_failures_.add();
+          std::cerr << "Failed to parse command from datagram" << std::endl;
+          return;
+        }
+        if (start_ns != 0) {
+          parse_latency_.record_since(start_ns);
+        }
 
-      dispatch_command(command);
+        dispatch_command(command);
+      });
     } catch (const std::exception &e) {
       std::cerr << "CommandReceiver error: " << e.what() << std::endl;
     }
@@ -52,4 +82,10 @@ protected:
   template <typename CommandT> void dispatch_command(const CommandT &cmd) {
     static_cast<Derived *>(this)->on_command(cmd);
   }
+
+private:
+  DispatchTable<CommandReceiver> dispatch_table_;
+  SubscriptionId dispatch_subscription_ = 0;
+  LatencyHistogram parse_latency_;
+  Metric parse_failures_;
 };
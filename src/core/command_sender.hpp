@@ -1,18 +1,272 @@
 #pragma once
 
+#include "core/client_seq.hpp"
+#include "core/event_limits.hpp"
+#include "core/multicast_receiver.hpp"
 #include "core/multicast_sender.hpp"
+#include "core/send_buffer.hpp"
+#include "core/shm_metrics.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
+// Retransmit-until-acked: a command is resent every `interval` until the sequenced event echoing its cseq, or
+// the sequencer's drop notice for it, comes back, at most max_attempts times. At most `window` commands are
+// outstanding, each kept in a slot of slot_bytes allocated up front; a command still unacked when its slot comes
+// round again is given up on, and one too large for a slot goes out once without a copy.
+struct RetransmitConfig {
+  std::chrono::milliseconds interval{0}; // zero disables retransmission
+  uint32_t max_attempts = 10;
+  size_t window = 1024;
+  size_t slot_bytes = event_limits::kCommandBytes; // the largest command the sequencer takes
+
+  bool enabled() const { return interval.count() > 0; }
+
+  // CMD_RETRANSMIT_MS, CMD_RETRANSMIT_MAX, CMD_RETRANSMIT_WINDOW, CMD_RETRANSMIT_SLOT_BYTES
+  static RetransmitConfig from_env() {
+    RetransmitConfig config;
+    if (const char *ms = std::getenv("CMD_RETRANSMIT_MS")) {
+      long n = std::strtol(ms, nullptr, 10);
+      if (n > 0) {
+        config.interval = std::chrono::milliseconds(n);
+      }
+    }
+    if (const char *max = std::getenv("CMD_RETRANSMIT_MAX")) {
+      long n = std::strtol(max, nullptr, 10);
+      if (n >= 0) {
+        config.max_attempts = static_cast<uint32_t>(n);
+      }
+    }
+    if (const char *window = std::getenv("CMD_RETRANSMIT_WINDOW")) {
+      long n = std::strtol(window, nullptr, 10);
+      if (n > 0) {
+        config.window = static_cast<size_t>(n);
+      }
+    }
+    if (const char *slot = std::getenv("CMD_RETRANSMIT_SLOT_BYTES")) {
+      long n = std::strtol(slot, nullptr, 10);
+      if (n > 0) {
+        config.slot_bytes = static_cast<size_t>(n);
+      }
+    }
+    return config;
+  }
+};
+
+// Every command goes out numbered with the sender's epoch and next cseq (see client_seq.hpp), so the sequencer drops
+// duplicates. With retransmission enabled, a copy of each command is kept until ack() is called with its cseq.
 template <typename Derived> class ICommandSender : public MulticastSender {
 public:
   ICommandSender(const std::string &multicast_address, uint16_t port,
                  uint8_t ttl)
-      : MulticastSender(multicast_address, port, ttl) {}
+      : MulticastSender(multicast_address, port, ttl), epoch_(client_seq::sender_epoch()),
+        next_cseq_(client_seq::initial()) {
+    enable_retransmit(RetransmitConfig::from_env());
+  }
 
-  virtual ~ICommandSender() = default;
+  virtual ~ICommandSender() { stop_retransmit(); }
 
   template <typename CommandT>
   void send(const CommandT &cmd, const uint64_t sender_id) {
     static_cast<Derived *>(this)->send_command(cmd, sender_id);
   }
+
+  // Numbers the command serialized in `buf` and sends it; with retransmission on, keeps it until acked
+  bool send_numbered(SendBuffer &buf) {
+    return numbered(buf, [this](const SendBuffer &b) { return this->send_m(b.data(), b.size()); });
+  }
+
+  // send_numbered through the send batch (see MulticastSender::enqueue); finish a burst with flush_numbered()
+  bool enqueue_numbered(SendBuffer &buf) {
+    return numbered(buf, [this](const SendBuffer &b) { return this->enqueue(b.data(), b.size()); });
+  }
+
+  bool flush_numbered() {
+    if (!retransmit_.enabled()) {
+      return this->flush();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    return this->flush();
+  }
+
+  // Call with the cseq of every sequenced event this sender's sid shows up in
+  void ack(uint64_t cseq) { settle(cseq, acked_); }
+
+  // Call with the cseq of every drop notice for this sender's sid: the sequencer has already sequenced the
+  // command (a duplicate), conflated it into a newer quote or rejected it over the sid's rate, and resending it
+  // would change nothing
+  void dropped(uint64_t cseq) { settle(cseq, dropped_); }
+
+  // For senders that do not receive events themselves: joins the events group and acks every event and drop
+  // notice echoing `sid`. Call before sending.
+  void listen_for_acks(const std::string &events_address, uint16_t events_port, uint64_t sid) {
+    if (!retransmit_.enabled()) {
+      return;
+    }
+    ack_receiver_ = std::make_unique<MulticastReceiver>(events_address, events_port);
+    ack_receiver_->subscribe([this, sid](const uint8_t *data, size_t len) {
+      uint64_t event_sid = 0;
+      uint64_t cseq = 0;
+      client_seq::DropReason reason;
+      if (client_seq::decode_drop(data, len, event_sid, cseq, reason)) {
+        if (event_sid == sid) {
+          this->dropped(cseq);
+        }
+      } else if (client_seq::peek_event(data, len, event_sid, cseq) && event_sid == sid) {
+        this->ack(cseq);
+      }
+    });
+    ack_receiver_->start();
+  }
+
+  // Overrides the environment; call before sending
+  void enable_retransmit(const RetransmitConfig &config) {
+    stop_retransmit();
+    retransmit_ = config;
+    if (!config.enabled()) {
+      return;
+    }
+    size_t size = 1;
+    while (size < config.window) {
+      size <<= 1;
+    }
+    mask_ = size - 1;
+    pending_ = std::vector<Pending>(size);
+    copies_ = std::make_unique<uint8_t[]>(size * config.slot_bytes);
+    ShmMetrics &metrics = ShmMetrics::instance();
+    retransmits_ = metrics.counter(endpoint_metric("cmd", get_address(), get_port(), "retransmits"));
+    acked_ = metrics.counter(endpoint_metric("cmd", get_address(), get_port(), "acked"));
+    dropped_ = metrics.counter(endpoint_metric("cmd", get_address(), get_port(), "dropped by sequencer"));
+    oversized_ = metrics.counter(endpoint_metric("cmd", get_address(), get_port(), "oversized"));
+    abandoned_ = metrics.counter(endpoint_metric("cmd", get_address(), get_port(), "abandoned"));
+    unacked_ = metrics.gauge(endpoint_metric("cmd", get_address(), get_port(), "unacked"));
+    retransmit_running_ = true;
+    retransmit_thread_ = std::thread([this] { this->run_retransmit(); });
+  }
+
+  size_t get_unacked() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return outstanding_;
+  }
+
+private:
+  struct Pending {
+    uint64_t cseq = 0; // 0 when the slot is free
+    uint32_t attempts = 0;
+    uint32_t len = 0;
+    std::chrono::steady_clock::time_point sent_at;
+  };
+
+  // The slot's copy of the command, in the block allocated with the window
+  uint8_t *copy_of(const Pending &pending) {
+    return copies_.get() + static_cast<size_t>(&pending - pending_.data()) * retransmit_.slot_bytes;
+  }
+
+  void settle(uint64_t cseq, Metric &counter) {
+    if (!retransmit_.enabled() || cseq == 0) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    Pending &pending = pending_[cseq & mask_];
+    if (pending.cseq == cseq) {
+      pending.cseq = 0;
+      outstanding_--;
+      counter.add();
+      unacked_.set(outstanding_);
+    }
+  }
+
+  template <typename SendFn> bool numbered(SendBuffer &buf, SendFn &&send) {
+    if (!retransmit_.enabled()) {
+      return client_seq::stamp(buf, epoch_, next_cseq_.fetch_add(1)) && send(buf);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    const uint64_t cseq = next_cseq_.fetch_add(1);
+    if (!client_seq::stamp(buf, epoch_, cseq)) {
+      return false;
+    }
+    if (buf.size() > retransmit_.slot_bytes) {
+      oversized_.add();
+      return send(buf);
+    }
+    Pending &pending = pending_[cseq & mask_];
+    if (pending.cseq != 0) {
+      abandoned_.add();
+    } else {
+      outstanding_++;
+    }
+    pending.cseq = cseq;
+    pending.attempts = 0;
+    pending.len = static_cast<uint32_t>(buf.size());
+    pending.sent_at = std::chrono::steady_clock::now();
+    std::memcpy(copy_of(pending), buf.data(), buf.size());
+    unacked_.set(outstanding_);
+    return send(buf);
+  }
+
+  void run_retransmit() {
+    const auto tick = std::max(retransmit_.interval / 2, std::chrono::milliseconds(1));
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (retransmit_running_) {
+      wake_.wait_for(lock, tick);
+      const auto now = std::chrono::steady_clock::now();
+      for (Pending &pending : pending_) {
+        if (pending.cseq == 0 || now - pending.sent_at < retransmit_.interval) {
+          continue;
+        }
+        if (pending.attempts >= retransmit_.max_attempts) {
+          pending.cseq = 0;
+          outstanding_--;
+          abandoned_.add();
+          continue;
+        }
+        pending.attempts++;
+        pending.sent_at = now;
+        retransmits_.add();
+        this->send_m(copy_of(pending), pending.len);
+      }
+      unacked_.set(outstanding_);
+    }
+  }
+
+  void stop_retransmit() {
+    if (ack_receiver_) {
+      ack_receiver_->stop();
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      retransmit_running_ = false;
+    }
+    wake_.notify_all();
+    if (retransmit_thread_.joinable()) {
+      retransmit_thread_.join();
+    }
+  }
+
+  const uint64_t epoch_; // this process, stamped next to every cseq
+  std::atomic<uint64_t> next_cseq_;
+  RetransmitConfig retransmit_;
+  mutable std::mutex mutex_; // guards the pending window and serializes sends while retransmitting
+  std::condition_variable wake_;
+  std::vector<Pending> pending_; // indexed by cseq & mask_
+  std::unique_ptr<uint8_t[]> copies_; // slot_bytes per pending slot
+  size_t mask_ = 0;
+  size_t outstanding_ = 0;
+  bool retransmit_running_ = false;
+  std::thread retransmit_thread_;
+  std::unique_ptr<MulticastReceiver> ack_receiver_;
+  Metric retransmits_;
+  Metric acked_;
+  Metric dropped_;
+  Metric oversized_;
+  Metric abandoned_;
+  Metric unacked_;
 };
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <nmmintrin.h>
+#define TOYSEQ_CRC32C_X86 1
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define TOYSEQ_CRC32C_ARM 1
+#endif
+
+// CRC32C (Castagnoli) for payload hashing. Uses the SSE4.2 crc32 instruction (checked at runtime, so the build
+// needs no -msse4.2) or the ARMv8 CRC extension, eight bytes per instruction; otherwise a table-driven fallback.
+namespace crc32c {
+
+namespace detail {
+
+inline const std::array<uint32_t, 256> &table() {
+  static const std::array<uint32_t, 256> t = [] {
+    std::array<uint32_t, 256> out{};
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; ++k) {
+        c = (c & 1) ? (c >> 1) ^ 0x82F63B78u : c >> 1;
+      }
+      out[i] = c;
+    }
+    return out;
+  }();
+  return t;
+}
+
+inline uint32_t software(uint32_t crc, const uint8_t *data, size_t len) {
+  const auto &t = table();
+  for (size_t i = 0; i < len; ++i) {
+    crc = t[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+  }
+  return crc;
+}
+
+#if defined(TOYSEQ_CRC32C_X86)
+__attribute__((target("sse4.2"))) inline uint32_t hardware(uint32_t crc, const uint8_t *data, size_t len) {
+  uint64_t c = crc;
+  for (; len >= 8; data += 8, len -= 8) {
+    uint64_t word;
+    std::memcpy(&word, data, 8);
+    c = _mm_crc32_u64(c, word);
+  }
+  uint32_t c32 = static_cast<uint32_t>(c);
+  for (; len > 0; ++data, --len) {
+    c32 = _mm_crc32_u8(c32, *data);
+  }
+  return c32;
+}
+
+inline bool has_hardware() {
+  static const bool supported = __builtin_cpu_supports("sse4.2");
+  return supported;
+}
+#elif defined(TOYSEQ_CRC32C_ARM)
+inline uint32_t hardware(uint32_t crc, const uint8_t *data, size_t len) {
+  for (; len >= 8; data += 8, len -= 8) {
+    uint64_t word;
+    std::memcpy(&word, data, 8);
+    crc = __crc32cd(crc, word);
+  }
+  for (; len > 0; ++data, --len) {
+    crc = __crc32cb(crc, *data);
+  }
+  return crc;
+}
+
+inline bool has_hardware() { return true; }
+#endif
+
+} // namespace detail
+
+inline bool hardware_accelerated() {
+#if defined(TOYSEQ_CRC32C_X86) || defined(TOYSEQ_CRC32C_ARM)
+  return detail::has_hardware();
+#else
+  return false;
+#endif
+}
+
+inline uint32_t compute(const uint8_t *data, size_t len) {
+#if defined(TOYSEQ_CRC32C_X86) || defined(TOYSEQ_CRC32C_ARM)
+  if (detail::has_hardware()) {
+    return ~detail::hardware(~0u, data, len);
+  }
+#endif
+  return ~detail::software(~0u, data, len);
+}
+
+} // namespace crc32c
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstddef>
+
+// Size limits of the sequenced stream, shared by the sequencer and by everything that keeps copies of its traffic
+// (retransmit windows, the retransmission ring, the consumers' reorder buffer) so none of them holds less than the
+// sequencer can send
+namespace event_limits {
+
+constexpr size_t kCommandBytes = 2048;              // largest command the sequencer takes
+constexpr size_t kEventBytes = kCommandBytes + 256; // a full command plus the event fields or pass-through header
+
+} // namespace event_limits
@@ -1,14 +1,47 @@
 #pragma once
 
+#include "applications/adapters.hpp"
+#include "core/client_seq.hpp"
+#include "core/message_registry.hpp"
 #include "core/multicast_receiver.hpp"
+#include "core/multicast_sender.hpp"
+#include "core/parse_arena.hpp"
+#include "core/passthrough.hpp"
+#include "core/reorder_buffer.hpp"
+#include "core/retransmission.hpp"
+#include "core/shm_metrics.hpp"
+#include "core/wire_peek.hpp"
 #include "generated/messages.pb.h"
+#include <chrono>
 #include <cstdint>
+#include <cstdlib>
 #include <iostream>
+#include <memory>
 
+// Delivers events in seq order. Events that arrive ahead of the next expected seq wait in a pre-allocated
+// ReorderBuffer while the missing range is NACKed to the retransmission service (RETRANS_ADDR/RETRANS_PORT).
+// NACK retries run on incoming traffic and, while the stream is quiet, on the receiver's idle tick; once they
+// run out the gap is skipped and counted as lost. A sequencer restart, which numbers from 1 again, is told apart
+// from old seqs by the higher epoch its events carry.
 template <typename Derived> class EventReceiver : public MulticastReceiver {
 public:
   explicit EventReceiver(uint64_t instance_id, const std::string &multicast_address, uint16_t port)
-      : instance_id_(instance_id), MulticastReceiver(multicast_address, port) {}
+      : MulticastReceiver(multicast_address, port), instance_id_(instance_id), reorder_(reorder_config_from_env()) {
+    ShmMetrics &metrics = ShmMetrics::instance();
+    parse_failures_ = metrics.counter(endpoint_metric("rx", multicast_address, port, "parse failures"));
+    seq_high_water_ = metrics.gauge(endpoint_metric("rx", multicast_address, port, "seq high water"));
+    gap_lost_ = metrics.counter(endpoint_metric("rx", multicast_address, port, "seqs lost"));
+    reorder_depth_ = metrics.gauge(endpoint_metric("rx", multicast_address, port, "reorder depth"));
+    const char *nack_addr = std::getenv("RETRANS_ADDR");
+    const char *nack_port = std::getenv("RETRANS_PORT");
+    if (nack_addr && nack_addr[0] != '\0' && nack_port && nack_port[0] != '\0') {
+      nack_sender_ = std::make_unique<MulticastSender>(nack_addr, static_cast<uint16_t>(std::stoi(nack_port)), 1);
+    }
+    MulticastReceiver::set_idle_tick(nack_interval_from_env(), [this] { this->on_idle(); });
+    MulticastReceiver::set_seq_dedup(&EventReceiver::peek_seq);
+    MulticastReceiver::subscribe([this](const uint8_t *data, size_t len) { this->on_sequenced(data, len); });
+    MulticastReceiver::subscribe_batch([](const Datagram *, size_t) { ParseArena::local().reset(); });
+  }
 
   virtual ~EventReceiver() = default;
 
@@ -16,46 +49,249 @@ public:
 
   void stop() { MulticastReceiver::stop(); }
 
+  template <typename EventT> void subscribe() { subscribe<EventT>(MessageTypeOf<EventT>::value); }
+
   template <typename EventT> void subscribe(toysequencer::MessageType msg_type) {
-    MulticastReceiver::subscribe(
-        std::function<void(const uint8_t *data, size_t len)>([this, msg_type](const uint8_t *data, size_t len) {
-          // Peek at the first 4 bytes (protobuf varint for enum is
-          // usually 1 byte, but proto3 fields are fixed order)
-          // In our .proto, msg_type is field 1, which is a varint (enum), so it's the first field.
-          // We can parse the first byte(s) to extract the field 1 value.
-          // Protobuf wire format: <field_number << 3 | wire_type>, then value.
-          // For field 1 (msg_type), tag = 1 << 3 | 0 = 8 (0x08), then value (varint)
-          if (len >= 2 && data[0] == 0x08) { // 0x08 is the tag for field 1, varint
-            // read varint (should be 1 byte for our enum values)
-            uint8_t msg_type_val = data[1];
-            if (msg_type_val == static_cast<uint8_t>(msg_type)) {
-              on_datagram<EventT>(data, len);
-            }
-          }
-        }));
+    dispatch_table_.set(msg_type,
+                        [](EventReceiver *self, toysequencer::MessageType type, const uint8_t *data, size_t len) {
+                          if (passthrough::is_passthrough(data, len)) {
+                            self->template on_passthrough<EventT>(type, data, len);
+                          } else {
+                            self->template on_datagram<EventT>(data, len);
+                          }
+                        });
   }
 
   template <typename EventT> void on_datagram(const uint8_t *data, size_t len) {
     try {
-      EventT event;
-      expected_seq_++;
-      if (!event.ParseFromArray(data, static_cast<int>(len))) {
-        std::cerr << "Failed to parse event from datagram" << std::endl;
-        return;
-      }
+      with_message<EventT>([&](EventT &event) {
+        if (!event.ParseFromArray(data, static_cast<int>(len))) {
+          parse_failures_.add();
+          std::cerr << "Failed to parse event from datagram" << std::endl;
+          return;
+        }
 
-      dispatch_event(event);
+        dispatch_event(event);
+      });
+    } catch (const std::exception &e) {
+      std::cerr << "EventReceiver error: " << e.what() << std::endl;
+    }
+  }
 
+  // Rebuilds EventT from a pass-through frame: header fields plus the original command bytes
+  template <typename EventT> void on_passthrough(toysequencer::MessageType msg_type, const uint8_t *data, size_t len) {
+    passthrough::Header header;
+    if (!passthrough::read_header(data, len, header)) {
+      std::cerr << "Malformed pass-through frame" << std::endl;
+      return;
+    }
+    if (header.msg_type != static_cast<uint16_t>(msg_type)) {
+      return;
+    }
+    try {
+      using CommandT = typename adapters::EventAdapter<EventT>::command_type;
+      with_message<CommandT>([&](CommandT &command) {
+        if (!command.ParseFromArray(data + passthrough::kHeaderSize, static_cast<int>(header.payload_len))) {
+          parse_failures_.add();
+          std::cerr << "Failed to parse pass-through command payload" << std::endl;
+          return;
+        }
+        with_message<EventT>([&](EventT &event) {
+          typename adapters::EventAdapter<EventT>::adapter_type adapter;
+          adapter.fill_event(command, header.seq, command.sid(), header.timestamp, event);
+          event.set_epoch(header.epoch);
+          dispatch_event(event);
+        });
+      });
     } catch (const std::exception &e) {
       std::cerr << "EventReceiver error: " << e.what() << std::endl;
     }
   }
 
+  GapStats get_gap_stats() const { return reorder_.get_stats(); }
+
 protected:
   uint64_t get_instance_id() const { return instance_id_; }
   template <typename EventT> void dispatch_event(const EventT &ev) { static_cast<Derived *>(this)->on_event(ev); }
 
+  // Called for every drop notice on the stream (see client_seq.hpp); a Derived that sends numbered commands
+  // hides this to stop retransmitting the ones for its own sid
+  void on_command_dropped(uint64_t /*sid*/, uint64_t /*cseq*/) {}
+
 private:
-  uint64_t expected_seq_ = 1;
+  static bool peek_header(const uint8_t *data, size_t len, uint64_t &msg_type, uint64_t &seq) {
+    passthrough::Header header;
+    if (passthrough::read_header(data, len, header)) {
+      msg_type = header.msg_type;
+      seq = header.seq;
+      return true;
+    }
+    // Events carry msg_type as field 1 and seq as field 2
+    return peek_msg_type(data, len, msg_type) && wire::find_varint_field(data, len, 2, seq);
+  }
+
+  // The sequencer run an event belongs to; 0 if it does not say
+  static uint64_t peek_epoch(const uint8_t *data, size_t len) {
+    constexpr uint32_t kEpochField = 14; // TextEvent.epoch and TopOfBookEvent.epoch
+    passthrough::Header header;
+    if (passthrough::read_header(data, len, header)) {
+      return header.epoch;
+    }
+    uint64_t epoch = 0;
+    wire::find_varint_field(data, len, kEpochField, epoch);
+    return epoch;
+  }
+
+  static bool peek_seq(const uint8_t *data, size_t len, uint64_t &seq, uint64_t &epoch) {
+    if (client_seq::is_drop(data, len)) {
+      return false;
+    }
+    passthrough::Header header;
+    if (passthrough::read_header(data, len, header)) {
+      seq = header.seq;
+      epoch = header.epoch;
+      return true;
+    }
+    if (!wire::find_varint_field(data, len, 2, seq)) {
+      return false;
+    }
+    epoch = peek_epoch(data, len);
+    return true;
+  }
+
+  void deliver(const uint8_t *data, size_t len, uint64_t msg_type) {
+    dispatch_table_.dispatch(this, msg_type, data, len);
+  }
+
+  // EVENTS_NACK_INTERVAL_MS (default 20) between NACKs for one gap, EVENTS_NACK_RETRIES (default 5) before it
+  // is given up on, EVENTS_REORDER_MAX (default 1024) seqs held ahead of the next expected one
+  static std::chrono::milliseconds nack_interval_from_env() {
+    if (const char *ms = std::getenv("EVENTS_NACK_INTERVAL_MS")) {
+      long n = std::strtol(ms, nullptr, 10);
+      if (n > 0) {
+        return std::chrono::milliseconds(n);
+      }
+    }
+    return ReorderBuffer::Config{}.nack_interval;
+  }
+
+  static ReorderBuffer::Config reorder_config_from_env() {
+    ReorderBuffer::Config config;
+    config.nack_interval = nack_interval_from_env();
+    if (const char *retries = std::getenv("EVENTS_NACK_RETRIES")) {
+      long n = std::strtol(retries, nullptr, 10);
+      if (n >= 0) {
+        config.max_retries = static_cast<uint32_t>(n);
+      }
+    }
+    if (const char *reorder = std::getenv("EVENTS_REORDER_MAX")) {
+      long n = std::strtol(reorder, nullptr, 10);
+      if (n > 0) {
+        config.window = static_cast<size_t>(n);
+      }
+    }
+    return config;
+  }
+
+  // Runs on the receiver thread only
+  void on_sequenced(const uint8_t *data, size_t len) {
+    uint64_t sid = 0;
+    uint64_t cseq = 0;
+    client_seq::DropReason reason;
+    if (client_seq::decode_drop(data, len, sid, cseq, reason)) {
+      // Unsequenced: it takes no seq and is not reordered
+      static_cast<Derived *>(this)->on_command_dropped(sid, cseq);
+      return;
+    }
+    uint64_t msg_type = 0;
+    uint64_t seq = 0;
+    if (!peek_header(data, len, msg_type, seq) || !same_run(peek_epoch(data, len), seq)) {
+      return;
+    }
+    const size_t depth = reorder_.depth();
+    reorder_.offer(
+        seq, data, len, [this](const uint8_t *event, size_t event_len) { this->deliver_held(event, event_len); },
+        [this](uint64_t from_seq, uint64_t to_seq) { this->send_nack(from_seq, to_seq); });
+    seq_high_water_.set(reorder_.expected() - 1);
+    if (depth != 0 || reorder_.depth() != 0) {
+      update_gap_metrics();
+    }
+  }
+
+  // Follows the sequencer across restarts: once a higher epoch shows up numbering from below where this run had
+  // got to, what the old run left held is delivered and the reorder buffer rejoins at the new run's seqs. Events
+  // still in flight from an older run are dropped; one without an epoch counts as the current run.
+  bool same_run(uint64_t epoch, uint64_t seq) {
+    if (epoch == epoch_ || epoch == 0) {
+      return true;
+    }
+    if (epoch < epoch_) {
+      return false;
+    }
+    if (epoch_ != 0 && seq < reorder_.expected()) {
+      std::cerr << "EventReceiver sequencer restarted at seq " << seq << " while expecting " << reorder_.expected()
+                << std::endl;
+      reorder_.restart([this](const uint8_t *event, size_t event_len) { this->deliver_held(event, event_len); });
+      update_gap_metrics();
+    }
+    epoch_ = epoch;
+    return true;
+  }
+
+  // Quiet stream: the gap at the tail of the last burst still gets its NACK retries and give-up
+  void on_idle() {
+    if (reorder_.depth() == 0) {
+      return;
+    }
+    reorder_.tick([this](const uint8_t *event, size_t event_len) { this->deliver_held(event, event_len); },
+                  [this](uint64_t from_seq, uint64_t to_seq) { this->send_nack(from_seq, to_seq); });
+    update_gap_metrics();
+  }
+
+  void deliver_held(const uint8_t *data, size_t len) {
+    uint64_t msg_type = 0;
+    uint64_t seq = 0;
+    if (peek_header(data, len, msg_type, seq)) {
+      deliver(data, len, msg_type);
+    }
+  }
+
+  void update_gap_metrics() {
+    const uint64_t lost = reorder_.get_stats().lost;
+    if (lost != reported_lost_) {
+      std::cerr << "EventReceiver lost " << (lost - reported_lost_) << " seqs before " << reorder_.expected()
+                << std::endl;
+      gap_lost_.add(lost - reported_lost_);
+      reported_lost_ = lost;
+    }
+    if (reorder_.expected() != 0) {
+      seq_high_water_.set(reorder_.expected() - 1);
+    }
+    reorder_depth_.set(reorder_.depth());
+  }
+
+  void send_nack(uint64_t from_seq, uint64_t to_seq) {
+    if (!nack_sender_) {
+      return;
+    }
+    uint8_t buf[retransmission::kNackSize];
+    retransmission::encode_nack(retransmission::Nack{from_seq, to_seq, instance_id_}, buf);
+    // Straight out: nothing flushes this sender, so a batched enqueue would sit until the destructor
+    nack_sender_->send_m(buf, sizeof(buf));
+  }
+
   uint64_t instance_id_;
+
+  DispatchTable<EventReceiver> dispatch_table_;
+
+  // Sequencing state, touched only by the receiver thread
+  ReorderBuffer reorder_;
+  uint64_t epoch_ = 0; // current sequencer run; 0 until an event says
+  uint64_t reported_lost_ = 0;
+  std::unique_ptr<MulticastSender> nack_sender_;
+
+  Metric parse_failures_;
+  Metric seq_high_water_;
+  Metric gap_lost_;
+  Metric reorder_depth_;
 };
@@ -0,0 +1,242 @@
+#pragma once
+
+// Minimal io_uring wrapper over the raw syscalls (no liburing): one submission/completion ring pair plus
+// optional provided buffer rings. Single-threaded: the thread that owns the ring submits and reaps.
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#if defined(IORING_RECV_MULTISHOT)
+#define TOYSEQ_HAS_IO_URING 1
+#endif
+#endif
+#endif
+
+#if defined(TOYSEQ_HAS_IO_URING)
+
+#include <cerrno>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+class IoUring {
+public:
+  IoUring() = default;
+  IoUring(const IoUring &) = delete;
+  IoUring &operator=(const IoUring &) = delete;
+  ~IoUring() { close_ring(); }
+
+  // False if the kernel refuses (too old, io_uring disabled, seccomp); errno is left set
+  bool init(unsigned entries) {
+    io_uring_params params{};
+    fd_ = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (fd_ < 0) {
+      return false;
+    }
+    sq_ring_bytes_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cq_ring_bytes_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    single_mmap_ = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap_) {
+      sq_ring_bytes_ = cq_ring_bytes_ = sq_ring_bytes_ > cq_ring_bytes_ ? sq_ring_bytes_ : cq_ring_bytes_;
+    }
+    sq_ring_ = mmap(nullptr, sq_ring_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_,
+                    IORING_OFF_SQ_RING);
+    if (sq_ring_ == MAP_FAILED) {
+      sq_ring_ = nullptr;
+      close_ring();
+      return false;
+    }
+    if (single_mmap_) {
+      cq_ring_ = sq_ring_;
+    } else {
+      cq_ring_ = mmap(nullptr, cq_ring_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_,
+                      IORING_OFF_CQ_RING);
+      if (cq_ring_ == MAP_FAILED) {
+        cq_ring_ = nullptr;
+        close_ring();
+        return false;
+      }
+    }
+    sqes_bytes_ = params.sq_entries * sizeof(io_uring_sqe);
+    void *sqes = mmap(nullptr, sqes_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+      close_ring();
+      return false;
+    }
+    sqes_ = static_cast<io_uring_sqe *>(sqes);
+
+    auto *sq = static_cast<uint8_t *>(sq_ring_);
+    sq_head_ = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+    sq_tail_ = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+    sq_entries_ = params.sq_entries;
+    auto *cq = static_cast<uint8_t *>(cq_ring_);
+    cq_head_ = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+    ext_arg_ = (params.features & IORING_FEAT_EXT_ARG) != 0;
+    sqe_tail_ = *sq_tail_;
+    return true;
+  }
+
+  unsigned sq_entries() const { return sq_entries_; }
+
+  // A zeroed SQE, or nullptr if the submission queue is full
+  io_uring_sqe *get_sqe() {
+    const unsigned head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    if (sqe_tail_ - head >= sq_entries_) {
+      return nullptr;
+    }
+    const unsigned index = sqe_tail_ & sq_mask_;
+    io_uring_sqe *sqe = &sqes_[index];
+    std::memset(sqe, 0, sizeof(*sqe));
+    sq_array_[index] = index;
+    sqe_tail_++;
+    return sqe;
+  }
+
+  // Submits every SQE handed out that the kernel has not consumed yet, including any an interrupted or short
+  // earlier call left behind, and waits for at least wait_nr completions. A positive timeout bounds the wait
+  // (-ETIME when it expires). Returns SQEs consumed or -errno.
+  int submit_and_wait(unsigned wait_nr, long timeout_ns = 0) {
+    const unsigned to_submit = sqe_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    __atomic_store_n(sq_tail_, sqe_tail_, __ATOMIC_RELEASE);
+    unsigned flags = wait_nr > 0 ? IORING_ENTER_GETEVENTS : 0;
+    const void *arg = nullptr;
+    size_t arg_size = 0;
+    __kernel_timespec ts{};
+    io_uring_getevents_arg ext{};
+    if (wait_nr > 0 && timeout_ns > 0 && ext_arg_) {
+      ts.tv_sec = timeout_ns / 1000000000;
+      ts.tv_nsec = timeout_ns % 1000000000;
+      ext.sigmask = 0;
+      ext.sigmask_sz = _NSIG / 8;
+      ext.ts = reinterpret_cast<uint64_t>(&ts);
+      flags |= IORING_ENTER_EXT_ARG;
+      arg = &ext;
+      arg_size = sizeof(ext);
+    }
+    const long ret = syscall(__NR_io_uring_enter, fd_, to_submit, wait_nr, flags, arg, arg_size);
+    return ret < 0 ? -errno : static_cast<int>(ret);
+  }
+
+  io_uring_cqe *peek_cqe() {
+    const unsigned head = *cq_head_;
+    if (head == __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE)) {
+      return nullptr;
+    }
+    return &cqes_[head & cq_mask_];
+  }
+
+  void cqe_seen() { __atomic_store_n(cq_head_, *cq_head_ + 1, __ATOMIC_RELEASE); }
+
+  // Provided buffer ring `group` over `count` (power of two) buffers of `size` bytes starting at `base`, all
+  // handed to the kernel up front
+  bool setup_buf_ring(uint16_t group, uint8_t *base, unsigned count, unsigned size) {
+    const size_t bytes = count * sizeof(io_uring_buf);
+    void *mem = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) {
+      return false;
+    }
+    io_uring_buf_reg reg{};
+    reg.ring_addr = reinterpret_cast<uint64_t>(mem);
+    reg.ring_entries = count;
+    reg.bgid = group;
+    if (syscall(__NR_io_uring_register, fd_, IORING_REGISTER_PBUF_RING, &reg, 1) < 0) {
+      const int saved = errno;
+      munmap(mem, bytes);
+      errno = saved;
+      return false;
+    }
+    buf_ring_ = static_cast<io_uring_buf_ring *>(mem);
+    // Not buf_ring_->bufs: in C++ the flex-array macro in the kernel header puts it 8 bytes into the ring
+    bufs_ = static_cast<io_uring_buf *>(mem);
+    buf_ring_bytes_ = bytes;
+    buf_mask_ = count - 1;
+    buf_base_ = base;
+    buf_size_ = size;
+    buf_tail_ = 0;
+    for (unsigned bid = 0; bid < count; ++bid) {
+      add_buf(static_cast<uint16_t>(bid));
+    }
+    commit_bufs();
+    return true;
+  }
+
+  uint8_t *buf(uint16_t bid) const { return buf_base_ + static_cast<size_t>(bid) * buf_size_; }
+
+  // Hands a buffer back to the kernel; visible once commit_bufs() runs
+  void add_buf(uint16_t bid) {
+    io_uring_buf &b = bufs_[buf_tail_ & buf_mask_];
+    b.addr = reinterpret_cast<uint64_t>(buf(bid));
+    b.len = buf_size_;
+    b.bid = bid;
+    buf_tail_++;
+  }
+
+  void commit_bufs() { __atomic_store_n(&buf_ring_->tail, buf_tail_, __ATOMIC_RELEASE); }
+
+private:
+  void close_ring() {
+    if (buf_ring_ != nullptr) {
+      munmap(buf_ring_, buf_ring_bytes_);
+      buf_ring_ = nullptr;
+      bufs_ = nullptr;
+    }
+    if (sqes_ != nullptr) {
+      munmap(sqes_, sqes_bytes_);
+      sqes_ = nullptr;
+    }
+    if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+      munmap(cq_ring_, cq_ring_bytes_);
+    }
+    cq_ring_ = nullptr;
+    if (sq_ring_ != nullptr) {
+      munmap(sq_ring_, sq_ring_bytes_);
+      sq_ring_ = nullptr;
+    }
+    if (fd_ >= 0) {
+      ::close(fd_);
+      fd_ = -1;
+    }
+  }
+
+  int fd_ = -1;
+  bool single_mmap_ = false;
+  bool ext_arg_ = false;
+  void *sq_ring_ = nullptr;
+  void *cq_ring_ = nullptr;
+  size_t sq_ring_bytes_ = 0;
+  size_t cq_ring_bytes_ = 0;
+  size_t sqes_bytes_ = 0;
+
+  io_uring_sqe *sqes_ = nullptr;
+  unsigned *sq_head_ = nullptr;
+  unsigned *sq_tail_ = nullptr;
+  unsigned *sq_array_ = nullptr;
+  unsigned sq_mask_ = 0;
+  unsigned sq_entries_ = 0;
+  unsigned sqe_tail_ = 0; // SQEs handed out; published to *sq_tail_ on submit
+
+  io_uring_cqe *cqes_ = nullptr;
+  unsigned *cq_head_ = nullptr;
+  unsigned *cq_tail_ = nullptr;
+  unsigned cq_mask_ = 0;
+
+  io_uring_buf_ring *buf_ring_ = nullptr;
+  io_uring_buf *bufs_ = nullptr;
+  size_t buf_ring_bytes_ = 0;
+  unsigned buf_mask_ = 0;
+  uint8_t *buf_base_ = nullptr;
+  unsigned buf_size_ = 0;
+  uint16_t buf_tail_ = 0;
+};
+
+#endif
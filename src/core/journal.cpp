@@ -0,0 +1,361 @@
+#include "journal.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr size_t kRecordHeaderBytes = 16;
+
+struct RecordHeader {
+  uint32_t length;
+  uint32_t checksum;
+  uint64_t seq;
+};
+static_assert(sizeof(RecordHeader) == kRecordHeaderBytes, "journal record header must be 16 bytes");
+
+size_t record_size(size_t payload_len) { return (kRecordHeaderBytes + payload_len + 7) & ~static_cast<size_t>(7); }
+
+// 32-bit FNV-1a over seq and payload; enough to reject torn records on recovery
+uint32_t record_checksum(uint64_t seq, const uint8_t *data, size_t len) {
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < sizeof(seq); ++i) {
+    h ^= static_cast<uint8_t>(seq >> (8 * i));
+    h *= 16777619u;
+  }
+  for (size_t i = 0; i < len; ++i) {
+    h ^= data[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+size_t page_size() {
+  static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return size;
+}
+
+} // namespace
+
+JournalConfig JournalConfig::from_env() {
+  JournalConfig config;
+  if (const char *dir = std::getenv("SEQ_JOURNAL_DIR")) {
+    config.directory = dir;
+  }
+  if (const char *durability = std::getenv("SEQ_JOURNAL_DURABILITY")) {
+    const std::string mode(durability);
+    if (mode == "group") {
+      config.durability = JournalDurability::GroupCommit;
+    } else if (mode == "sync") {
+      config.durability = JournalDurability::Sync;
+    } else {
+      config.durability = JournalDurability::None;
+    }
+  }
+  if (const char *events = std::getenv("SEQ_JOURNAL_GROUP_EVENTS")) {
+    long n = std::strtol(events, nullptr, 10);
+    if (n > 0) {
+      config.group_commit_events = static_cast<uint64_t>(n);
+    }
+  }
+  if (const char *us = std::getenv("SEQ_JOURNAL_GROUP_US")) {
+    long n = std::strtol(us, nullptr, 10);
+    if (n > 0) {
+      config.group_commit_interval = std::chrono::microseconds(n);
+    }
+  }
+  if (const char *mb = std::getenv("SEQ_JOURNAL_SEGMENT_MB")) {
+    long n = std::strtol(mb, nullptr, 10);
+    if (n > 0) {
+      config.segment_bytes = static_cast<size_t>(n) * 1024 * 1024;
+    }
+  }
+  return config;
+}
+
+Journal::Journal(JournalConfig config) : config_(std::move(config)) {
+  if (config_.directory.empty()) {
+    throw std::invalid_argument("Journal directory must not be empty");
+  }
+  config_.segment_bytes = std::max(config_.segment_bytes, page_size());
+  std::filesystem::create_directories(config_.directory);
+
+  recover();
+  background_ = std::thread([this] { this->background_loop(); });
+}
+
+Journal::~Journal() {
+  running_.store(false);
+  wake_.notify_one();
+  if (background_.joinable()) {
+    background_.join();
+  }
+
+  if (Segment *retired = retired_.exchange(nullptr)) {
+    close_segment(retired);
+  }
+  if (Segment *standby = standby_.exchange(nullptr)) {
+    close_segment(standby);
+  }
+  if (Segment *current = current_.exchange(nullptr)) {
+    close_segment(current);
+  }
+}
+
+std::string Journal::segment_path(uint64_t index) const {
+  char name[32];
+  std::snprintf(name, sizeof(name), "journal-%08llu.seg", static_cast<unsigned long long>(index));
+  return (std::filesystem::path(config_.directory) / name).string();
+}
+
+std::unique_ptr<Journal::Segment> Journal::open_segment(uint64_t index, bool create) {
+  const std::string path = segment_path(index);
+  int fd = ::open(path.c_str(), O_RDWR | (create ? O_CREAT : 0), 0644);
+  if (fd < 0) {
+    throw std::runtime_error("Failed to open journal segment " + path);
+  }
+
+  struct stat st {};
+  if (fstat(fd, &st) != 0) {
+    ::close(fd);
+    throw std::runtime_error("Failed to stat journal segment " + path);
+  }
+  size_t size = static_cast<size_t>(st.st_size);
+  if (size < config_.segment_bytes) {
+    size = config_.segment_bytes;
+#if defined(__linux__)
+    if (posix_fallocate(fd, 0, static_cast<off_t>(size)) != 0 && ftruncate(fd, static_cast<off_t>(size)) != 0) {
+#else
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+#endif
+      ::close(fd);
+      throw std::runtime_error("Failed to preallocate journal segment " + path);
+    }
+  }
+
+  int flags = MAP_SHARED;
+#if defined(MAP_POPULATE)
+  // fault the pages in now, off the append path
+  flags |= MAP_POPULATE;
+#endif
+  void *base = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, fd, 0);
+  if (base == MAP_FAILED) {
+    ::close(fd);
+    throw std::runtime_error("Failed to mmap journal segment " + path);
+  }
+
+  auto segment = std::make_unique<Segment>();
+  segment->index = index;
+  segment->fd = fd;
+  segment->base = static_cast<uint8_t *>(base);
+  segment->size = size;
+  return segment;
+}
+
+void Journal::close_segment(Segment *segment) {
+  if (config_.durability != JournalDurability::None) {
+    sync_range(segment, segment->synced, segment->written.load(std::memory_order_acquire));
+  }
+  munmap(segment->base, segment->size);
+  ::close(segment->fd);
+  delete segment;
+}
+
+void Journal::sync_range(Segment *segment, size_t from, size_t to) {
+  if (to <= from) {
+    return;
+  }
+  const size_t start = from & ~(page_size() - 1);
+  if (msync(segment->base + start, to - start, MS_SYNC) != 0) {
+    std::cerr << "Journal msync failed: " << std::strerror(errno) << std::endl;
+    return;
+  }
+  stat_syncs_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Journal::recover() {
+  std::vector<uint64_t> indices;
+  for (const auto &entry : std::filesystem::directory_iterator(config_.directory)) {
+    unsigned long long index = 0;
+    if (std::sscanf(entry.path().filename().string().c_str(), "journal-%llu.seg", &index) == 1) {
+      indices.push_back(index);
+    }
+  }
+  std::sort(indices.begin(), indices.end());
+
+  if (indices.empty()) {
+    current_.store(open_segment(0, true).release());
+    next_index_.store(1);
+    return;
+  }
+
+  // Scan backwards so an empty, preallocated tail segment still recovers the seq from its predecessor
+  Segment *tail = nullptr;
+  for (auto it = indices.rbegin(); it != indices.rend(); ++it) {
+    auto segment = open_segment(*it, false);
+    size_t offset = 0;
+    uint64_t seg_last_seq = 0;
+    while (offset + kRecordHeaderBytes <= segment->size) {
+      RecordHeader header;
+      std::memcpy(&header, segment->base + offset, sizeof(header));
+      if (header.length == 0 || offset + record_size(header.length) > segment->size ||
+          header.checksum !=
+              record_checksum(header.seq, segment->base + offset + kRecordHeaderBytes, header.length)) {
+        break;
+      }
+      seg_last_seq = header.seq;
+      offset += record_size(header.length);
+    }
+
+    if (tail == nullptr) {
+      segment->written.store(offset);
+      segment->synced = offset;
+      tail = segment.release();
+    } else {
+      close_segment(segment.release());
+    }
+    if (seg_last_seq != 0) {
+      last_seq_ = seg_last_seq;
+      break;
+    }
+  }
+
+  current_.store(tail);
+  next_index_.store(indices.back() + 1);
+}
+
+bool Journal::append(uint64_t seq, const uint8_t *data, size_t len) {
+  const size_t need = record_size(len);
+  Segment *segment = current_.load(std::memory_order_relaxed);
+  size_t offset = segment->written.load(std::memory_order_relaxed);
+
+  if (offset + need > segment->size) {
+    if (need > config_.segment_bytes || !roll()) {
+      return false;
+    }
+    segment = current_.load(std::memory_order_relaxed);
+    offset = 0;
+  }
+
+  uint8_t *record = segment->base + offset;
+  std::memcpy(record + kRecordHeaderBytes, data, len);
+  RecordHeader header{static_cast<uint32_t>(len), record_checksum(seq, data, len), seq};
+  // length goes in last so a torn header reads as end-of-segment
+  std::memcpy(record + 4, &header.checksum, sizeof(header.checksum) + sizeof(header.seq));
+  std::memcpy(record, &header.length, sizeof(header.length));
+  segment->written.store(offset + need, std::memory_order_release);
+
+  last_seq_ = seq;
+  stat_appends_.store(stat_appends_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  stat_bytes_.store(stat_bytes_.load(std::memory_order_relaxed) + need, std::memory_order_relaxed);
+
+  if (config_.durability == JournalDurability::Sync) {
+    sync_range(segment, offset, offset + need);
+  } else if (config_.durability == JournalDurability::GroupCommit &&
+             ++appends_since_commit_ >= config_.group_commit_events) {
+    appends_since_commit_ = 0;
+    commit_requested_.store(true, std::memory_order_release);
+    wake_.notify_one();
+  }
+  return true;
+}
+
+bool Journal::roll() {
+  const uint64_t index = next_index_.load(std::memory_order_relaxed);
+  Segment *next = standby_.exchange(nullptr, std::memory_order_acq_rel);
+  if (next != nullptr && next->index != index) {
+    // prepared for an index an earlier inline roll already took; its file is in use, only the mapping goes
+    close_segment(next);
+    next = nullptr;
+  }
+  if (next == nullptr) {
+    // background thread has not caught up; create the segment here
+    try {
+      next = open_segment(index, true).release();
+    } catch (const std::exception &e) {
+      std::cerr << "Journal roll failed: " << e.what() << std::endl;
+      return false;
+    }
+    stat_inline_rolls_.fetch_add(1, std::memory_order_relaxed);
+  }
+  next_index_.store(index + 1, std::memory_order_release);
+
+  Segment *old = current_.exchange(next, std::memory_order_acq_rel);
+  Segment *expected = nullptr;
+  while (!retired_.compare_exchange_weak(expected, old, std::memory_order_acq_rel)) {
+    // the previous retired segment is still being closed
+    expected = nullptr;
+    wake_.notify_one();
+    std::this_thread::yield();
+  }
+  stat_rolls_.fetch_add(1, std::memory_order_relaxed);
+  wake_.notify_one();
+  return true;
+}
+
+void Journal::sync() {
+  Segment *segment = current_.load(std::memory_order_acquire);
+  if (segment != nullptr) {
+    sync_range(segment, 0, segment->written.load(std::memory_order_acquire));
+  }
+}
+
+JournalStats Journal::get_stats() const {
+  JournalStats stats;
+  stats.appends = stat_appends_.load(std::memory_order_relaxed);
+  stats.bytes = stat_bytes_.load(std::memory_order_relaxed);
+  stats.segments_rolled = stat_rolls_.load(std::memory_order_relaxed);
+  stats.inline_rolls = stat_inline_rolls_.load(std::memory_order_relaxed);
+  stats.syncs = stat_syncs_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void Journal::background_loop() {
+  const auto idle_wait = config_.durability == JournalDurability::GroupCommit ? config_.group_commit_interval
+                                                                               : std::chrono::microseconds(10000);
+  while (running_.load()) {
+    {
+      std::unique_lock<std::mutex> lock(wake_mutex_);
+      wake_.wait_for(lock, idle_wait, [this] {
+        return !running_.load() || commit_requested_.load(std::memory_order_acquire) ||
+               retired_.load(std::memory_order_acquire) != nullptr ||
+               standby_.load(std::memory_order_acquire) == nullptr;
+      });
+    }
+
+    if (Segment *retired = retired_.exchange(nullptr, std::memory_order_acq_rel)) {
+      close_segment(retired);
+    }
+
+    if (standby_.load(std::memory_order_acquire) == nullptr) {
+      const uint64_t index = next_index_.load(std::memory_order_acquire);
+      if (config_.prepare_delay.count() > 0) {
+        std::this_thread::sleep_for(config_.prepare_delay);
+      }
+      try {
+        standby_.store(open_segment(index, true).release(), std::memory_order_release);
+      } catch (const std::exception &e) {
+        std::cerr << "Journal failed to prepare segment: " << e.what() << std::endl;
+      }
+    }
+
+    if (config_.durability == JournalDurability::GroupCommit) {
+      commit_requested_.store(false, std::memory_order_relaxed);
+      Segment *segment = current_.load(std::memory_order_acquire);
+      const size_t written = segment->written.load(std::memory_order_acquire);
+      sync_range(segment, segment->synced, written);
+      segment->synced = written;
+    }
+  }
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+enum class JournalDurability {
+  None,        // rely on the page cache, never msync
+  GroupCommit, // background msync every group_commit_events appends or group_commit_interval, whichever first
+  Sync,        // msync(MS_SYNC) the written range before append() returns
+};
+
+struct JournalConfig {
+  std::string directory;
+  size_t segment_bytes = 64 * 1024 * 1024;
+  JournalDurability durability = JournalDurability::None;
+  uint64_t group_commit_events = 1024;
+  std::chrono::microseconds group_commit_interval{1000};
+  // Stalls the background thread between picking a standby segment's index and creating it, as a slow
+  // fallocate would, so tests can race it against inline rolls
+  std::chrono::microseconds prepare_delay{0};
+
+  // SEQ_JOURNAL_DIR, SEQ_JOURNAL_DURABILITY (none|group|sync), SEQ_JOURNAL_GROUP_EVENTS, SEQ_JOURNAL_GROUP_US,
+  // SEQ_JOURNAL_SEGMENT_MB; an empty directory means journaling is disabled
+  static JournalConfig from_env();
+};
+
+struct JournalStats {
+  uint64_t appends = 0;
+  uint64_t bytes = 0;
+  uint64_t segments_rolled = 0;
+  uint64_t inline_rolls = 0; // rolls that had to create the next segment on the append path
+  uint64_t syncs = 0;
+};
+
+// Append-only event journal over preallocated, mmap'd segment files named journal-<index>.seg.
+//
+// Each record is a 16-byte header {length, checksum, seq} followed by the payload, padded to 8 bytes. A zero
+// length marks the end of a segment. append() is meant for a single writer thread and only touches mapped
+// memory; a background thread prepares the next segment, retires full ones and runs group commits.
+class Journal {
+public:
+  explicit Journal(JournalConfig config);
+  ~Journal();
+
+  Journal(const Journal &) = delete;
+  Journal &operator=(const Journal &) = delete;
+
+  bool append(uint64_t seq, const uint8_t *data, size_t len);
+
+  // Highest seq found on recovery or appended since; 0 if the journal is empty
+  uint64_t last_seq() const { return last_seq_; }
+
+  void sync();
+
+  JournalStats get_stats() const;
+  const JournalConfig &get_config() const { return config_; }
+
+private:
+  struct Segment {
+    uint64_t index = 0;
+    int fd = -1;
+    uint8_t *base = nullptr;
+    size_t size = 0;
+    std::atomic<size_t> written{0};
+    size_t synced = 0;
+  };
+
+  std::unique_ptr<Segment> open_segment(uint64_t index, bool create);
+  void close_segment(Segment *segment);
+  void sync_range(Segment *segment, size_t from, size_t to);
+  void recover();
+  bool roll();
+  void background_loop();
+
+  std::string segment_path(uint64_t index) const;
+
+  JournalConfig config_;
+  uint64_t last_seq_ = 0;
+
+  // Owned by the writer; the background thread only reads `written` and frees retired segments
+  std::atomic<Segment *> current_{nullptr};
+  std::atomic<Segment *> standby_{nullptr};
+  std::atomic<Segment *> retired_{nullptr};
+  // Index of the segment after current_. Only the writer advances it; the background thread prepares the
+  // standby for whatever it reads, and roll() discards a standby that an inline roll has overtaken.
+  std::atomic<uint64_t> next_index_{0};
+
+  uint64_t appends_since_commit_ = 0;
+  std::atomic<bool> commit_requested_{false};
+
+  std::atomic<uint64_t> stat_appends_{0};
+  std::atomic<uint64_t> stat_bytes_{0};
+  std::atomic<uint64_t> stat_rolls_{0};
+  std::atomic<uint64_t> stat_inline_rolls_{0};
+  std::atomic<uint64_t> stat_syncs_{0};
+
+  std::atomic<bool> running_{true};
+  std::mutex wake_mutex_;
+  std::condition_variable wake_;
+  std::thread background_;
+};
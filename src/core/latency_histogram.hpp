@@ -0,0 +1,142 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace latency {
+
+// LATENCY_STATS=1 turns the per-stage instrumentation on; off, every probe is a single relaxed load
+inline std::atomic<bool> &enabled_flag() {
+  static std::atomic<bool> flag{[] {
+    const char *env = std::getenv("LATENCY_STATS");
+    return env && env[0] == '1';
+  }()};
+  return flag;
+}
+
+inline bool enabled() { return enabled_flag().load(std::memory_order_relaxed); }
+inline void set_enabled(bool on) { enabled_flag().store(on, std::memory_order_relaxed); }
+
+inline uint64_t now_ns() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+inline unsigned highest_bit(uint64_t v) {
+#ifdef _MSC_VER
+  unsigned long index;
+  _BitScanReverse64(&index, v);
+  return static_cast<unsigned>(index);
+#else
+  return 63u - static_cast<unsigned>(__builtin_clzll(v));
+#endif
+}
+
+} // namespace latency
+
+struct LatencySnapshot;
+
+// Log-linear (HDR-style) histogram of nanosecond values: exact below 32, then 32 linear sub-buckets per
+// power of two, so any recorded value is reported within ~3%. Covers the full uint64_t range in 1920 buckets.
+//
+// record() is single-writer (plain relaxed load/store, no locked instruction); snapshot() may run concurrently
+// from any thread and sees a slightly torn but monotonic view.
+class LatencyHistogram {
+public:
+  static constexpr unsigned kSubBucketBits = 5;
+  static constexpr uint64_t kSubBuckets = 1ull << kSubBucketBits;
+  static constexpr size_t kBuckets = (64 - kSubBucketBits + 1) * kSubBuckets;
+
+  static size_t index_of(uint64_t value) {
+    if (value < kSubBuckets) {
+      return static_cast<size_t>(value);
+    }
+    const unsigned shift = latency::highest_bit(value) - kSubBucketBits;
+    return static_cast<size_t>((shift + 1) * kSubBuckets + ((value >> shift) - kSubBuckets));
+  }
+
+  // Largest value that maps to bucket `index`
+  static uint64_t upper_bound_of(size_t index) {
+    if (index < kSubBuckets) {
+      return index;
+    }
+    const unsigned shift = static_cast<unsigned>(index / kSubBuckets - 1);
+    const uint64_t base = (kSubBuckets + index % kSubBuckets) << shift;
+    return base + ((1ull << shift) - 1);
+  }
+
+  void record(uint64_t value_ns) {
+    bump(counts_[index_of(value_ns)], 1);
+    bump(count_, 1);
+    bump(sum_, value_ns);
+    if (value_ns > max_.load(std::memory_order_relaxed)) {
+      max_.store(value_ns, std::memory_order_relaxed);
+    }
+  }
+
+  // Records now - start_ns for a start taken with latency::now_ns()
+  void record_since(uint64_t start_ns) { record(latency::now_ns() - start_ns); }
+
+  LatencySnapshot snapshot() const;
+
+private:
+  static void bump(std::atomic<uint64_t> &counter, uint64_t by) {
+    counter.store(counter.load(std::memory_order_relaxed) + by, std::memory_order_relaxed);
+  }
+
+  std::array<std::atomic<uint64_t>, kBuckets> counts_{};
+  std::atomic<uint64_t> count_{0};
+  std::atomic<uint64_t> sum_{0};
+  std::atomic<uint64_t> max_{0};
+};
+
+struct LatencySnapshot {
+  std::array<uint64_t, LatencyHistogram::kBuckets> counts{};
+  uint64_t count = 0;
+  uint64_t sum = 0;
+  uint64_t max = 0;
+
+  double mean() const { return count == 0 ? 0.0 : static_cast<double>(sum) / count; }
+
+  // Upper edge of the bucket holding the q-th quantile (0 < q <= 1), capped at the recorded max
+  uint64_t percentile(double q) const {
+    uint64_t total = 0;
+    for (uint64_t c : counts) {
+      total += c;
+    }
+    if (total == 0) {
+      return 0;
+    }
+    uint64_t rank = static_cast<uint64_t>(q * static_cast<double>(total) + 0.5);
+    rank = rank == 0 ? 1 : (rank > total ? total : rank);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < counts.size(); ++i) {
+      seen += counts[i];
+      if (seen >= rank) {
+        const uint64_t edge = LatencyHistogram::upper_bound_of(i);
+        return edge < max ? edge : max;
+      }
+    }
+    return max;
+  }
+};
+
+inline LatencySnapshot LatencyHistogram::snapshot() const {
+  LatencySnapshot snap;
+  for (size_t i = 0; i < kBuckets; ++i) {
+    snap.counts[i] = counts_[i].load(std::memory_order_relaxed);
+  }
+  snap.count = count_.load(std::memory_order_relaxed);
+  snap.sum = sum_.load(std::memory_order_relaxed);
+  snap.max = max_.load(std::memory_order_relaxed);
+  return snap;
+}
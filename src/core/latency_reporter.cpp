@@ -0,0 +1,52 @@
+#include "latency_reporter.hpp"
+#include <iostream>
+
+void LatencyReporter::start(std::chrono::seconds interval) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (running_) {
+    return;
+  }
+  running_ = true;
+  thread_ = std::thread([this, interval] { run(interval); });
+}
+
+void LatencyReporter::stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+  }
+  cv_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void LatencyReporter::dump(std::ostream &out) const {
+  for (const Stage &stage : stages_) {
+    const LatencySnapshot snap = stage.histogram->snapshot();
+    out << name_ << " latency " << stage.name << ": count=" << snap.count << " p50=" << snap.percentile(0.50)
+        << "ns p99=" << snap.percentile(0.99) << "ns p99.9=" << snap.percentile(0.999) << "ns max=" << snap.max
+        << "ns mean=" << static_cast<uint64_t>(snap.mean()) << "ns" << std::endl;
+  }
+}
+
+void LatencyReporter::run(std::chrono::seconds interval) {
+  // Poll often enough that a SIGUSR1 dump appears promptly
+  constexpr std::chrono::milliseconds kPoll{100};
+  auto next_dump = std::chrono::steady_clock::now() + interval;
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (running_) {
+    cv_.wait_for(lock, kPoll);
+    if (!running_) {
+      break;
+    }
+    const bool requested = dump_requested().exchange(false, std::memory_order_relaxed);
+    const bool due = interval.count() > 0 && std::chrono::steady_clock::now() >= next_dump;
+    if (requested || due) {
+      dump(std::cout);
+      if (due) {
+        next_dump += interval;
+      }
+    }
+  }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "core/latency_histogram.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Prints p50/p99/p99.9/max for a set of named stage histograms, every `interval` and whenever request_dump()
+// is called (e.g. from a SIGUSR1 handler). Histograms are cumulative since process start.
+class LatencyReporter {
+public:
+  explicit LatencyReporter(std::string name) : name_(std::move(name)) {}
+  ~LatencyReporter() { stop(); }
+
+  LatencyReporter(const LatencyReporter &) = delete;
+  LatencyReporter &operator=(const LatencyReporter &) = delete;
+
+  // Register stages before start(); the histograms must outlive the reporter
+  void add(const std::string &stage, const LatencyHistogram &histogram) { stages_.push_back({stage, &histogram}); }
+
+  // A zero interval dumps only on request
+  void start(std::chrono::seconds interval);
+  void stop();
+
+  void dump(std::ostream &out) const;
+
+  // Async-signal-safe: only sets a flag that the reporter thread polls
+  static void request_dump() { dump_requested().store(true, std::memory_order_relaxed); }
+
+private:
+  struct Stage {
+    std::string name;
+    const LatencyHistogram *histogram;
+  };
+
+  static std::atomic<bool> &dump_requested() {
+    static std::atomic<bool> flag{false};
+    return flag;
+  }
+
+  void run(std::chrono::seconds interval);
+
+  std::string name_;
+  std::vector<Stage> stages_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool running_ = false;
+  std::thread thread_;
+};
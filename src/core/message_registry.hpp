@@ -0,0 +1,62 @@
+#pragma once
+
+#include "core/wire_peek.hpp"
+#include "generated/messages.pb.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Compile-time mapping from generated message classes to their toysequencer::MessageType
+template <typename MessageT> struct MessageTypeOf;
+
+template <> struct MessageTypeOf<toysequencer::TextCommand> {
+  static constexpr toysequencer::MessageType value = toysequencer::TEXT_COMMAND;
+};
+template <> struct MessageTypeOf<toysequencer::TextEvent> {
+  static constexpr toysequencer::MessageType value = toysequencer::TEXT_EVENT;
+};
+template <> struct MessageTypeOf<toysequencer::TopOfBookCommand> {
+  static constexpr toysequencer::MessageType value = toysequencer::TOB_COMMAND;
+};
+template <> struct MessageTypeOf<toysequencer::TopOfBookEvent> {
+  static constexpr toysequencer::MessageType value = toysequencer::TOB_EVENT;
+};
+
+// Reads msg_type (field 1, a varint that every message in messages.proto leads with); handles multi-byte
+// varints, so enum values of 128 and above work
+inline bool peek_msg_type(const uint8_t *data, size_t len, uint64_t &msg_type) {
+  return wire::find_varint_field(data, len, 1, msg_type);
+}
+
+// Dense table indexed by MessageType: one bounds check and one indirect call per datagram, however many types
+// are registered. Entries are atomics so types can be registered while the receive thread is running.
+template <typename Context> class DispatchTable {
+public:
+  using Fn = void (*)(Context *ctx, toysequencer::MessageType msg_type, const uint8_t *data, size_t len);
+
+  static constexpr size_t kSize = static_cast<size_t>(toysequencer::MessageType_ARRAYSIZE);
+
+  void set(toysequencer::MessageType msg_type, Fn fn) {
+    const auto index = static_cast<size_t>(msg_type);
+    if (index < kSize) {
+      table_[index].store(fn, std::memory_order_release);
+    }
+  }
+
+  // Returns false if msg_type is out of range or has no handler
+  bool dispatch(Context *ctx, uint64_t msg_type, const uint8_t *data, size_t len) const {
+    if (msg_type >= kSize) {
+      return false;
+    }
+    Fn fn = table_[msg_type].load(std::memory_order_acquire);
+    if (fn == nullptr) {
+      return false;
+    }
+    fn(ctx, static_cast<toysequencer::MessageType>(msg_type), data, len);
+    return true;
+  }
+
+private:
+  std::array<std::atomic<Fn>, kSize> table_{};
+};
@@ -1,15 +1,76 @@
 #include "multicast_receiver.hpp"
+#include "core/crc32c.hpp"
+#include "core/io_uring.hpp"
+#include "core/shm_ring.hpp"
+#include "utils/thread_utils.hpp"
+#include <algorithm>
+#include <cerrno>
 #include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
 #include <stdexcept>
 
-MulticastReceiver::MulticastReceiver(const std::string &multicast_address, uint16_t port)
-    : multicast_address_(multicast_address), port_(port) {}
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/uio.h>
+#include <time.h>
+#endif
+
+MulticastReceiver::MulticastReceiver(const std::string &multicast_address, uint16_t port, Transport transport)
+    : multicast_address_(multicast_address), port_(port), transport_(transport) {
+  ShmMetrics &metrics = ShmMetrics::instance();
+  rx_datagrams_ = metrics.counter(endpoint_metric("rx", multicast_address_, port_, "datagrams"));
+  rx_bytes_ = metrics.counter(endpoint_metric("rx", multicast_address_, port_, "bytes"));
+  rx_dedup_drops_ = metrics.counter(endpoint_metric("rx", multicast_address_, port_, "dedup drops"));
+}
 
 MulticastReceiver::~MulticastReceiver() { stop(); }
 
-void MulticastReceiver::subscribe(DatagramHandler handler) {
-  std::lock_guard<std::mutex> lock(handlers_mutex_);
-  handlers_.push_back(std::move(handler));
+MulticastReceiver::SubscriptionId MulticastReceiver::subscribe(DatagramHandler handler) {
+  const SubscriptionId id = next_subscription_id_.fetch_add(1);
+  handlers_.update([&](auto &handlers) { handlers.push_back({id, std::move(handler)}); });
+  return id;
+}
+
+MulticastReceiver::SubscriptionId MulticastReceiver::subscribe_batch(BatchHandler handler) {
+  const SubscriptionId id = next_subscription_id_.fetch_add(1);
+  batch_handlers_.update([&](auto &handlers) { handlers.push_back({id, std::move(handler)}); });
+  return id;
+}
+
+void MulticastReceiver::unsubscribe(SubscriptionId id) {
+  auto erase_id = [id](auto &handlers) {
+    handlers.erase(std::remove_if(handlers.begin(), handlers.end(), [id](const auto &s) { return s.id == id; }),
+                   handlers.end());
+  };
+  handlers_.update(erase_id);
+  batch_handlers_.update(erase_id);
+}
+
+void MulticastReceiver::set_batch_size(size_t batch_size) {
+  if (running_.load()) {
+    throw std::logic_error("Batch size must be configured before start()");
+  }
+  batch_size_ = std::clamp<size_t>(batch_size, 1, kMaxRecvBatch);
+}
+
+RecvBatchStats MulticastReceiver::get_batch_stats() const {
+  RecvBatchStats stats;
+  stats.batches = stat_batches_.load(std::memory_order_relaxed);
+  stats.datagrams = stat_datagrams_.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < stat_fill_.size(); ++i) {
+    stats.fill_histogram[i] = stat_fill_[i].load(std::memory_order_relaxed);
+  }
+  return stats;
+}
+
+void MulticastReceiver::record_batch(size_t count) {
+  // single writer (the worker thread), so plain load/store is enough
+  stat_batches_.store(stat_batches_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  stat_datagrams_.store(stat_datagrams_.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+  auto &bucket = stat_fill_[count];
+  bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
 }
 
 void MulticastReceiver::start() {
@@ -26,6 +87,18 @@ void MulticastReceiver::start() {
       this->dedup_window_ = std::chrono::milliseconds(ms);
     }
   }
+  if (const char *batchenv = std::getenv("MCAST_RECV_BATCH")) {
+    long n = std::strtol(batchenv, nullptr, 10);
+    if (n > 0) {
+      this->batch_size_ = std::min<size_t>(static_cast<size_t>(n), kMaxRecvBatch);
+    }
+  }
+  if (const char *timeoutenv = std::getenv("MCAST_RECV_BATCH_US")) {
+    long us = std::strtol(timeoutenv, nullptr, 10);
+    if (us >= 0 && us < 1000000) {
+      this->batch_timeout_ = std::chrono::microseconds(us);
+    }
+  }
   worker_ = std::thread([this] { this->run_loop(); });
 }
 
@@ -40,6 +113,8 @@ void MulticastReceiver::stop() {
   }
 #else
   if (socket_ >= 0) {
+    // close() alone does not wake a thread blocked in recv on Linux
+    shutdown(socket_, SHUT_RDWR);
     close(socket_);
     socket_ = -1;
   }
@@ -50,6 +125,12 @@ void MulticastReceiver::stop() {
 }
 
 void MulticastReceiver::run_loop() {
+  if (cpu_ >= 0 && !ThreadUtils::pin_current_thread(cpu_)) {
+    std::cerr << "MulticastReceiver: could not pin receive thread to cpu " << cpu_ << std::endl;
+  }
+  if (transport_.load() == Transport::Shm && run_shm_loop()) {
+    return;
+  }
 #ifdef _WIN32
   socket_ = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
   if (socket_ == INVALID_SOCKET) {
@@ -96,60 +177,438 @@ void MulticastReceiver::run_loop() {
     throw std::runtime_error("Failed to join multicast group");
   }
 
-  std::vector<uint8_t> buffer(64 * 1024);
+  if (idle_tick_) {
+    // The receive call times out after a quiet interval so the tick can run
+#ifdef _WIN32
+    DWORD timeout = static_cast<DWORD>(idle_interval_.count());
+#else
+    timeval timeout{static_cast<time_t>(idle_interval_.count() / 1000),
+                    static_cast<suseconds_t>((idle_interval_.count() % 1000) * 1000)};
+#endif
+    setsockopt(socket_, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char *>(&timeout), sizeof(timeout));
+  }
+
+#if defined(__linux__)
+  if (transport_.load() == Transport::IoUring && run_uring_loop()) {
+    setsockopt(socket_, IPPROTO_IP, IP_DROP_MEMBERSHIP, reinterpret_cast<const char *>(&mreq), sizeof(mreq));
+    return;
+  }
+#endif
+
+  const size_t batch_size = batch_size_;
+  std::vector<uint8_t> pool(batch_size * kSlotBytes);
+  std::vector<sockaddr_in> sources(batch_size);
+  std::vector<Datagram> datagrams(batch_size);
+  std::vector<Datagram> batch(batch_size);
+
+#if defined(__linux__)
+  std::vector<iovec> iovs(batch_size);
+  std::vector<mmsghdr> msgs(batch_size);
+  for (size_t i = 0; i < batch_size; ++i) {
+    iovs[i].iov_base = pool.data() + i * kSlotBytes;
+    iovs[i].iov_len = kSlotBytes;
+  }
+
+  // Kernel receive timestamps for the recv latency stage
+  const bool timestamps = latency::enabled();
+  constexpr size_t kControlBytes = CMSG_SPACE(sizeof(timespec));
+  std::vector<char> controls(timestamps ? batch_size * kControlBytes : 0);
+  if (timestamps) {
+    int on = 1;
+    setsockopt(socket_, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on));
+  }
+#endif
+
   while (running_.load()) {
-    sockaddr_in src{};
+#if defined(__linux__)
+    for (size_t i = 0; i < batch_size; ++i) {
+      msgs[i].msg_hdr = msghdr{};
+      msgs[i].msg_hdr.msg_name = &sources[i];
+      msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+      msgs[i].msg_hdr.msg_iov = &iovs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+      if (timestamps) {
+        msgs[i].msg_hdr.msg_control = controls.data() + i * kControlBytes;
+        msgs[i].msg_hdr.msg_controllen = kControlBytes;
+      }
+      msgs[i].msg_len = 0;
+    }
+    // Blocks for the first datagram only. recvmmsg's own timeout is checked only after each datagram arrives,
+    // so a partial batch on a quiet stream would wait indefinitely; the linger is bounded by poll instead.
+    int received = recvmmsg(socket_, msgs.data(), static_cast<unsigned int>(batch_size), MSG_WAITFORONE, nullptr);
+    if (received <= 0) {
+      if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK) && idle_tick_) {
+        idle_tick_();
+      }
+      continue;
+    }
+    size_t count = static_cast<size_t>(received);
+    if (batch_timeout_.count() > 0 && count < batch_size) {
+      count += linger_for_batch(msgs.data() + count, batch_size - count);
+    }
+    auto length_of = [&msgs](size_t i) { return static_cast<size_t>(msgs[i].msg_len); };
+    if (timestamps) {
+      record_recv_latency(msgs.data(), count);
+    }
+#else
+    sockaddr_in &src = sources[0];
 #ifdef _WIN32
     int srclen = sizeof(src);
-    int n = recvfrom(socket_, reinterpret_cast<char *>(buffer.data()), static_cast<int>(buffer.size()), 0,
+    int n = recvfrom(socket_, reinterpret_cast<char *>(pool.data()), static_cast<int>(kSlotBytes), 0,
                      reinterpret_cast<sockaddr *>(&src), &srclen);
 #else
     socklen_t srclen = sizeof(src);
-    ssize_t n = recvfrom(socket_, buffer.data(), buffer.size(), 0, reinterpret_cast<sockaddr *>(&src), &srclen);
+    ssize_t n = recvfrom(socket_, pool.data(), kSlotBytes, 0, reinterpret_cast<sockaddr *>(&src), &srclen);
 #endif
     if (n <= 0) {
+      if (n < 0 && idle_tick_) {
+        idle_tick_(); // most likely the receive timeout; an early tick is harmless
+      }
       continue;
     }
+    const size_t count = 1;
+    auto length_of = [n](size_t) { return static_cast<size_t>(n); };
+#endif
 
-    // Deduplicate immediate duplicates from same src:port (common on macOS with multicast)
-    if (this->enable_dedup_) {
-      auto now = std::chrono::steady_clock::now();
-      // Simple 64-bit FNV-1a hash over the payload
-      const uint8_t *p = buffer.data();
-      size_t len = static_cast<size_t>(n);
-      uint64_t h = 1469598103934665603ULL;
-      for (size_t i = 0; i < len; ++i) {
-        h ^= static_cast<uint64_t>(p[i]);
-        h *= 1099511628211ULL;
-      }
+    for (size_t i = 0; i < count; ++i) {
+      datagrams[i] = Datagram{pool.data() + i * kSlotBytes, length_of(i)};
+    }
+    deliver(datagrams.data(), sources.data(), count, batch.data());
+  }
+
+  setsockopt(socket_, IPPROTO_IP, IP_DROP_MEMBERSHIP, reinterpret_cast<const char *>(&mreq), sizeof(mreq));
+}
+
+#if defined(__linux__)
+size_t MulticastReceiver::linger_for_batch(mmsghdr *msgs, size_t room) {
+  const auto deadline = std::chrono::steady_clock::now() + batch_timeout_;
+  size_t added = 0;
+  while (added < room && running_.load(std::memory_order_relaxed)) {
+    const auto left = deadline - std::chrono::steady_clock::now();
+    if (left <= std::chrono::steady_clock::duration::zero()) {
+      break;
+    }
+    const auto left_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(left).count();
+    timespec wait{static_cast<time_t>(left_ns / 1000000000), static_cast<long>(left_ns % 1000000000)};
+    pollfd pfd{socket_, POLLIN, 0};
+    if (ppoll(&pfd, 1, &wait, nullptr) <= 0 || (pfd.revents & POLLIN) == 0) {
+      break;
+    }
+    const int more = recvmmsg(socket_, msgs + added, static_cast<unsigned int>(room - added), MSG_DONTWAIT, nullptr);
+    if (more <= 0) {
+      break;
+    }
+    added += static_cast<size_t>(more);
+  }
+  return added;
+}
+#endif
+
+void MulticastReceiver::deliver(const Datagram *received, const sockaddr_in *sources, size_t count, Datagram *kept) {
+  record_batch(count);
+
+  auto handlers = handlers_.read();
+  size_t kept_count = 0;
+  size_t bytes = 0;
+  size_t duplicates = 0;
+  for (size_t i = 0; i < count; ++i) {
+    const uint8_t *data = received[i].data;
+    const size_t len = received[i].len;
+    bytes += len;
+    if (len == 0) {
+      continue;
+    }
+    if (is_duplicate(data, len, sources[i])) {
+      duplicates++;
+      continue;
+    }
+    for (const auto &h : *handlers) {
+      h.fn(data, len);
+    }
+    kept[kept_count++] = Datagram{data, len};
+  }
+  rx_datagrams_.add(count);
+  rx_bytes_.add(bytes);
+  if (duplicates > 0) {
+    rx_dedup_drops_.add(duplicates);
+  }
+
+  if (kept_count > 0) {
+    auto batch_handlers = batch_handlers_.read();
+    for (const auto &h : *batch_handlers) {
+      h.fn(kept, kept_count);
+    }
+  }
+}
+
+#if defined(__linux__)
+// io_uring receive: one multishot recvmsg keeps completing into buffers the kernel picks from a provided buffer
+// ring, so a busy socket costs no syscall per datagram and an idle one a single io_uring_enter. Completions are
+// reaped up to batch_size at a time and their buffers go back to the ring once the handlers return. Returns
+// false, before receiving anything, if io_uring cannot be set up; the caller then runs the classic loop.
+bool MulticastReceiver::run_uring_loop() {
+#if defined(TOYSEQ_HAS_IO_URING)
+  const size_t batch_size = batch_size_;
+  unsigned buffers = 16;
+  while (buffers < 2 * batch_size) {
+    buffers <<= 1;
+  }
+  constexpr uint16_t kBufferGroup = 0;
+  const bool timestamps = latency::enabled();
+  constexpr size_t kControlBytes = CMSG_SPACE(sizeof(timespec));
 
-      uint16_t src_port = ntohs(src.sin_port);
-      bool same_src = (this->last_src_addr_.s_addr == src.sin_addr.s_addr) && (this->last_src_port_ == src_port);
-      bool same_payload = (this->last_payload_len_ == len) && (this->last_payload_hash_ == h);
-      bool within_window =
-          (this->last_recv_time_.time_since_epoch().count() != 0) &&
-          (std::chrono::duration_cast<std::chrono::milliseconds>(now - this->last_recv_time_) < this->dedup_window_);
+  // Each buffer holds the recvmsg header, the source address, the control area and then the payload
+  msghdr templ{};
+  templ.msg_namelen = sizeof(sockaddr_in);
+  templ.msg_controllen = timestamps ? kControlBytes : 0;
+  const size_t prefix = sizeof(io_uring_recvmsg_out) + templ.msg_namelen + templ.msg_controllen;
+  const unsigned buffer_bytes = static_cast<unsigned>(prefix + kSlotBytes);
 
-      if (same_src && same_payload && within_window) {
-        continue; // drop duplicate
+  IoUring ring;
+  std::vector<uint8_t> pool(static_cast<size_t>(buffers) * buffer_bytes);
+  if (!ring.init(64) || !ring.setup_buf_ring(kBufferGroup, pool.data(), buffers, buffer_bytes)) {
+    std::cerr << "MulticastReceiver: io_uring unavailable (" << std::strerror(errno)
+              << "), falling back to the classic transport" << std::endl;
+    transport_.store(Transport::Classic);
+    return false;
+  }
+  if (timestamps) {
+    int on = 1;
+    setsockopt(socket_, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on));
+  }
+
+  const int fd = socket_;
+  auto arm = [&]() {
+    io_uring_sqe *sqe = ring.get_sqe();
+    sqe->opcode = IORING_OP_RECVMSG;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uint64_t>(&templ);
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = kBufferGroup;
+  };
+  arm();
+
+  std::vector<sockaddr_in> sources(batch_size);
+  std::vector<Datagram> received(batch_size);
+  std::vector<Datagram> batch(batch_size);
+  std::vector<uint16_t> held(batch_size);
+  long wait_ns = 100 * 1000 * 1000; // bounds how long stop() waits for the loop to notice
+  if (idle_tick_) {
+    wait_ns = std::min<long>(wait_ns, static_cast<long>(idle_interval_.count()) * 1000 * 1000);
+  }
+
+  while (running_.load()) {
+    if (ring.peek_cqe() == nullptr) {
+      const int ret = ring.submit_and_wait(1, wait_ns);
+      if (ret < 0 && ret != -ETIME && ret != -EINTR) {
+        break;
+      }
+      if (ret == -ETIME && idle_tick_ && ring.peek_cqe() == nullptr) {
+        idle_tick_();
       }
+    }
 
-      this->last_recv_time_ = now;
-      this->last_payload_hash_ = h;
-      this->last_payload_len_ = len;
-      this->last_src_addr_ = src.sin_addr;
-      this->last_src_port_ = src_port;
+    size_t count = 0;
+    size_t held_count = 0;
+    bool rearm = false;
+    uint64_t now_ns = 0;
+    if (timestamps) {
+      timespec now{};
+      clock_gettime(CLOCK_REALTIME, &now);
+      now_ns = static_cast<uint64_t>(now.tv_sec) * 1000000000ull + static_cast<uint64_t>(now.tv_nsec);
+    }
+    // Bounded on held buffers, not datagrams: a truncated or failed receive still holds one
+    while (held_count < batch_size) {
+      io_uring_cqe *cqe = ring.peek_cqe();
+      if (cqe == nullptr) {
+        break;
+      }
+      const int res = cqe->res;
+      const uint32_t flags = cqe->flags;
+      ring.cqe_seen();
+      if ((flags & IORING_CQE_F_MORE) == 0) {
+        rearm = true; // multishot ended (buffers ran out, or an error); submit it again below
+      }
+      if ((flags & IORING_CQE_F_BUFFER) == 0) {
+        continue;
+      }
+      const uint16_t bid = static_cast<uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT);
+      held[held_count++] = bid;
+      if (res < 0) {
+        continue;
+      }
+      uint8_t *buf = ring.buf(bid);
+      auto *out = reinterpret_cast<io_uring_recvmsg_out *>(buf);
+      if (out->flags & MSG_TRUNC) {
+        continue;
+      }
+      uint8_t *name = buf + sizeof(io_uring_recvmsg_out);
+      uint8_t *control = name + templ.msg_namelen;
+      std::memcpy(&sources[count], name, std::min<size_t>(out->namelen, sizeof(sockaddr_in)));
+      if (timestamps && out->controllen > 0) {
+        msghdr hdr{};
+        hdr.msg_control = control;
+        hdr.msg_controllen = out->controllen;
+        record_recv_timestamp(hdr, now_ns);
+      }
+      received[count++] = Datagram{control + templ.msg_controllen, out->payloadlen};
     }
 
-    std::vector<DatagramHandler> copy;
-    {
-      std::lock_guard<std::mutex> lock(handlers_mutex_);
-      copy = handlers_;
+    if (count > 0) {
+      deliver(received.data(), sources.data(), count, batch.data());
     }
-    for (auto &h : copy) {
-      h(buffer.data(), static_cast<size_t>(n));
+    for (size_t i = 0; i < held_count; ++i) {
+      ring.add_buf(held[i]);
+    }
+    if (held_count > 0) {
+      ring.commit_bufs();
+    }
+    if (rearm && running_.load()) {
+      arm();
+      ring.submit_and_wait(0);
     }
   }
+  return true;
+#else
+  std::cerr << "MulticastReceiver: built without io_uring support, using the classic transport" << std::endl;
+  transport_.store(Transport::Classic);
+  return false;
+#endif
+}
+#endif
 
-  setsockopt(socket_, IPPROTO_IP, IP_DROP_MEMBERSHIP, reinterpret_cast<const char *>(&mreq), sizeof(mreq));
+// Shared-memory receive: polls every producer ring of the stream, spinning for SHM_RING_SPIN_US (default 50,
+// 0 on a single CPU) after the last entry before sleeping on the stream's bell, so a busy stream never enters the kernel. Returns
+// false if the rings cannot be opened; the caller then joins the multicast group instead.
+bool MulticastReceiver::run_shm_loop() {
+  std::unique_ptr<ShmRingConsumer> consumer;
+  try {
+    consumer = std::make_unique<ShmRingConsumer>(multicast_address_, port_);
+  } catch (const std::exception &e) {
+    std::cerr << "MulticastReceiver: " << e.what() << ", falling back to the classic transport" << std::endl;
+    transport_.store(Transport::Classic);
+    return false;
+  }
+  // Spinning only pays when the producer has a core of its own to run on meanwhile
+  std::chrono::microseconds spin{std::thread::hardware_concurrency() > 1 ? 50 : 0};
+  if (const char *spinenv = std::getenv("SHM_RING_SPIN_US")) {
+    long us = std::strtol(spinenv, nullptr, 10);
+    if (us >= 0 && us < 1000000) {
+      spin = std::chrono::microseconds(us);
+    }
+  }
+
+  const size_t batch_size = batch_size_;
+  std::vector<uint8_t> pool(batch_size * shm_ring::kSlotBytes);
+  std::vector<ShmRingConsumer::Entry> entries(batch_size);
+  std::vector<sockaddr_in> sources(batch_size);
+  std::vector<Datagram> received(batch_size);
+  std::vector<Datagram> batch(batch_size);
+  Metric rx_lost = ShmMetrics::instance().counter(endpoint_metric("rx", multicast_address_, port_, "shm lost"));
+  uint64_t lost = 0;
+  auto idle_since = std::chrono::steady_clock::now();
+  auto last_tick = idle_since;
+  std::chrono::milliseconds wait{100}; // bounds how long stop() waits for the loop to notice
+  if (idle_tick_) {
+    wait = std::min(wait, idle_interval_);
+  }
+
+  while (running_.load()) {
+    const size_t count = consumer->poll(pool.data(), shm_ring::kSlotBytes, entries.data(), batch_size);
+    if (count == 0) {
+      const auto now = std::chrono::steady_clock::now();
+      if (idle_tick_ && now - std::max(idle_since, last_tick) >= idle_interval_) {
+        last_tick = now;
+        idle_tick_();
+      }
+      if (now - idle_since >= spin) {
+        consumer->wait(wait);
+      }
+      continue;
+    }
+    // The producer's pid and ring number stand in for the source address and port payload dedup keys on
+    for (size_t i = 0; i < count; ++i) {
+      sources[i] = sockaddr_in{};
+      sources[i].sin_family = AF_INET;
+      sources[i].sin_addr.s_addr = entries[i].producer_pid;
+      sources[i].sin_port = htons(entries[i].producer_ring);
+      received[i] = Datagram{pool.data() + i * shm_ring::kSlotBytes, entries[i].len};
+    }
+    deliver(received.data(), sources.data(), count, batch.data());
+    if (consumer->get_lost() != lost) {
+      rx_lost.add(consumer->get_lost() - lost);
+      lost = consumer->get_lost();
+    }
+    idle_since = std::chrono::steady_clock::now();
+  }
+  return true;
+}
+
+#if defined(__linux__)
+void MulticastReceiver::record_recv_latency(mmsghdr *msgs, size_t count) {
+  timespec now{};
+  clock_gettime(CLOCK_REALTIME, &now);
+  const uint64_t now_ns = static_cast<uint64_t>(now.tv_sec) * 1000000000ull + static_cast<uint64_t>(now.tv_nsec);
+  for (size_t i = 0; i < count; ++i) {
+    record_recv_timestamp(msgs[i].msg_hdr, now_ns);
+  }
+}
+
+void MulticastReceiver::record_recv_timestamp(msghdr &hdr, uint64_t now_ns) {
+  for (cmsghdr *cmsg = CMSG_FIRSTHDR(&hdr); cmsg != nullptr; cmsg = CMSG_NXTHDR(&hdr, cmsg)) {
+    if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPNS) {
+      timespec rx;
+      std::memcpy(&rx, CMSG_DATA(cmsg), sizeof(rx));
+      const uint64_t rx_ns = static_cast<uint64_t>(rx.tv_sec) * 1000000000ull + static_cast<uint64_t>(rx.tv_nsec);
+      recv_latency_.record(now_ns > rx_ns ? now_ns - rx_ns : 0);
+      break;
+    }
+  }
+}
+#endif
+
+bool MulticastReceiver::is_duplicate(const uint8_t *data, size_t len, const sockaddr_in &src) {
+  if (!this->enable_dedup_) {
+    return false;
+  }
+  uint64_t seq = 0;
+  uint64_t epoch = 0;
+  if (this->seq_peek_ && this->seq_peek_(data, len, seq, epoch) && seq != 0) {
+    if (epoch != this->seq_epoch_ && epoch != 0) {
+      if (epoch < this->seq_epoch_) {
+        return false; // an older run still in flight; the handlers decide what to do with it
+      }
+      if (this->seq_epoch_ != 0 && seq <= this->seq_window_.high()) {
+        this->seq_window_.reset();
+      }
+      this->seq_epoch_ = epoch;
+    }
+    // A seq below the window cannot be told apart from a restarted stream without an epoch, so only a repeat
+    // inside it is dropped
+    return this->seq_window_.check(seq) == SeqWindow<4096>::Verdict::Duplicate;
+  }
+  return is_recent_payload(data, len, src);
+}
+
+bool MulticastReceiver::is_recent_payload(const uint8_t *data, size_t len, const sockaddr_in &src) {
+  // Deduplicate recent copies from the same src:port (common on macOS with multicast)
+  const auto now = std::chrono::steady_clock::now();
+  const uint32_t crc = crc32c::compute(data, len);
+  const uint16_t src_port = ntohs(src.sin_port);
+  RecentPayload &slot = this->recent_[crc % kRecentPayloads];
+
+  const bool same = slot.crc == crc && slot.len == len && slot.src_addr == src.sin_addr.s_addr &&
+                    slot.src_port == src_port;
+  const bool within_window = slot.at.time_since_epoch().count() != 0 && now - slot.at < this->dedup_window_;
+  if (same && within_window) {
+    return true; // drop duplicate
+  }
+
+  slot.at = now;
+  slot.crc = crc;
+  slot.len = static_cast<uint32_t>(len);
+  slot.src_addr = src.sin_addr.s_addr;
+  slot.src_port = src_port;
+  return false;
 }
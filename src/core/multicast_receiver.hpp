@@ -1,10 +1,15 @@
 #pragma once
 
+#include <array>
+#include "core/latency_histogram.hpp"
+#include "core/rcu_snapshot.hpp"
+#include "core/seq_window.hpp"
+#include "core/shm_metrics.hpp"
+#include "core/transport.hpp"
 #include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <functional>
-#include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
@@ -19,29 +24,128 @@
 #include <unistd.h>
 #endif
 
+// Upper bound on datagrams pulled from the socket in a single receive call
+constexpr size_t kMaxRecvBatch = 64;
+
+struct Datagram {
+  const uint8_t *data;
+  size_t len;
+};
+
+// Fill statistics for batched receive; fill_histogram[k] counts batches that carried k datagrams
+struct RecvBatchStats {
+  uint64_t batches = 0;
+  uint64_t datagrams = 0;
+  std::array<uint64_t, kMaxRecvBatch + 1> fill_histogram{};
+
+  double average_fill() const { return batches == 0 ? 0.0 : static_cast<double>(datagrams) / batches; }
+};
+
 class MulticastReceiver {
 public:
   using DatagramHandler = std::function<void(const uint8_t *data, size_t len)>;
+  // Invoked once per receive call, after the per-datagram handlers, with every datagram that survived dedup
+  using BatchHandler = std::function<void(const Datagram *batch, size_t count)>;
+  using SubscriptionId = uint64_t;
+  // Reads the stream's sequence number out of a datagram, and the epoch of the run that numbered it (0 if the
+  // stream has none); false (or seq 0) if it carries no seq
+  using SeqPeek = bool (*)(const uint8_t *data, size_t len, uint64_t &seq, uint64_t &epoch);
 
-  MulticastReceiver(const std::string &multicast_address, uint16_t port);
+  MulticastReceiver(const std::string &multicast_address, uint16_t port,
+                    Transport transport = transport_from_env());
   ~MulticastReceiver();
 
-  void subscribe(DatagramHandler handler);
+  // Handlers may be added or removed at any time, including from inside a handler; the receive loop reads an
+  // immutable snapshot of them without locking or copying
+  SubscriptionId subscribe(DatagramHandler handler);
+  SubscriptionId subscribe_batch(BatchHandler handler);
+  void unsubscribe(SubscriptionId id);
+
+  // Batch size 1 keeps the classic one-datagram-per-syscall behaviour. A zero timeout returns as soon as
+  // at least one datagram is available; a positive timeout lingers up to that long after the first datagram
+  // for the batch to fill (Linux only).
+  void set_batch_size(size_t batch_size);
+  void set_batch_timeout(std::chrono::microseconds timeout) { batch_timeout_ = timeout; }
+  size_t get_batch_size() const { return batch_size_; }
+
+  // Sequenced streams: dedup by seq against a sliding window instead of hashing the payload, which catches any
+  // repeat within the window rather than only back-to-back copies. A higher epoch that numbers from below the
+  // window's high mark starts the window over, so a restarted stream is not taken for repeats. Call before start().
+  void set_seq_dedup(SeqPeek peek) { seq_peek_ = peek; }
+
+  // Pins the receive thread to `cpu` once it starts (Linux); -1 leaves it unpinned. Call before start().
+  void set_cpu(int cpu) { cpu_ = cpu; }
+
+  // Runs `tick` on the receive thread once the stream has been quiet for `interval`, and again every interval
+  // while it stays quiet, for timers that must fire without traffic to drive them. Call before start().
+  void set_idle_tick(std::chrono::milliseconds interval, std::function<void()> tick) {
+    idle_interval_ = interval;
+    idle_tick_ = std::move(tick);
+  }
+
+  RecvBatchStats get_batch_stats() const;
+
+  // Kernel receive timestamp to the receive loop picking the datagram up (Linux, with LATENCY_STATS=1)
+  const LatencyHistogram &get_recv_latency() const { return recv_latency_; }
 
   void start();
   void stop();
 
   std::string get_address() const { return multicast_address_; }
   uint16_t get_port() const { return port_; }
+  // The backend the receive loop runs on; Classic once the loop has started if io_uring or the shared-memory
+  // ring turned out to be unavailable
+  Transport get_transport() const { return transport_.load(); }
 
 private:
   void run_loop();
+  // Dedups and hands one receive batch to the handlers; `kept` needs room for `count` datagrams
+  void deliver(const Datagram *received, const sockaddr_in *sources, size_t count, Datagram *kept);
+#if defined(__linux__)
+  bool run_uring_loop();
+#endif
+  bool run_shm_loop();
+  bool is_duplicate(const uint8_t *data, size_t len, const sockaddr_in &src);
+  bool is_recent_payload(const uint8_t *data, size_t len, const sockaddr_in &src);
+  void record_batch(size_t count);
+#if defined(__linux__)
+  // Waits up to batch_timeout_ for more datagrams after the first, filling at most `room` entries; returns
+  // how many it added
+  size_t linger_for_batch(struct mmsghdr *msgs, size_t room);
+  void record_recv_latency(struct mmsghdr *msgs, size_t count);
+  void record_recv_timestamp(struct msghdr &hdr, uint64_t now_ns);
+#endif
 
   std::string multicast_address_;
   uint16_t port_;
+  std::atomic<Transport> transport_;
+
+  template <typename Fn> struct Subscription {
+    SubscriptionId id;
+    Fn fn;
+  };
+  std::atomic<SubscriptionId> next_subscription_id_{1};
+  RcuSnapshot<std::vector<Subscription<DatagramHandler>>> handlers_;
+  RcuSnapshot<std::vector<Subscription<BatchHandler>>> batch_handlers_;
+
+  // Batched receive config and buffer pool (batch_size_ slots of kSlotBytes each)
+  static constexpr size_t kSlotBytes = 64 * 1024;
+  size_t batch_size_ = 1;
+  std::chrono::microseconds batch_timeout_{0};
+  int cpu_ = -1;
+  std::chrono::milliseconds idle_interval_{0};
+  std::function<void()> idle_tick_;
+
+  // Written by the worker thread only, read by get_batch_stats()
+  std::atomic<uint64_t> stat_batches_{0};
+  std::atomic<uint64_t> stat_datagrams_{0};
+  std::array<std::atomic<uint64_t>, kMaxRecvBatch + 1> stat_fill_{};
+  LatencyHistogram recv_latency_;
 
-  std::mutex handlers_mutex_;
-  std::vector<DatagramHandler> handlers_;
+  // Live counters in the process's shared-memory metrics segment, written by the worker thread
+  Metric rx_datagrams_;
+  Metric rx_bytes_;
+  Metric rx_dedup_drops_;
 
   std::atomic<bool> running_{false};
   std::thread worker_;
@@ -52,12 +156,20 @@ private:
   int socket_ = -1;
 #endif
 
-  // Deduplication state and config
-  std::chrono::steady_clock::time_point last_recv_time_{};
-  uint64_t last_payload_hash_ = 0;
-  size_t last_payload_len_ = 0;
-  in_addr last_src_addr_{};
-  uint16_t last_src_port_ = 0;
+  // Deduplication state and config. Unsequenced datagrams land in a small direct-mapped table of recent
+  // payloads keyed by CRC32C; sequenced ones in a seq window. Both are touched by the worker thread only.
+  struct RecentPayload {
+    std::chrono::steady_clock::time_point at{};
+    uint32_t crc = 0;
+    uint32_t len = 0;
+    uint32_t src_addr = 0;
+    uint16_t src_port = 0;
+  };
+  static constexpr size_t kRecentPayloads = 64;
+  std::array<RecentPayload, kRecentPayloads> recent_{};
+  SeqPeek seq_peek_ = nullptr;
+  SeqWindow<4096> seq_window_;
+  uint64_t seq_epoch_ = 0;
   std::chrono::milliseconds dedup_window_{100};
   bool enable_dedup_ = true;
 };
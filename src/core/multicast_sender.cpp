@@ -1,10 +1,20 @@
 #include "multicast_sender.hpp"
+#include "core/io_uring.hpp"
+#include "core/shm_ring.hpp"
+#include <algorithm>
+#include <cerrno>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <stdexcept>
 
-MulticastSender::MulticastSender(const std::string &multicast_address, uint16_t port, uint8_t ttl)
+#if defined(__linux__)
+#include <netinet/udp.h>
+#include <sys/uio.h>
+#endif
+
+MulticastSender::MulticastSender(const std::string &multicast_address, uint16_t port, uint8_t ttl,
+                                 Transport transport)
     : multicast_address_(multicast_address), port_(port), ttl_(ttl)
 #ifdef _WIN32
       ,
@@ -22,9 +32,56 @@ MulticastSender::MulticastSender(const std::string &multicast_address, uint16_t
 #endif
 
   setup_socket();
+
+  if (transport == Transport::IoUring) {
+#if defined(TOYSEQ_HAS_IO_URING)
+    auto ring = std::make_unique<IoUring>();
+    if (ring->init(256)) {
+      uring_ = std::move(ring);
+    } else {
+      std::cerr << "MulticastSender: io_uring unavailable (" << std::strerror(errno)
+                << "), falling back to the classic transport" << std::endl;
+    }
+#else
+    std::cerr << "MulticastSender: built without io_uring support, using the classic transport" << std::endl;
+#endif
+  } else if (transport == Transport::Shm) {
+    try {
+      shm_ = std::make_unique<ShmRingProducer>(multicast_address_, port_);
+    } catch (const std::exception &e) {
+      std::cerr << "MulticastSender: " << e.what() << ", falling back to the classic transport" << std::endl;
+    }
+  }
+
+  ShmMetrics &metrics = ShmMetrics::instance();
+  tx_datagrams_ = metrics.counter(endpoint_metric("tx", multicast_address_, port_, "datagrams"));
+  tx_bytes_ = metrics.counter(endpoint_metric("tx", multicast_address_, port_, "bytes"));
+  tx_failures_ = metrics.counter(endpoint_metric("tx", multicast_address_, port_, "failures"));
+  tx_queue_depth_ = metrics.gauge(endpoint_metric("tx", multicast_address_, port_, "queue depth"));
+
+  SendBatchPolicy policy;
+  if (const char *batchenv = std::getenv("MCAST_SEND_BATCH")) {
+    long n = std::strtol(batchenv, nullptr, 10);
+    if (n > 0) {
+      policy.max_batch = static_cast<size_t>(n);
+    }
+  }
+  if (const char *lingerenv = std::getenv("MCAST_SEND_LINGER_US")) {
+    long us = std::strtol(lingerenv, nullptr, 10);
+    if (us >= 0 && us < 1000000) {
+      policy.linger = std::chrono::microseconds(us);
+    }
+  }
+  if (const char *gsoenv = std::getenv("MCAST_SEND_GSO")) {
+    policy.use_gso = (gsoenv[0] != '0');
+  }
+  set_batch_policy(policy);
 }
 
 MulticastSender::~MulticastSender() {
+  flush();
+  uring_.reset();
+  shm_.reset();
   cleanup_socket();
 #ifdef _WIN32
   WSACleanup();
@@ -86,6 +143,8 @@ void MulticastSender::setup_socket() {
       throw std::runtime_error("Failed to set SO_REUSEADDR");
     }
 
+    gso_max_segment_ = query_max_segment();
+
   } catch (const std::exception &e) {
     cleanup_socket();
     throw;
@@ -106,10 +165,24 @@ void MulticastSender::cleanup_socket() {
 #endif
 }
 
-bool MulticastSender::send_m(const std::vector<uint8_t> &data) { return send_m(data, ttl_); }
+bool MulticastSender::send_m(const uint8_t *data, size_t len) { return send_m(data, len, ttl_); }
 
-bool MulticastSender::send_m(const std::vector<uint8_t> &data, uint8_t ttl) {
+bool MulticastSender::send_m(const uint8_t *data, size_t len, uint8_t ttl) {
   try {
+    // keep ordering with anything still waiting in the batch
+    flush();
+
+    if (shm_) {
+      // TTL has no meaning on the host-local ring
+      const uint64_t start_ns = latency::enabled() ? latency::now_ns() : 0;
+      const bool ok = shm_->publish(data, len);
+      if (start_ns != 0) {
+        send_latency_.record_since(start_ns);
+      }
+      count_sent(ok, 1, len);
+      return ok;
+    }
+
     if (ttl != ttl_) {
       if (setsockopt(socket_, IPPROTO_IP, IP_MULTICAST_TTL, reinterpret_cast<const char *>(&ttl), sizeof(ttl)) < 0) {
         std::cerr << "Failed to set TTL for send" << std::endl;
@@ -117,8 +190,13 @@ bool MulticastSender::send_m(const std::vector<uint8_t> &data, uint8_t ttl) {
       }
     }
 
-    ssize_t bytes_sent = sendto(socket_, reinterpret_cast<const char *>(data.data()), data.size(), 0,
+    const uint64_t start_ns = latency::enabled() ? latency::now_ns() : 0;
+    ssize_t bytes_sent = sendto(socket_, reinterpret_cast<const char *>(data), len, 0,
                                 reinterpret_cast<const struct sockaddr *>(&multicast_addr_), sizeof(multicast_addr_));
+    if (start_ns != 0) {
+      send_latency_.record_since(start_ns);
+    }
+    count_sent(bytes_sent == static_cast<ssize_t>(len), 1, len);
 
     if (ttl != ttl_) {
       if (setsockopt(socket_, IPPROTO_IP, IP_MULTICAST_TTL, reinterpret_cast<const char *>(&ttl_), sizeof(ttl_)) < 0) {
@@ -126,10 +204,314 @@ bool MulticastSender::send_m(const std::vector<uint8_t> &data, uint8_t ttl) {
       }
     }
 
-    return bytes_sent == static_cast<ssize_t>(data.size());
+    return bytes_sent == static_cast<ssize_t>(len);
 
   } catch (const std::exception &e) {
     std::cerr << "Failed to send multicast message: " << e.what() << std::endl;
     return false;
   }
 }
+
+void MulticastSender::set_batch_policy(const SendBatchPolicy &policy) {
+  flush();
+  policy_ = policy;
+  policy_.max_batch = std::clamp<size_t>(policy_.max_batch, 1, 1024);
+  if (batching_enabled()) {
+    batch_buf_.resize(kBatchBufBytes);
+    pending_lens_.reserve(policy_.max_batch);
+  }
+}
+
+bool MulticastSender::send_raw(const uint8_t *data, size_t len) {
+  if (shm_) {
+    return shm_->publish(data, len);
+  }
+  ssize_t bytes_sent = sendto(socket_, reinterpret_cast<const char *>(data), len, 0,
+                              reinterpret_cast<const struct sockaddr *>(&multicast_addr_), sizeof(multicast_addr_));
+  return bytes_sent == static_cast<ssize_t>(len);
+}
+
+bool MulticastSender::enqueue(const uint8_t *data, size_t len) {
+  if (!batching_enabled()) {
+    const bool sent = send_raw(data, len);
+    count_sent(sent, 1, len);
+    return sent;
+  }
+
+  bool ok = true;
+  if (batch_used_ + len > batch_buf_.size()) {
+    ok = flush();
+    if (len > batch_buf_.size()) {
+      const bool sent = send_raw(data, len);
+      count_sent(sent, 1, len);
+      return sent && ok;
+    }
+  }
+
+  if (pending_lens_.empty()) {
+    batch_deadline_ = std::chrono::steady_clock::now() + policy_.linger;
+  }
+  std::memcpy(batch_buf_.data() + batch_used_, data, len);
+  batch_used_ += len;
+  pending_lens_.push_back(len);
+  tx_queue_depth_.set(pending_lens_.size());
+
+  if (pending_lens_.size() >= policy_.max_batch) {
+    return flush() && ok;
+  }
+  return flush_if_due() && ok;
+}
+
+bool MulticastSender::flush_if_due() {
+  if (pending_lens_.empty() || policy_.linger.count() == 0 || std::chrono::steady_clock::now() < batch_deadline_) {
+    return true;
+  }
+  return flush();
+}
+
+bool MulticastSender::flush() {
+  if (pending_lens_.empty()) {
+    return true;
+  }
+
+  const uint64_t start_ns = latency::enabled() ? latency::now_ns() : 0;
+  bool ok = false;
+  if (shm_) {
+    ok = flush_shm();
+  } else if (policy_.use_gso && gso_supported_ && gso_eligible()) {
+    ok = flush_gso();
+  }
+  if (!ok && !shm_) {
+    ok = flush_mmsg();
+  }
+  if (start_ns != 0) {
+    send_latency_.record_since(start_ns);
+  }
+
+  batch_stats_.flushes++;
+  batch_stats_.payloads += pending_lens_.size();
+  count_sent(ok, pending_lens_.size(), batch_used_);
+  pending_lens_.clear();
+  batch_used_ = 0;
+  tx_queue_depth_.set(0);
+  return ok;
+}
+
+void MulticastSender::count_sent(bool ok, size_t datagrams, size_t bytes) {
+  if (ok) {
+    tx_datagrams_.add(datagrams);
+    tx_bytes_.add(bytes);
+  } else {
+    tx_failures_.add(datagrams);
+  }
+}
+
+size_t MulticastSender::query_max_segment() const {
+#if defined(__linux__) && defined(IP_MTU)
+  // IP_MTU needs a connected socket, so ask through a throwaway one routed like ours
+  const int probe = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (probe < 0) {
+    return kEthernetPayload;
+  }
+  size_t max_segment = kEthernetPayload;
+  in_addr ifaddr{};
+  socklen_t iflen = sizeof(ifaddr);
+  if (getsockopt(socket_, IPPROTO_IP, IP_MULTICAST_IF, &ifaddr, &iflen) == 0 && ifaddr.s_addr != INADDR_ANY) {
+    setsockopt(probe, IPPROTO_IP, IP_MULTICAST_IF, &ifaddr, sizeof(ifaddr));
+  }
+  int mtu = 0;
+  socklen_t mtulen = sizeof(mtu);
+  if (connect(probe, reinterpret_cast<const sockaddr *>(&multicast_addr_), sizeof(multicast_addr_)) == 0 &&
+      getsockopt(probe, IPPROTO_IP, IP_MTU, &mtu, &mtulen) == 0 && mtu > static_cast<int>(kUdpIpHeaders)) {
+    max_segment = static_cast<size_t>(mtu) - kUdpIpHeaders;
+  }
+  close(probe);
+  return max_segment;
+#else
+  return kEthernetPayload;
+#endif
+}
+
+bool MulticastSender::gso_eligible() const {
+  // UDP_SEGMENT splits one buffer into equal-sized datagrams; only the last one may be shorter, and each must fit
+  // the path MTU since the kernel will not fragment them
+  if (pending_lens_.size() < 2 || pending_lens_.size() > kMaxGsoSegments || batch_used_ > kMaxGsoBytes) {
+    return false;
+  }
+  const size_t segment = pending_lens_.front();
+  if (segment > gso_max_segment_) {
+    return false;
+  }
+  for (size_t i = 1; i + 1 < pending_lens_.size(); ++i) {
+    if (pending_lens_[i] != segment) {
+      return false;
+    }
+  }
+  return pending_lens_.back() <= segment;
+}
+
+bool MulticastSender::flush_gso() {
+#if defined(__linux__) && defined(UDP_SEGMENT)
+  iovec iov{};
+  iov.iov_base = batch_buf_.data();
+  iov.iov_len = batch_used_;
+
+  alignas(cmsghdr) char control[CMSG_SPACE(sizeof(uint16_t))] = {};
+  msghdr msg{};
+  msg.msg_name = &multicast_addr_;
+  msg.msg_namelen = sizeof(multicast_addr_);
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+
+  cmsghdr *cm = CMSG_FIRSTHDR(&msg);
+  cm->cmsg_level = SOL_UDP;
+  cm->cmsg_type = UDP_SEGMENT;
+  cm->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+  const uint16_t segment = static_cast<uint16_t>(pending_lens_.front());
+  std::memcpy(CMSG_DATA(cm), &segment, sizeof(segment));
+
+  ssize_t bytes_sent = sendmsg(socket_, &msg, 0);
+  if (bytes_sent == static_cast<ssize_t>(batch_used_)) {
+    batch_stats_.gso_flushes++;
+    return true;
+  }
+  if (bytes_sent < 0 && (errno == EIO || errno == ENOPROTOOPT || errno == EOPNOTSUPP)) {
+    // kernel or device without UDP GSO; stop trying and use sendmmsg from now on
+    gso_supported_ = false;
+  } else if (bytes_sent < 0 && errno == EINVAL) {
+    if (segment > kEthernetPayload) {
+      // The route's MTU is smaller than it said; keep GSO for segments that fit any Ethernet path
+      gso_max_segment_ = kEthernetPayload;
+    } else {
+      gso_supported_ = false;
+    }
+  }
+  return false;
+#else
+  return false;
+#endif
+}
+
+bool MulticastSender::flush_mmsg() {
+  if (uring_) {
+    return flush_uring();
+  }
+  bool ok = true;
+#if defined(__linux__)
+  constexpr size_t kChunk = 64;
+  mmsghdr msgs[kChunk];
+  iovec iovs[kChunk];
+  size_t offset = 0;
+  size_t index = 0;
+  while (index < pending_lens_.size()) {
+    const size_t count = std::min(kChunk, pending_lens_.size() - index);
+    for (size_t i = 0; i < count; ++i) {
+      iovs[i].iov_base = batch_buf_.data() + offset;
+      iovs[i].iov_len = pending_lens_[index + i];
+      offset += pending_lens_[index + i];
+      msgs[i].msg_hdr = msghdr{};
+      msgs[i].msg_hdr.msg_name = &multicast_addr_;
+      msgs[i].msg_hdr.msg_namelen = sizeof(multicast_addr_);
+      msgs[i].msg_hdr.msg_iov = &iovs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+      msgs[i].msg_len = 0;
+    }
+    size_t sent = 0;
+    while (sent < count) {
+      int n = sendmmsg(socket_, msgs + sent, static_cast<unsigned int>(count - sent), 0);
+      if (n <= 0) {
+        if (n < 0 && errno == EINTR) {
+          continue;
+        }
+        ok = false;
+        break;
+      }
+      sent += static_cast<size_t>(n);
+    }
+    index += count;
+  }
+#else
+  size_t offset = 0;
+  for (size_t len : pending_lens_) {
+    ok = send_raw(batch_buf_.data() + offset, len) && ok;
+    offset += len;
+  }
+#endif
+  return ok;
+}
+
+// One SENDMSG SQE per payload, submitted together, then waits for all of them: the payloads live in batch_buf_,
+// which is reused as soon as flush() returns
+bool MulticastSender::flush_uring() {
+#if defined(TOYSEQ_HAS_IO_URING)
+  constexpr size_t kChunk = 64;
+  msghdr msgs[kChunk];
+  iovec iovs[kChunk];
+  bool ok = true;
+  size_t offset = 0;
+  size_t index = 0;
+  while (index < pending_lens_.size()) {
+    const size_t count = std::min<size_t>({kChunk, pending_lens_.size() - index, uring_->sq_entries()});
+    size_t queued = 0;
+    for (; queued < count; ++queued) {
+      io_uring_sqe *sqe = uring_->get_sqe();
+      if (sqe == nullptr) {
+        break;
+      }
+      iovs[queued].iov_base = batch_buf_.data() + offset;
+      iovs[queued].iov_len = pending_lens_[index + queued];
+      offset += pending_lens_[index + queued];
+      msgs[queued] = msghdr{};
+      msgs[queued].msg_name = &multicast_addr_;
+      msgs[queued].msg_namelen = sizeof(multicast_addr_);
+      msgs[queued].msg_iov = &iovs[queued];
+      msgs[queued].msg_iovlen = 1;
+      sqe->opcode = IORING_OP_SENDMSG;
+      sqe->fd = socket_;
+      sqe->addr = reinterpret_cast<uint64_t>(&msgs[queued]);
+      sqe->len = 1;
+      sqe->user_data = queued;
+    }
+    // A signal (-EINTR) or a full completion queue (-EBUSY) can leave SQEs unconsumed; every later
+    // submit_and_wait hands the kernel those again, so waiting never counts on completions nobody submitted
+    int ret = uring_->submit_and_wait(static_cast<unsigned>(queued));
+    size_t completed = 0;
+    while (completed < queued) {
+      io_uring_cqe *cqe = uring_->peek_cqe();
+      if (cqe == nullptr) {
+        if (ret < 0 && ret != -EINTR && ret != -EBUSY && ret != -EAGAIN) {
+          // completions are still owed for these SQEs; nothing sane left to do with the ring
+          uring_.reset();
+          return false;
+        }
+        ret = uring_->submit_and_wait(static_cast<unsigned>(queued - completed));
+        continue;
+      }
+      const size_t i = static_cast<size_t>(cqe->user_data);
+      if (cqe->res != static_cast<int>(iovs[i].iov_len)) {
+        ok = false;
+      }
+      uring_->cqe_seen();
+      completed++;
+    }
+    index += queued;
+  }
+  return ok;
+#else
+  return false;
+#endif
+}
+
+// Writes the whole batch into the ring and wakes sleeping consumers once for all of it
+bool MulticastSender::flush_shm() {
+  bool ok = true;
+  size_t offset = 0;
+  for (size_t len : pending_lens_) {
+    ok = shm_->write(batch_buf_.data() + offset, len) && ok;
+    offset += len;
+  }
+  shm_->notify();
+  return ok;
+}
@@ -1,7 +1,12 @@
 #pragma once
 
+#include "core/latency_histogram.hpp"
+#include "core/shm_metrics.hpp"
+#include "core/transport.hpp"
 #include "sender_iface.hpp"
+#include <chrono>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -15,22 +20,72 @@
 #include <unistd.h>
 #endif
 
+// Controls how enqueue() coalesces payloads. A batch is flushed once it holds max_batch payloads or once the
+// oldest queued payload has waited linger (zero means no deadline); callers may flush earlier, e.g. when their
+// input goes idle.
+struct SendBatchPolicy {
+  size_t max_batch = 1;
+  std::chrono::microseconds linger{0};
+  bool use_gso = true;
+};
+
+struct SendBatchStats {
+  uint64_t flushes = 0;
+  uint64_t payloads = 0;
+  uint64_t gso_flushes = 0;
+};
+
+class IoUring;
+class ShmRingProducer;
+
 class MulticastSender : public ISender {
 public:
+  // With Transport::IoUring a batch flush is one io_uring_enter carrying a sendmsg per payload; single sends
+  // (send_m, unbatched enqueue) stay on sendto, which is already one syscall. With Transport::Shm every payload
+  // goes into this sender's shared-memory ring instead of the socket and a flush rings the bell once.
   MulticastSender(const std::string &multicast_address,
-                  uint16_t port, uint8_t ttl);
+                  uint16_t port, uint8_t ttl, Transport transport = transport_from_env());
 
   ~MulticastSender();
 
-  bool send_m(const std::vector<uint8_t> &data) override;
-  bool send_m(const std::vector<uint8_t> &data, uint8_t ttl) override;
+  using ISender::send_m;
+  bool send_m(const uint8_t *data, size_t len) override;
+  bool send_m(const uint8_t *data, size_t len, uint8_t ttl) override;
+
+  // Batched publishing; not thread-safe, intended for a single publishing thread
+  void set_batch_policy(const SendBatchPolicy &policy);
+  const SendBatchPolicy &get_batch_policy() const { return policy_; }
+  bool batching_enabled() const { return policy_.max_batch > 1; }
+
+  bool enqueue(const uint8_t *data, size_t len);
+  bool flush();
+  bool flush_if_due();
+  size_t pending() const { return pending_lens_.size(); }
+
+  SendBatchStats get_send_batch_stats() const { return batch_stats_; }
+
+  // Time spent in the send syscall(s): per send_m() call, or per flush() when batching
+  const LatencyHistogram &get_send_latency() const { return send_latency_; }
 
   std::string get_address() const { return multicast_address_; }
   uint16_t get_port() const { return port_; }
+  Transport get_transport() const {
+    return shm_ ? Transport::Shm : uring_ ? Transport::IoUring : Transport::Classic;
+  }
 
 private:
   void setup_socket();
   void cleanup_socket();
+  bool send_raw(const uint8_t *data, size_t len);
+  bool flush_gso();
+  bool flush_mmsg();
+  bool flush_uring();
+  bool flush_shm();
+  bool gso_eligible() const;
+  // Largest UDP payload that leaves the outgoing interface unfragmented: the route's MTU less the IP and UDP
+  // headers, or kEthernetPayload where the route cannot be asked
+  size_t query_max_segment() const;
+  void count_sent(bool ok, size_t datagrams, size_t bytes);
 
   std::string multicast_address_;
   uint16_t port_;
@@ -44,4 +99,28 @@ private:
 #endif
 
   struct sockaddr_in multicast_addr_;
+
+  // Pending batch: payloads packed back to back in batch_buf_, lengths in pending_lens_
+  static constexpr size_t kBatchBufBytes = 256 * 1024;
+  static constexpr size_t kMaxGsoSegments = 64;
+  static constexpr size_t kMaxGsoBytes = 65000;
+  static constexpr size_t kUdpIpHeaders = 28;
+  static constexpr size_t kEthernetPayload = 1500 - kUdpIpHeaders;
+  SendBatchPolicy policy_{};
+  std::vector<uint8_t> batch_buf_;
+  size_t batch_used_ = 0;
+  std::vector<size_t> pending_lens_;
+  std::chrono::steady_clock::time_point batch_deadline_{};
+  bool gso_supported_ = true;
+  size_t gso_max_segment_ = kEthernetPayload; // GSO segments are never fragmented, so none may exceed this
+  std::unique_ptr<IoUring> uring_;
+  std::unique_ptr<ShmRingProducer> shm_;
+  SendBatchStats batch_stats_{};
+  LatencyHistogram send_latency_;
+
+  // Live counters in the process's shared-memory metrics segment
+  Metric tx_datagrams_;
+  Metric tx_bytes_;
+  Metric tx_failures_;
+  Metric tx_queue_depth_;
 };
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <google/protobuf/arena.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+
+// Per-thread protobuf arena that received messages are parsed into. The receivers reset it once per receive
+// batch, so messages handed to on_command/on_event are only valid for the duration of the callback (which was
+// already the contract for the stack-allocated messages). The arena starts with a preallocated block that
+// Reset() keeps, so a warmed-up receive thread parses without touching the heap; string fields longer than the
+// library's small-string buffer still allocate their character data.
+//
+// PROTO_ARENA=0 switches back to plain heap-backed messages.
+class ParseArena {
+public:
+  static constexpr size_t kInitialBlockBytes = 256 * 1024;
+
+  static ParseArena &local() {
+    thread_local ParseArena arena;
+    return arena;
+  }
+
+  static bool enabled() { return enabled_flag().load(std::memory_order_relaxed); }
+  static void set_enabled(bool on) { enabled_flag().store(on, std::memory_order_relaxed); }
+
+  template <typename MessageT> MessageT *create() {
+    live_ = true;
+#if defined(GOOGLE_PROTOBUF_VERSION) && GOOGLE_PROTOBUF_VERSION < 4022000
+    // before 22.x only CreateMessage makes the message arena-aware (so its string fields land on the arena too)
+    return google::protobuf::Arena::CreateMessage<MessageT>(&arena_);
+#else
+    return google::protobuf::Arena::Create<MessageT>(&arena_);
+#endif
+  }
+
+  // Frees every message created since the last reset; the initial block is kept
+  void reset() {
+    if (live_) {
+      arena_.Reset();
+      live_ = false;
+    }
+  }
+
+  uint64_t space_used() const { return arena_.SpaceUsed(); }
+
+private:
+  ParseArena() : block_(new char[kInitialBlockBytes]), arena_(make_options(block_.get())) {}
+
+  static google::protobuf::ArenaOptions make_options(char *block) {
+    google::protobuf::ArenaOptions options;
+    options.initial_block = block;
+    options.initial_block_size = kInitialBlockBytes;
+    options.start_block_size = kInitialBlockBytes;
+    return options;
+  }
+
+  static std::atomic<bool> &enabled_flag() {
+    static std::atomic<bool> flag{[] {
+      const char *env = std::getenv("PROTO_ARENA");
+      return !(env && env[0] == '0');
+    }()};
+    return flag;
+  }
+
+  std::unique_ptr<char[]> block_;
+  google::protobuf::Arena arena_;
+  bool live_ = false;
+};
+
+// Hands `fn` a fresh MessageT, from this thread's ParseArena when enabled or a plain local object otherwise
+template <typename MessageT, typename Fn> void with_message(Fn &&fn) {
+  if (ParseArena::enabled()) {
+    fn(*ParseArena::local().template create<MessageT>());
+  } else {
+    MessageT message;
+    fn(message);
+  }
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Wire format for pass-through sequencing: the sequencer prepends a fixed-size header to the original command
+// bytes instead of parsing the command and serializing a fresh event.
+//
+//   offset  size  field
+//   0       1     magic (0xA5, never a valid first byte of our protobuf messages, which start with tag 0x08)
+//   1       1     version
+//   2       2     msg_type (event MessageType)
+//   4       4     payload_len (command bytes that follow the header)
+//   8       8     seq
+//   16      8     timestamp (microseconds since epoch)
+//   24      8     epoch (the sequencer run, see TextEvent.epoch)
+//
+// All integers are little-endian.
+namespace passthrough {
+
+constexpr uint8_t kMagic = 0xA5;
+constexpr uint8_t kVersion = 2;
+constexpr size_t kHeaderSize = 32;
+
+struct Header {
+  uint16_t msg_type = 0;
+  uint32_t payload_len = 0;
+  uint64_t seq = 0;
+  uint64_t timestamp = 0;
+  uint64_t epoch = 0;
+};
+
+namespace detail {
+template <typename T> inline void store_le(uint8_t *out, T value) {
+  for (size_t i = 0; i < sizeof(T); ++i) {
+    out[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+template <typename T> inline T load_le(const uint8_t *in) {
+  T value = 0;
+  for (size_t i = 0; i < sizeof(T); ++i) {
+    value |= static_cast<T>(in[i]) << (8 * i);
+  }
+  return value;
+}
+} // namespace detail
+
+inline bool is_passthrough(const uint8_t *data, size_t len) { return len >= kHeaderSize && data[0] == kMagic; }
+
+inline void write_header(uint8_t *out, const Header &h) {
+  out[0] = kMagic;
+  out[1] = kVersion;
+  detail::store_le<uint16_t>(out + 2, h.msg_type);
+  detail::store_le<uint32_t>(out + 4, h.payload_len);
+  detail::store_le<uint64_t>(out + 8, h.seq);
+  detail::store_le<uint64_t>(out + 16, h.timestamp);
+  detail::store_le<uint64_t>(out + 24, h.epoch);
+}
+
+// Returns false if the datagram is not a well-formed pass-through frame
+inline bool read_header(const uint8_t *data, size_t len, Header &out) {
+  if (!is_passthrough(data, len) || data[1] != kVersion) {
+    return false;
+  }
+  out.msg_type = detail::load_le<uint16_t>(data + 2);
+  out.payload_len = detail::load_le<uint32_t>(data + 4);
+  out.seq = detail::load_le<uint64_t>(data + 8);
+  out.timestamp = detail::load_le<uint64_t>(data + 16);
+  out.epoch = detail::load_le<uint64_t>(data + 24);
+  return out.payload_len == len - kHeaderSize;
+}
+
+} // namespace passthrough
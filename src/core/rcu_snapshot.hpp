@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// Read-mostly value published as immutable snapshots. Readers take a ReadGuard and see one consistent
+// snapshot without a lock or an allocation; writers copy the current value, modify the copy and publish it.
+//
+// Retired snapshots are freed by a later writer once it observes no reader in flight, so a handler may safely
+// update the value it is being called from.
+template <typename T> class RcuSnapshot {
+public:
+  class ReadGuard {
+  public:
+    explicit ReadGuard(const RcuSnapshot &owner) : owner_(owner) {
+      owner_.readers_.fetch_add(1, std::memory_order_seq_cst);
+      value_ = owner_.current_.load(std::memory_order_seq_cst);
+    }
+    ~ReadGuard() { owner_.readers_.fetch_sub(1, std::memory_order_release); }
+
+    ReadGuard(const ReadGuard &) = delete;
+    ReadGuard &operator=(const ReadGuard &) = delete;
+
+    const T &get() const { return *value_; }
+    const T *operator->() const { return value_; }
+    const T &operator*() const { return *value_; }
+
+  private:
+    const RcuSnapshot &owner_;
+    const T *value_;
+  };
+
+  RcuSnapshot() : RcuSnapshot(T{}) {}
+  explicit RcuSnapshot(T initial) {
+    auto first = std::make_unique<const T>(std::move(initial));
+    current_.store(first.get());
+    live_ = std::move(first);
+  }
+
+  RcuSnapshot(const RcuSnapshot &) = delete;
+  RcuSnapshot &operator=(const RcuSnapshot &) = delete;
+
+  ReadGuard read() const { return ReadGuard(*this); }
+
+  // Applies `mutate` to a copy of the current value and publishes the result
+  template <typename Mutator> void update(Mutator &&mutate) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto next = std::make_unique<T>(*live_);
+    mutate(*next);
+
+    std::unique_ptr<const T> published(std::move(next));
+    current_.store(published.get(), std::memory_order_seq_cst);
+    retired_.push_back(std::move(live_));
+    live_ = std::move(published);
+
+    // Any reader that starts from here on sees the new snapshot, so with no reader in flight nothing
+    // can still point at a retired one
+    if (readers_.load(std::memory_order_seq_cst) == 0) {
+      retired_.clear();
+    }
+  }
+
+private:
+  std::atomic<const T *> current_{nullptr};
+  mutable std::atomic<uint64_t> readers_{0};
+
+  std::mutex write_mutex_;
+  std::unique_ptr<const T> live_;
+  std::vector<std::unique_ptr<const T>> retired_;
+};
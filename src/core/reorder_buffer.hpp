@@ -0,0 +1,259 @@
+#pragma once
+
+#include "core/event_limits.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+struct GapStats {
+  uint64_t gaps = 0;       // times a seq arrived ahead of the next expected one
+  uint64_t nacks_sent = 0;
+  uint64_t recovered = 0;  // events delivered from the reorder buffer
+  uint64_t lost = 0;       // seqs given up on after the NACK retries ran out, or pushed out of the window
+  uint64_t duplicates = 0; // seqs at or below what was already delivered, or already held
+  uint64_t oversized = 0;  // out-of-order events too large for a slot; left as holes for the NACK to fill
+  uint64_t implausible = 0; // lone seqs more than max_jump ahead, dropped as corrupt
+};
+
+// Puts a sequenced stream back in order. An event ahead of the next expected seq waits in one of `window`
+// slots, indexed by seq, allocated up front with room for slot_bytes each, while the missing range is NACKed.
+// A NACK left unanswered for nack_interval is repeated up to max_retries times, after which the gap is skipped
+// and counted as lost; an event too far ahead for the window pushes the oldest holes out the same way. A seq
+// more than max_jump ahead is only believed once a second one lands within the window of it, so one corrupt
+// datagram cannot throw the stream forward.
+//
+// offer() runs for every event and tick() on a timer while the stream is quiet, so a hole at the tail of a
+// burst is still retried and given up on. Both run on the receive thread; get_stats() may be called from any.
+class ReorderBuffer {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Config {
+    size_t window = 1024;    // rounded up to a power of two
+    size_t slot_bytes = event_limits::kEventBytes; // the sequencer's largest event
+    std::chrono::milliseconds nack_interval{20};
+    uint32_t max_retries = 5;
+    uint64_t max_jump = uint64_t{1} << 20; // seqs further ahead need a second one near them to be believed
+  };
+
+  explicit ReorderBuffer(const Config &config)
+      : slot_bytes_(config.slot_bytes), nack_interval_(config.nack_interval), max_retries_(config.max_retries),
+        max_jump_(config.max_jump) {
+    if (config.window == 0 || config.slot_bytes == 0) {
+      throw std::runtime_error("ReorderBuffer window and slot size must be positive");
+    }
+    size_t window = 1;
+    while (window < config.window) {
+      window <<= 1;
+    }
+    mask_ = window - 1;
+    slots_ = std::make_unique<Slot[]>(window);
+    bytes_ = std::make_unique<uint8_t[]>(window * slot_bytes_);
+  }
+
+  ReorderBuffer(const ReorderBuffer &) = delete;
+  ReorderBuffer &operator=(const ReorderBuffer &) = delete;
+
+  // Takes one event off the wire. deliver(data, len) runs for it and for every held event it unblocks, in seq
+  // order; nack(from_seq, to_seq) asks for a missing range. The first event seen sets where the stream starts.
+  template <typename DeliverFn, typename NackFn>
+  void offer(uint64_t seq, const uint8_t *data, size_t len, DeliverFn &&deliver, NackFn &&nack) {
+    if (expected_ == 0) {
+      expected_ = seq;
+    }
+    if (seq < expected_ || held(seq)) {
+      bump(duplicates_);
+      return;
+    }
+    if (seq - expected_ > max_jump_) {
+      const uint64_t first = jump_seq_;
+      if (!confirm_jump(seq)) {
+        bump(implausible_);
+        return;
+      }
+      // The stream moved on from the first of the two; it is NACKed like any other hole
+      skip_to(first, deliver);
+    }
+    if (seq - expected_ > mask_) {
+      // Too far ahead to hold: give up on everything that keeps it outside the window
+      skip_to(seq - mask_, deliver);
+      drain(deliver, nack);
+    }
+    if (seq == expected_) {
+      deliver(data, len);
+      expected_++;
+      drain(deliver, nack);
+      return;
+    }
+
+    const bool new_gap = held_ == 0;
+    if (len > slot_bytes_) {
+      bump(oversized_);
+    } else {
+      Slot &slot = slots_[seq & mask_];
+      slot.seq = seq;
+      slot.len = static_cast<uint32_t>(len);
+      std::memcpy(slot_data(seq), data, len);
+      held_++;
+    }
+    if (new_gap) {
+      bump(gaps_);
+      retries_ = 0;
+      send_nack(expected_, seq - 1, nack);
+    } else {
+      retry(deliver, nack);
+    }
+  }
+
+  // Repeats an overdue NACK or gives up on the gap; call it whenever the stream has been quiet for a while
+  template <typename DeliverFn, typename NackFn> void tick(DeliverFn &&deliver, NackFn &&nack) {
+    if (held_ > 0) {
+      retry(deliver, nack);
+    }
+  }
+
+  // The stream started over under a new sequencer run: delivers what is held in seq order, counting the holes
+  // between as lost, and joins again at the next seq offered
+  template <typename DeliverFn> void restart(DeliverFn &&deliver) {
+    if (held_ > 0) {
+      uint64_t last = expected_ + mask_;
+      while (!held(last)) {
+        last--;
+      }
+      skip_to(last + 1, deliver);
+    }
+    expected_ = 0;
+    retries_ = 0;
+    jump_seq_ = 0;
+  }
+
+  // Next seq to deliver; 0 until the first event
+  uint64_t expected() const { return expected_; }
+  size_t depth() const { return held_; }
+  size_t window() const { return mask_ + 1; }
+
+  GapStats get_stats() const {
+    GapStats stats;
+    stats.gaps = gaps_.load(std::memory_order_relaxed);
+    stats.nacks_sent = nacks_sent_.load(std::memory_order_relaxed);
+    stats.recovered = recovered_.load(std::memory_order_relaxed);
+    stats.lost = lost_.load(std::memory_order_relaxed);
+    stats.duplicates = duplicates_.load(std::memory_order_relaxed);
+    stats.oversized = oversized_.load(std::memory_order_relaxed);
+    stats.implausible = implausible_.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+private:
+  struct Slot {
+    uint64_t seq = 0; // 0 when empty; sequencers start at 1
+    uint32_t len = 0;
+  };
+
+  bool held(uint64_t seq) const { return slots_[seq & mask_].seq == seq; }
+  uint8_t *slot_data(uint64_t seq) { return bytes_.get() + (seq & mask_) * slot_bytes_; }
+
+  // Oldest held seq; only called with something held
+  uint64_t first_held() const {
+    uint64_t seq = expected_ + 1;
+    while (!held(seq)) {
+      seq++;
+    }
+    return seq;
+  }
+
+  template <typename DeliverFn> void release(uint64_t seq, DeliverFn &deliver) {
+    Slot &slot = slots_[seq & mask_];
+    deliver(static_cast<const uint8_t *>(slot_data(seq)), static_cast<size_t>(slot.len));
+    slot.seq = 0;
+    held_--;
+    bump(recovered_);
+  }
+
+  // Delivers the held events that now follow on, then NACKs the next hole if more are waiting behind it
+  template <typename DeliverFn, typename NackFn> void drain(DeliverFn &deliver, NackFn &nack) {
+    bool drained = false;
+    while (held_ > 0 && held(expected_)) {
+      release(expected_, deliver);
+      expected_++;
+      drained = true;
+    }
+    if (drained && held_ > 0) {
+      retries_ = 0;
+      send_nack(expected_, first_held() - 1, nack);
+    }
+  }
+
+  template <typename DeliverFn, typename NackFn> void retry(DeliverFn &deliver, NackFn &nack) {
+    if (Clock::now() - last_nack_ < nack_interval_) {
+      return;
+    }
+    if (retries_ >= max_retries_) {
+      skip_to(first_held(), deliver);
+      drain(deliver, nack);
+      return;
+    }
+    retries_++;
+    send_nack(expected_, first_held() - 1, nack);
+  }
+
+  // Moves expected_ up to `seq`, delivering whatever is held on the way and counting the rest as lost. Only the
+  // window past expected_ can hold anything, so this looks at no more than `window` slots however far it goes.
+  template <typename DeliverFn> void skip_to(uint64_t seq, DeliverFn &deliver) {
+    const uint64_t end = seq - expected_ > mask_ ? expected_ + mask_ + 1 : seq;
+    uint64_t released = 0;
+    for (uint64_t at = expected_; at < end && held_ > 0; ++at) {
+      if (held(at)) {
+        release(at, deliver);
+        released++;
+      }
+    }
+    lost_.store(lost_.load(std::memory_order_relaxed) + (seq - expected_ - released), std::memory_order_relaxed);
+    expected_ = seq;
+    retries_ = 0;
+  }
+
+  // A seq beyond max_jump is taken as real only when it follows one that was within the window of it
+  bool confirm_jump(uint64_t seq) {
+    const bool confirmed = jump_seq_ != 0 && seq > jump_seq_ && seq - jump_seq_ <= mask_;
+    jump_seq_ = confirmed ? 0 : seq;
+    return confirmed;
+  }
+
+  template <typename NackFn> void send_nack(uint64_t from_seq, uint64_t to_seq, NackFn &nack) {
+    last_nack_ = Clock::now();
+    nack(from_seq, to_seq);
+    bump(nacks_sent_);
+  }
+
+  // Single writer, so a plain load/store is enough
+  static void bump(std::atomic<uint64_t> &counter) {
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+  const size_t slot_bytes_;
+  const std::chrono::milliseconds nack_interval_;
+  const uint32_t max_retries_;
+  const uint64_t max_jump_;
+  size_t mask_ = 0;
+  std::unique_ptr<Slot[]> slots_;
+  std::unique_ptr<uint8_t[]> bytes_;
+
+  // Receive thread only; expected_ 0 means not yet joined
+  uint64_t expected_ = 0;
+  size_t held_ = 0;
+  uint32_t retries_ = 0;
+  Clock::time_point last_nack_{};
+  uint64_t jump_seq_ = 0; // last implausible seq, waiting for a second one near it
+
+  std::atomic<uint64_t> gaps_{0};
+  std::atomic<uint64_t> nacks_sent_{0};
+  std::atomic<uint64_t> recovered_{0};
+  std::atomic<uint64_t> lost_{0};
+  std::atomic<uint64_t> duplicates_{0};
+  std::atomic<uint64_t> oversized_{0};
+  std::atomic<uint64_t> implausible_{0};
+};
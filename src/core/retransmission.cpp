@@ -0,0 +1,72 @@
+#include "retransmission.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+RetransmissionService::RetransmissionService(const std::string &nack_address, uint16_t nack_port,
+                                             const std::string &events_address, uint16_t events_port, uint8_t ttl,
+                                             size_t capacity, size_t slot_bytes)
+    : nack_receiver_(nack_address, nack_port), sender_(events_address, events_port, ttl), capacity_(capacity),
+      slot_bytes_(slot_bytes), slots_(capacity), storage_(capacity * slot_bytes), resend_buf_(slot_bytes) {
+  if (capacity_ == 0) {
+    throw std::invalid_argument("Retransmission ring capacity must be positive");
+  }
+  // Resends go out one by one regardless of the publisher's batching policy
+  sender_.set_batch_policy(SendBatchPolicy{});
+  nack_receiver_.subscribe([this](const uint8_t *data, size_t len) { this->on_nack(data, len); });
+}
+
+void RetransmissionService::store(uint64_t seq, const uint8_t *data, size_t len) {
+  if (len > slot_bytes_) {
+    stat_oversized_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  const size_t index = seq % capacity_;
+  std::lock_guard<std::mutex> lock(ring_mutex_);
+  slots_[index].seq = seq;
+  slots_[index].len = static_cast<uint32_t>(len);
+  std::memcpy(storage_.data() + index * slot_bytes_, data, len);
+  stat_stored_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RetransmissionService::start() { nack_receiver_.start(); }
+
+void RetransmissionService::stop() { nack_receiver_.stop(); }
+
+void RetransmissionService::on_nack(const uint8_t *data, size_t len) {
+  retransmission::Nack nack;
+  if (!retransmission::decode_nack(data, len, nack)) {
+    return;
+  }
+  stat_nacks_.fetch_add(1, std::memory_order_relaxed);
+
+  const uint64_t last = std::min(nack.to_seq, nack.from_seq + retransmission::kMaxResendPerNack - 1);
+  for (uint64_t seq = nack.from_seq; seq <= last; ++seq) {
+    size_t n = 0;
+    {
+      std::lock_guard<std::mutex> lock(ring_mutex_);
+      const size_t index = seq % capacity_;
+      if (slots_[index].seq == seq) {
+        n = slots_[index].len;
+        std::memcpy(resend_buf_.data(), storage_.data() + index * slot_bytes_, n);
+      }
+    }
+    if (n == 0) {
+      stat_misses_.fetch_add(1, std::memory_order_relaxed);
+      continue;
+    }
+    if (sender_.enqueue(resend_buf_.data(), n)) {
+      stat_resent_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+}
+
+RetransmissionStats RetransmissionService::get_stats() const {
+  RetransmissionStats stats;
+  stats.stored = stat_stored_.load(std::memory_order_relaxed);
+  stats.oversized = stat_oversized_.load(std::memory_order_relaxed);
+  stats.nacks = stat_nacks_.load(std::memory_order_relaxed);
+  stats.resent = stat_resent_.load(std::memory_order_relaxed);
+  stats.misses = stat_misses_.load(std::memory_order_relaxed);
+  return stats;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "core/multicast_receiver.hpp"
+#include "core/multicast_sender.hpp"
+#include "core/passthrough.hpp"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// NACK wire format: magic 0xA6, then from_seq, to_seq (inclusive) and the requester's instance id, all
+// little-endian u64
+namespace retransmission {
+
+constexpr uint8_t kNackMagic = 0xA6;
+constexpr size_t kNackSize = 1 + 3 * sizeof(uint64_t);
+// Upper bound on events resent for a single NACK
+constexpr uint64_t kMaxResendPerNack = 4096;
+
+struct Nack {
+  uint64_t from_seq = 0;
+  uint64_t to_seq = 0;
+  uint64_t requester = 0;
+};
+
+inline void encode_nack(const Nack &nack, uint8_t *out) {
+  out[0] = kNackMagic;
+  passthrough::detail::store_le<uint64_t>(out + 1, nack.from_seq);
+  passthrough::detail::store_le<uint64_t>(out + 9, nack.to_seq);
+  passthrough::detail::store_le<uint64_t>(out + 17, nack.requester);
+}
+
+inline bool decode_nack(const uint8_t *data, size_t len, Nack &out) {
+  if (len != kNackSize || data[0] != kNackMagic) {
+    return false;
+  }
+  out.from_seq = passthrough::detail::load_le<uint64_t>(data + 1);
+  out.to_seq = passthrough::detail::load_le<uint64_t>(data + 9);
+  out.requester = passthrough::detail::load_le<uint64_t>(data + 17);
+  return out.from_seq <= out.to_seq;
+}
+
+} // namespace retransmission
+
+struct RetransmissionStats {
+  uint64_t stored = 0;
+  uint64_t oversized = 0; // events larger than a ring slot, not retained
+  uint64_t nacks = 0;
+  uint64_t resent = 0;
+  uint64_t misses = 0; // requested seqs no longer (or never) in the ring
+};
+
+// Keeps the last `capacity` published events in a fixed ring keyed by seq and re-multicasts them on the
+// events group when a consumer NACKs a gap. Runs its own NACK listener thread next to the sequencer.
+class RetransmissionService {
+public:
+  RetransmissionService(const std::string &nack_address, uint16_t nack_port, const std::string &events_address,
+                        uint16_t events_port, uint8_t ttl, size_t capacity, size_t slot_bytes);
+
+  // Called on the publish path; copies into preallocated storage
+  void store(uint64_t seq, const uint8_t *data, size_t len);
+
+  void start();
+  void stop();
+
+  RetransmissionStats get_stats() const;
+
+private:
+  struct Slot {
+    uint64_t seq = 0;
+    uint32_t len = 0;
+  };
+
+  void on_nack(const uint8_t *data, size_t len);
+
+  MulticastReceiver nack_receiver_;
+  MulticastSender sender_;
+
+  const size_t capacity_;
+  const size_t slot_bytes_;
+  mutable std::mutex ring_mutex_;
+  std::vector<Slot> slots_;
+  std::vector<uint8_t> storage_;
+  std::vector<uint8_t> resend_buf_;
+
+  std::atomic<uint64_t> stat_stored_{0};
+  std::atomic<uint64_t> stat_oversized_{0};
+  std::atomic<uint64_t> stat_nacks_{0};
+  std::atomic<uint64_t> stat_resent_{0};
+  std::atomic<uint64_t> stat_misses_{0};
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+// Reusable, cache-line aligned buffer that messages are serialized straight into before sending. Allocated
+// once; serialize() and prepare() never allocate.
+class SendBuffer {
+public:
+  static constexpr size_t kAlignment = 64;
+  static constexpr size_t kDefaultCapacity = 64 * 1024;
+
+  explicit SendBuffer(size_t capacity = kDefaultCapacity)
+      : data_(static_cast<uint8_t *>(::operator new(capacity, std::align_val_t{kAlignment}))), capacity_(capacity) {}
+
+  ~SendBuffer() { ::operator delete(data_, std::align_val_t{kAlignment}); }
+
+  SendBuffer(const SendBuffer &) = delete;
+  SendBuffer &operator=(const SendBuffer &) = delete;
+
+  // Serializes a protobuf message into the buffer; false if it does not fit
+  template <typename MessageT> bool serialize(const MessageT &message) {
+    const size_t n = message.ByteSizeLong();
+    if (n > capacity_) {
+      size_ = 0;
+      return false;
+    }
+    message.SerializeWithCachedSizesToArray(data_);
+    size_ = n;
+    return true;
+  }
+
+  // Reserves n bytes for the caller to fill in; nullptr if n exceeds the capacity
+  uint8_t *prepare(size_t n) {
+    if (n > capacity_) {
+      size_ = 0;
+      return nullptr;
+    }
+    size_ = n;
+    return data_;
+  }
+
+  // Grows the contents by n bytes and returns where they start; nullptr if they do not fit
+  uint8_t *extend(size_t n) {
+    if (n > capacity_ - size_) {
+      return nullptr;
+    }
+    uint8_t *out = data_ + size_;
+    size_ += n;
+    return out;
+  }
+
+  const uint8_t *data() const { return data_; }
+  size_t size() const { return size_; }
+  size_t capacity() const { return capacity_; }
+
+private:
+  uint8_t *data_;
+  size_t capacity_;
+  size_t size_ = 0;
+};
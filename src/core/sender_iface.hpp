@@ -1,11 +1,15 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
 class ISender {
 public:
   virtual ~ISender() = default;
-  virtual bool send_m(const std::vector<uint8_t> &data) = 0;
-  virtual bool send_m(const std::vector<uint8_t> &data, uint8_t ttl) = 0;
+  virtual bool send_m(const uint8_t *data, size_t len) = 0;
+  virtual bool send_m(const uint8_t *data, size_t len, uint8_t ttl) = 0;
+
+  bool send_m(const std::vector<uint8_t> &data) { return send_m(data.data(), data.size()); }
+  bool send_m(const std::vector<uint8_t> &data, uint8_t ttl) { return send_m(data.data(), data.size(), ttl); }
 };
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Sliding duplicate window over a monotonically numbered stream: the highest number seen plus a bitmap of the
+// Bits numbers below it, so a late (reordered) number is still accepted once. Every check is O(1) amortized.
+// Number 0 is reserved for "unnumbered" and never checked.
+template <size_t Bits> class SeqWindow {
+  static_assert(Bits % 64 == 0, "SeqWindow size must be a multiple of 64");
+
+public:
+  static constexpr uint64_t kWindow = Bits;
+
+  enum class Verdict { Accept, Duplicate, Stale };
+
+  Verdict check(uint64_t n) {
+    if (high_ == 0 || n > high_) {
+      advance(n);
+      return Verdict::Accept;
+    }
+    if (high_ - n >= kWindow) {
+      return Verdict::Stale;
+    }
+    uint64_t &word = bits_[(n / 64) % kWords];
+    const uint64_t bit = uint64_t{1} << (n % 64);
+    if (word & bit) {
+      return Verdict::Duplicate;
+    }
+    word |= bit;
+    return Verdict::Accept;
+  }
+
+  uint64_t high() const { return high_; }
+
+  // Forgets everything seen, for a stream that started numbering over
+  void reset() {
+    high_ = 0;
+    std::memset(bits_, 0, sizeof(bits_));
+  }
+
+private:
+  static constexpr size_t kWords = Bits / 64;
+
+  // Clears the bits of every number the window slides past, a word at a time where it can, then marks n
+  void advance(uint64_t n) {
+    if (high_ == 0 || n - high_ >= kWindow) {
+      std::memset(bits_, 0, sizeof(bits_));
+    } else {
+      uint64_t c = high_ + 1;
+      while (c < n) {
+        if (c % 64 == 0 && n - c >= 64) {
+          bits_[(c / 64) % kWords] = 0;
+          c += 64;
+        } else {
+          bits_[(c / 64) % kWords] &= ~(uint64_t{1} << (c % 64));
+          c++;
+        }
+      }
+    }
+    bits_[(n / 64) % kWords] |= uint64_t{1} << (n % 64);
+    high_ = n;
+  }
+
+  uint64_t high_ = 0;
+  uint64_t bits_[kWords] = {};
+};
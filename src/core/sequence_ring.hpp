@@ -0,0 +1,233 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+// Progress counter for one stage of a SequenceRing pipeline: the number of entries the stage has finished
+// with. Padded to its own cache line so neighbouring stages never false-share.
+struct alignas(64) Sequence {
+  std::atomic<uint64_t> value{0};
+
+  uint64_t get() const { return value.load(std::memory_order_acquire); }
+  void set(uint64_t v) { value.store(v, std::memory_order_release); }
+};
+
+// Busy-spins first, then yields, then naps, so a loaded pipeline reacts in nanoseconds and an idle one does
+// not burn its cores
+class PhasedWait {
+public:
+  static constexpr uint32_t kSpins = 1000;
+  static constexpr uint32_t kYields = 10000;
+
+  void pause() {
+    if (rounds_ < kSpins) {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+      _mm_pause();
+#endif
+    } else if (rounds_ < kYields) {
+      std::this_thread::yield();
+    } else {
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+    ++rounds_;
+  }
+
+private:
+  uint32_t rounds_ = 0;
+};
+
+// Disruptor-style pre-allocated ring shared by a chain of pipeline stages.
+//
+// Producers claim() entries, fill them in place and publish() them. The first consumer stage waits on the ring
+// itself (wait_for); every later stage owns a Sequence and waits on a SequenceBarrier over the stages it
+// depends on, works on every available entry in place and advances its Sequence. Producers never lap the
+// slowest gating stage, so entries are never copied or reallocated between stages.
+//
+// With ProducerMode::Multi any number of threads may claim concurrently: a claim is one fetch_add, and each
+// slot carries a published flag (the lap it was published in) so the first stage only sees a contiguous run.
+enum class ProducerMode { Single, Multi };
+
+template <typename T> class SequenceRing {
+public:
+  static constexpr uint64_t kNoEntry = UINT64_MAX;
+
+  explicit SequenceRing(size_t capacity, ProducerMode mode = ProducerMode::Single) : mode_(mode) {
+    if (capacity == 0) {
+      throw std::runtime_error("SequenceRing capacity must be positive");
+    }
+    size_t size = 1;
+    while (size < capacity) {
+      size <<= 1;
+    }
+    mask_ = size - 1;
+    while ((size_t{1} << shift_) < size) {
+      ++shift_;
+    }
+    entries_ = std::make_unique<T[]>(size);
+    if (mode_ == ProducerMode::Multi) {
+      published_ = std::make_unique<std::atomic<uint64_t>[]>(size);
+      for (size_t i = 0; i < size; ++i) {
+        published_[i].store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  SequenceRing(const SequenceRing &) = delete;
+  SequenceRing &operator=(const SequenceRing &) = delete;
+
+  // The producer waits for these before reusing a slot; register the last stage(s) before starting
+  void add_gating_sequence(const Sequence *sequence) { gating_.push_back(sequence); }
+
+  // Producer side: claims the next entry, waiting while the ring is full. Returns kNoEntry if `running` drops
+  // while waiting (in Multi mode the claimed slot then stays unpublished). `waited` is set when the ring was full.
+  uint64_t claim(const std::atomic<bool> &running, bool *waited = nullptr) {
+    if (mode_ == ProducerMode::Single) {
+      if (claimed_ - cached_gate_ > mask_) {
+        cached_gate_ = wait_for_gate(claimed_, running, waited);
+        if (cached_gate_ == kNoEntry) {
+          cached_gate_ = 0;
+          return kNoEntry;
+        }
+      }
+      return claimed_++;
+    }
+    const uint64_t seq = claims_.fetch_add(1, std::memory_order_relaxed);
+    if (seq - shared_gate_.load(std::memory_order_relaxed) > mask_) {
+      const uint64_t gate = wait_for_gate(seq, running, waited);
+      if (gate == kNoEntry) {
+        return kNoEntry;
+      }
+      shared_gate_.store(gate, std::memory_order_relaxed);
+    }
+    return seq;
+  }
+
+  // Makes a claimed entry visible to the first stage
+  void publish(uint64_t seq) {
+    if (mode_ == ProducerMode::Single) {
+      cursor_.set(seq + 1);
+    } else {
+      published_[seq & mask_].store((seq >> shift_) + 1, std::memory_order_release);
+    }
+  }
+
+  // First-stage side: blocks until more than `processed` entries are published and returns how many are
+  // (exclusive end). Returns `processed` if `running` drops first.
+  uint64_t wait_for(uint64_t processed, const std::atomic<bool> &running) const {
+    PhasedWait wait;
+    uint64_t available = published_until(processed);
+    while (available <= processed) {
+      if (!running.load(std::memory_order_relaxed)) {
+        return processed;
+      }
+      wait.pause();
+      available = published_until(processed);
+    }
+    return available;
+  }
+
+  T &operator[](uint64_t seq) { return entries_[seq & mask_]; }
+  size_t capacity() const { return mask_ + 1; }
+  ProducerMode get_mode() const { return mode_; }
+
+  // Entries claimed but not yet released by the gating stages
+  size_t depth() const { return static_cast<size_t>(claimed() - min_gating()); }
+
+private:
+  uint64_t claimed() const {
+    return mode_ == ProducerMode::Single ? cursor_.get() : claims_.load(std::memory_order_acquire);
+  }
+
+  uint64_t published_until(uint64_t from) const {
+    if (mode_ == ProducerMode::Single) {
+      return cursor_.get();
+    }
+    const uint64_t end = claims_.load(std::memory_order_acquire);
+    uint64_t seq = from;
+    while (seq < end && published_[seq & mask_].load(std::memory_order_acquire) == (seq >> shift_) + 1) {
+      ++seq;
+    }
+    return seq;
+  }
+
+  // Waits until slot `seq` is free, i.e. the gating stages have released the entry one lap behind it
+  uint64_t wait_for_gate(uint64_t seq, const std::atomic<bool> &running, bool *waited) const {
+    PhasedWait wait;
+    uint64_t gate = min_gating();
+    while (seq - gate > mask_) {
+      if (!running.load(std::memory_order_relaxed)) {
+        return kNoEntry;
+      }
+      if (waited != nullptr) {
+        *waited = true;
+      }
+      wait.pause();
+      gate = min_gating();
+    }
+    return gate;
+  }
+
+  uint64_t min_gating() const {
+    uint64_t lowest = claimed();
+    for (const Sequence *s : gating_) {
+      const uint64_t v = s->get();
+      lowest = v < lowest ? v : lowest;
+    }
+    return lowest;
+  }
+
+  ProducerMode mode_;
+  Sequence cursor_; // Single: entries published
+  alignas(64) uint64_t claimed_ = 0;
+  uint64_t cached_gate_ = 0;
+  alignas(64) std::atomic<uint64_t> claims_{0}; // Multi: entries claimed
+  alignas(64) std::atomic<uint64_t> shared_gate_{0};
+  std::unique_ptr<std::atomic<uint64_t>[]> published_; // Multi: lap + 1 each slot was last published in
+  std::vector<const Sequence *> gating_;
+  size_t mask_ = 0;
+  unsigned shift_ = 0;
+  std::unique_ptr<T[]> entries_;
+};
+
+// What a consumer stage waits on: the minimum of the sequences it depends on
+class SequenceBarrier {
+public:
+  explicit SequenceBarrier(std::vector<const Sequence *> dependencies) : dependencies_(std::move(dependencies)) {}
+
+  // Blocks until more than `processed` entries are available and returns how many are (exclusive end), so
+  // the caller can drain them as one batch. Returns `processed` if `running` drops first.
+  uint64_t wait_for(uint64_t processed, const std::atomic<bool> &running) const {
+    PhasedWait wait;
+    uint64_t available = min_available();
+    while (available <= processed) {
+      if (!running.load(std::memory_order_relaxed)) {
+        return processed;
+      }
+      wait.pause();
+      available = min_available();
+    }
+    return available;
+  }
+
+private:
+  uint64_t min_available() const {
+    uint64_t lowest = UINT64_MAX;
+    for (const Sequence *s : dependencies_) {
+      const uint64_t v = s->get();
+      lowest = v < lowest ? v : lowest;
+    }
+    return lowest;
+  }
+
+  std::vector<const Sequence *> dependencies_;
+};
@@ -0,0 +1,156 @@
+#include "shm_metrics.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace shm_metrics {
+
+std::string directory() {
+  if (const char *dir = std::getenv("SHM_METRICS_DIR"); dir && dir[0] != '\0') {
+    return dir;
+  }
+#if defined(__linux__)
+  return "/dev/shm";
+#else
+  return "/tmp";
+#endif
+}
+
+std::string file_name(const std::string &app, uint64_t pid) { return "toyseq." + app + "." + std::to_string(pid); }
+
+} // namespace shm_metrics
+
+namespace {
+
+std::atomic<uint64_t> scratch_slot{0};
+
+uint64_t current_pid() {
+#ifdef _WIN32
+  return 0;
+#else
+  return static_cast<uint64_t>(getpid());
+#endif
+}
+
+void init_header(shm_metrics::Layout *layout, const std::string &app) {
+  shm_metrics::Header &h = layout->header;
+  h.magic = shm_metrics::kMagic;
+  h.version = shm_metrics::kVersion;
+  h.pid = current_pid();
+  h.start_unix_ns = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+          .count());
+  std::strncpy(h.app, app.c_str(), shm_metrics::kAppBytes - 1);
+  h.count.store(0, std::memory_order_release);
+}
+
+} // namespace
+
+Metric::Metric() : value_(&scratch_slot) {}
+
+ShmMetrics &ShmMetrics::instance() {
+  static ShmMetrics metrics;
+  return metrics;
+}
+
+void ShmMetrics::init(const std::string &app) {
+  ShmMetrics &metrics = instance();
+  std::lock_guard<std::mutex> lock(metrics.mutex_);
+  if (metrics.layout_ != nullptr) {
+    throw std::runtime_error("ShmMetrics::init must run before any metric is registered");
+  }
+  const char *env = std::getenv("SHM_METRICS");
+  if (env && env[0] == '0') {
+    return;
+  }
+  metrics.map_shared(app);
+}
+
+void ShmMetrics::map_shared(const std::string &app) {
+#ifdef _WIN32
+  (void)app;
+#else
+  const std::string path = shm_metrics::directory() + "/" + shm_metrics::file_name(app, current_pid());
+  int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    std::cerr << "ShmMetrics: failed to create " << path << ", metrics stay private" << std::endl;
+    return;
+  }
+  if (ftruncate(fd, sizeof(shm_metrics::Layout)) != 0) {
+    ::close(fd);
+    ::unlink(path.c_str());
+    std::cerr << "ShmMetrics: failed to size " << path << ", metrics stay private" << std::endl;
+    return;
+  }
+  void *addr = mmap(nullptr, sizeof(shm_metrics::Layout), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (addr == MAP_FAILED) {
+    ::unlink(path.c_str());
+    std::cerr << "ShmMetrics: failed to map " << path << ", metrics stay private" << std::endl;
+    return;
+  }
+  // The fresh file is zero-filled, which is a valid state for every atomic in the layout
+  layout_ = static_cast<shm_metrics::Layout *>(addr);
+  init_header(layout_, app);
+  shared_ = true;
+  path_ = path;
+#endif
+}
+
+ShmMetrics::~ShmMetrics() {
+#ifndef _WIN32
+  // Only the name goes; the mapping stays valid for any writer still running during static destruction
+  if (shared_) {
+    ::unlink(path_.c_str());
+  }
+#endif
+}
+
+Metric ShmMetrics::add(const std::string &name, shm_metrics::Kind kind) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (layout_ == nullptr) {
+    private_ = std::make_unique<shm_metrics::Layout>();
+    layout_ = private_.get();
+    init_header(layout_, "private");
+  }
+
+  shm_metrics::Header &header = layout_->header;
+  const uint32_t count = header.count.load(std::memory_order_relaxed);
+  if (count >= shm_metrics::kMaxMetrics) {
+    return Metric();
+  }
+
+  // Two writers must never share a slot, so a repeated name gets a numeric suffix
+  std::string unique = name.substr(0, shm_metrics::kNameBytes - 4);
+  for (int n = 2;; ++n) {
+    bool taken = false;
+    for (uint32_t i = 0; i < count && !taken; ++i) {
+      taken = unique == layout_->descriptors[i].name;
+    }
+    if (!taken) {
+      break;
+    }
+    unique = name.substr(0, shm_metrics::kNameBytes - 4) + "#" + std::to_string(n);
+  }
+
+  shm_metrics::Descriptor &d = layout_->descriptors[count];
+  std::memset(d.name, 0, sizeof(d.name));
+  std::strncpy(d.name, unique.c_str(), shm_metrics::kNameBytes - 1);
+  d.kind = kind;
+  layout_->slots[count].value.store(0, std::memory_order_relaxed);
+  header.count.store(count + 1, std::memory_order_release);
+  return Metric(&layout_->slots[count].value);
+}
+
+std::string endpoint_metric(const char *prefix, const std::string &address, uint16_t port, const char *what) {
+  return std::string(prefix) + " " + address + ":" + std::to_string(port) + " " + what;
+}
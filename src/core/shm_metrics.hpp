@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+// Process-wide live counters published in a shared-memory file that `seqstat` maps read-only.
+//
+// Layout: a header, a table of metric descriptors (names, written once at registration) and one 64-byte line per
+// metric value. Every value has exactly one writer, which updates it with a relaxed load/store, and readers
+// never write to the segment, so a reader costs the hot path nothing beyond the line being shared.
+namespace shm_metrics {
+
+constexpr uint32_t kMagic = 0x314d5354; // "TSM1"
+constexpr uint32_t kVersion = 1;
+constexpr size_t kMaxMetrics = 256;
+constexpr size_t kNameBytes = 56;
+constexpr size_t kAppBytes = 32;
+
+enum class Kind : uint8_t { Counter = 0, Gauge = 1 };
+
+struct Descriptor {
+  char name[kNameBytes];
+  Kind kind;
+  uint8_t reserved[7];
+};
+
+struct alignas(64) Slot {
+  std::atomic<uint64_t> value;
+};
+
+struct alignas(64) Header {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t pid;
+  uint64_t start_unix_ns;
+  char app[kAppBytes];
+  std::atomic<uint32_t> count; // descriptors [0, count) are complete
+};
+
+struct Layout {
+  Header header;
+  Descriptor descriptors[kMaxMetrics];
+  Slot slots[kMaxMetrics];
+};
+
+static_assert(sizeof(Descriptor) == 64, "one descriptor per cache line");
+static_assert(sizeof(Slot) == 64, "one value per cache line");
+
+// SHM_METRICS_DIR, defaulting to /dev/shm on Linux and /tmp elsewhere
+std::string directory();
+std::string file_name(const std::string &app, uint64_t pid);
+
+} // namespace shm_metrics
+
+// Handle to one metric value; cheap to copy. A default-constructed handle writes to a scratch slot.
+class Metric {
+public:
+  Metric();
+  explicit Metric(std::atomic<uint64_t> *value) : value_(value) {}
+
+  void add(uint64_t n = 1) { value_->store(value_->load(std::memory_order_relaxed) + n, std::memory_order_relaxed); }
+  void set(uint64_t v) { value_->store(v, std::memory_order_relaxed); }
+  uint64_t get() const { return value_->load(std::memory_order_relaxed); }
+
+private:
+  std::atomic<uint64_t> *value_;
+};
+
+class ShmMetrics {
+public:
+  static ShmMetrics &instance();
+
+  // Publishes this process's metrics as <dir>/toyseq.<app>.<pid>. Call before any component registers a
+  // metric; without it (or with SHM_METRICS=0) metrics live in private memory.
+  static void init(const std::string &app);
+
+  // Registers a metric for a single writer; a name already taken gets a "#2", "#3", ... suffix
+  Metric counter(const std::string &name) { return add(name, shm_metrics::Kind::Counter); }
+  Metric gauge(const std::string &name) { return add(name, shm_metrics::Kind::Gauge); }
+
+  bool is_shared() const { return shared_; }
+  const std::string &get_path() const { return path_; }
+
+  ~ShmMetrics();
+
+private:
+  ShmMetrics() = default;
+  void map_shared(const std::string &app);
+  Metric add(const std::string &name, shm_metrics::Kind kind);
+
+  std::mutex mutex_;
+  shm_metrics::Layout *layout_ = nullptr;
+  std::unique_ptr<shm_metrics::Layout> private_;
+  bool shared_ = false;
+  std::string path_;
+};
+
+// "<prefix> <address>:<port> <what>", the naming used by the socket classes
+std::string endpoint_metric(const char *prefix, const std::string &address, uint16_t port, const char *what);
@@ -0,0 +1,332 @@
+#include "shm_ring.hpp"
+#include "core/shm_metrics.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+namespace shm_ring {
+
+std::string directory() {
+  if (const char *dir = std::getenv("SHM_RING_DIR"); dir && dir[0] != '\0') {
+    return dir;
+  }
+  return shm_metrics::directory();
+}
+
+size_t slots_from_env() {
+  if (const char *env = std::getenv("SHM_RING_SLOTS")) {
+    long n = std::strtol(env, nullptr, 10);
+    if (n > 0) {
+      return static_cast<size_t>(n);
+    }
+  }
+  return kDefaultSlots;
+}
+
+} // namespace shm_ring
+
+#ifndef _WIN32
+
+namespace {
+
+uint64_t unix_now_ns() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+          .count());
+}
+
+std::string stream_name(const std::string &address, uint16_t port) { return address + "." + std::to_string(port); }
+
+// Maps a file of exactly `bytes`, creating it zero-filled when missing. Concurrent creators agree on the size.
+void *map_file(const std::string &path, size_t bytes, int open_flags) {
+  int fd = ::open(path.c_str(), O_RDWR | open_flags, 0644);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat st {};
+  if (fstat(fd, &st) != 0 || (static_cast<size_t>(st.st_size) < bytes && ftruncate(fd, bytes) != 0)) {
+    ::close(fd);
+    return nullptr;
+  }
+  void *addr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  return addr == MAP_FAILED ? nullptr : addr;
+}
+
+shm_ring::Bell *map_bell(const std::string &address, uint16_t port) {
+  const std::string path = shm_ring::directory() + "/toyseq-bell." + stream_name(address, port);
+  return static_cast<shm_ring::Bell *>(map_file(path, sizeof(shm_ring::Bell), O_CREAT));
+}
+
+void wake_all(std::atomic<uint32_t> &word) {
+#if defined(__linux__)
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#else
+  (void)word;
+#endif
+}
+
+void wait_on(std::atomic<uint32_t> &word, uint32_t expected, std::chrono::microseconds timeout) {
+#if defined(__linux__)
+  timespec ts{};
+  ts.tv_sec = static_cast<time_t>(timeout.count() / 1000000);
+  ts.tv_nsec = static_cast<long>((timeout.count() % 1000000) * 1000);
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT, expected, &ts, nullptr, 0);
+#else
+  // no cross-process futex: poll
+  (void)word;
+  (void)expected;
+  usleep(static_cast<useconds_t>(std::min<int64_t>(timeout.count(), 1000)));
+#endif
+}
+
+void ring_bell(shm_ring::Bell *bell) {
+  // Pairs with the waiters increment in ShmRingConsumer::wait: either the consumer sees the new entry before
+  // sleeping or this sees the waiter and bumps the word it sleeps on
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (bell->waiters.load(std::memory_order_relaxed) > 0) {
+    bell->notify.fetch_add(1, std::memory_order_seq_cst);
+    wake_all(bell->notify);
+  }
+}
+
+std::atomic<uint16_t> next_ring_id{0};
+
+} // namespace
+
+ShmRingProducer::ShmRingProducer(const std::string &address, uint16_t port, size_t slots) {
+  size_t size = 1;
+  while (size < slots) {
+    size <<= 1;
+  }
+  bell_ = map_bell(address, port);
+  if (bell_ == nullptr) {
+    throw std::runtime_error("Failed to map shared-memory ring bell for " + stream_name(address, port));
+  }
+  path_ = shm_ring::directory() + "/toyseq-ring." + stream_name(address, port) + "." + std::to_string(getpid()) +
+          "." + std::to_string(next_ring_id.fetch_add(1));
+  map_bytes_ = sizeof(shm_ring::RingHeader) + size * sizeof(shm_ring::Slot);
+  map_ = map_file(path_, map_bytes_, O_CREAT | O_TRUNC);
+  if (map_ == nullptr) {
+    munmap(bell_, sizeof(shm_ring::Bell));
+    throw std::runtime_error("Failed to create shared-memory ring " + path_);
+  }
+  header_ = static_cast<shm_ring::RingHeader *>(map_);
+  slots_ = reinterpret_cast<shm_ring::Slot *>(static_cast<uint8_t *>(map_) + sizeof(shm_ring::RingHeader));
+  mask_ = size - 1;
+  header_->pid = static_cast<uint64_t>(getpid());
+  header_->created_unix_ns = unix_now_ns();
+  header_->slots = size;
+  header_->version = shm_ring::kVersion;
+  header_->magic.store(shm_ring::kMagic, std::memory_order_release);
+
+  bell_->generation.fetch_add(1, std::memory_order_seq_cst);
+  bell_->notify.fetch_add(1, std::memory_order_seq_cst);
+  wake_all(bell_->notify);
+}
+
+ShmRingProducer::~ShmRingProducer() {
+  header_->closed.store(1, std::memory_order_release);
+  ::unlink(path_.c_str());
+  bell_->generation.fetch_add(1, std::memory_order_seq_cst);
+  bell_->notify.fetch_add(1, std::memory_order_seq_cst);
+  wake_all(bell_->notify);
+  munmap(map_, map_bytes_);
+  munmap(bell_, sizeof(shm_ring::Bell));
+}
+
+bool ShmRingProducer::write(const uint8_t *data, size_t len) {
+  if (len > shm_ring::kPayloadBytes) {
+    return false;
+  }
+  shm_ring::Slot &slot = slots_[head_ & mask_];
+  slot.stamp.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.len = static_cast<uint32_t>(len);
+  std::memcpy(slot.payload, data, len);
+  slot.stamp.store(head_ + 1, std::memory_order_release);
+  head_++;
+  header_->head.store(head_, std::memory_order_release);
+  return true;
+}
+
+void ShmRingProducer::notify() { ring_bell(bell_); }
+
+ShmRingConsumer::ShmRingConsumer(const std::string &address, uint16_t port)
+    : prefix_("toyseq-ring." + stream_name(address, port) + "."), start_unix_ns_(unix_now_ns()) {
+  bell_ = map_bell(address, port);
+  if (bell_ == nullptr) {
+    throw std::runtime_error("Failed to map shared-memory ring bell for " + stream_name(address, port));
+  }
+  seen_generation_ = bell_->generation.load(std::memory_order_acquire);
+  rescan();
+}
+
+ShmRingConsumer::~ShmRingConsumer() {
+  for (Source &s : sources_) {
+    munmap(s.map, s.map_bytes);
+  }
+  munmap(bell_, sizeof(shm_ring::Bell));
+}
+
+// Maps rings that appeared since the last scan and drops closed ones this consumer has fully drained
+void ShmRingConsumer::rescan() {
+  sources_.erase(std::remove_if(sources_.begin(), sources_.end(),
+                                [](Source &s) {
+                                  const bool done = s.header->closed.load(std::memory_order_acquire) != 0 &&
+                                                    s.cursor >= s.header->head.load(std::memory_order_acquire);
+                                  if (done) {
+                                    munmap(s.map, s.map_bytes);
+                                  }
+                                  return done;
+                                }),
+                 sources_.end());
+
+  const std::string dir = shm_ring::directory();
+  DIR *d = opendir(dir.c_str());
+  if (d == nullptr) {
+    return;
+  }
+  while (dirent *entry = readdir(d)) {
+    const std::string name = entry->d_name;
+    if (name.compare(0, prefix_.size(), prefix_) != 0) {
+      continue;
+    }
+    if (std::any_of(sources_.begin(), sources_.end(), [&](const Source &s) { return s.name == name; })) {
+      continue;
+    }
+    const std::string path = dir + "/" + name;
+    int fd = ::open(path.c_str(), O_RDWR);
+    if (fd < 0) {
+      continue;
+    }
+    struct stat st {};
+    void *addr = MAP_FAILED;
+    const size_t bytes = fstat(fd, &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+    if (bytes > sizeof(shm_ring::RingHeader)) {
+      addr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+      continue;
+    }
+    auto *header = static_cast<shm_ring::RingHeader *>(addr);
+    const bool valid = header->magic.load(std::memory_order_acquire) == shm_ring::kMagic &&
+                       header->version == shm_ring::kVersion &&
+                       sizeof(shm_ring::RingHeader) + header->slots * sizeof(shm_ring::Slot) <= bytes;
+    // A ring left behind by a dead producer never moves again
+    const bool alive = valid && (::kill(static_cast<pid_t>(header->pid), 0) == 0 || errno == EPERM);
+    if (!alive) {
+      munmap(addr, bytes);
+      continue;
+    }
+    Source s;
+    s.name = name;
+    s.map = addr;
+    s.map_bytes = bytes;
+    s.header = header;
+    s.slots = reinterpret_cast<shm_ring::Slot *>(static_cast<uint8_t *>(addr) + sizeof(shm_ring::RingHeader));
+    s.mask = header->slots - 1;
+    // A ring created after this consumer started is read from its first entry, as a multicast receiver that
+    // joined earlier would have seen it; an older one from where it is now
+    s.cursor = header->created_unix_ns >= start_unix_ns_ ? 0 : header->head.load(std::memory_order_acquire);
+    s.pid = static_cast<uint32_t>(header->pid);
+    s.ring = static_cast<uint16_t>(std::strtoul(name.substr(name.rfind('.') + 1).c_str(), nullptr, 10));
+    sources_.push_back(std::move(s));
+  }
+  closedir(d);
+}
+
+bool ShmRingConsumer::readable() const {
+  return std::any_of(sources_.begin(), sources_.end(), [](const Source &s) {
+    return s.cursor < s.header->head.load(std::memory_order_acquire);
+  });
+}
+
+size_t ShmRingConsumer::drain(Source &s, uint8_t *pool, size_t stride, Entry *entries, size_t max) {
+  const uint64_t head = s.header->head.load(std::memory_order_acquire);
+  size_t count = 0;
+  while (count < max && s.cursor < head) {
+    const shm_ring::Slot &slot = s.slots[s.cursor & s.mask];
+    const uint64_t stamp = slot.stamp.load(std::memory_order_acquire);
+    bool lapped = stamp != s.cursor + 1;
+    if (!lapped) {
+      const size_t len = std::min<size_t>(slot.len, shm_ring::kPayloadBytes);
+      std::memcpy(pool + count * stride, slot.payload, len);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      lapped = slot.stamp.load(std::memory_order_relaxed) != stamp;
+      if (!lapped) {
+        entries[count++] = Entry{len, s.pid, s.ring};
+        s.cursor++;
+        continue;
+      }
+    }
+    // The producer went round the ring past this consumer: skip to the newest entry
+    const uint64_t newest = s.header->head.load(std::memory_order_acquire);
+    lost_ += newest - s.cursor;
+    s.cursor = newest;
+    break;
+  }
+  return count;
+}
+
+size_t ShmRingConsumer::poll(uint8_t *pool, size_t stride, Entry *entries, size_t max) {
+  const uint32_t generation = bell_->generation.load(std::memory_order_acquire);
+  if (generation != seen_generation_) {
+    seen_generation_ = generation;
+    rescan();
+  }
+  size_t count = 0;
+  for (size_t i = 0; i < sources_.size() && count < max; ++i) {
+    Source &s = sources_[(next_source_ + i) % sources_.size()];
+    count += drain(s, pool + count * stride, stride, entries + count, max - count);
+  }
+  if (!sources_.empty()) {
+    next_source_ = (next_source_ + 1) % sources_.size();
+  }
+  return count;
+}
+
+void ShmRingConsumer::wait(std::chrono::microseconds timeout) {
+  bell_->waiters.fetch_add(1, std::memory_order_seq_cst);
+  const uint32_t notify = bell_->notify.load(std::memory_order_seq_cst);
+  if (!readable() && bell_->generation.load(std::memory_order_acquire) == seen_generation_) {
+    wait_on(bell_->notify, notify, timeout);
+  }
+  bell_->waiters.fetch_sub(1, std::memory_order_seq_cst);
+}
+
+#else
+
+ShmRingProducer::ShmRingProducer(const std::string &, uint16_t, size_t) {
+  throw std::runtime_error("Shared-memory rings are not supported on this platform");
+}
+ShmRingProducer::~ShmRingProducer() = default;
+bool ShmRingProducer::write(const uint8_t *, size_t) { return false; }
+void ShmRingProducer::notify() {}
+
+ShmRingConsumer::ShmRingConsumer(const std::string &, uint16_t) {
+  throw std::runtime_error("Shared-memory rings are not supported on this platform");
+}
+ShmRingConsumer::~ShmRingConsumer() = default;
+size_t ShmRingConsumer::poll(uint8_t *, size_t, Entry *, size_t) { return 0; }
+void ShmRingConsumer::wait(std::chrono::microseconds) {}
+
+#endif
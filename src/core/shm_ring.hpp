@@ -0,0 +1,141 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Shared-memory broadcast transport for processes on one host. Every producer of an address:port stream owns a
+// single-producer ring file in the ring directory; consumers map every ring of the stream and each keeps its
+// own cursor, so nobody waits on a slow reader. Like multicast, a consumer that falls a whole ring behind loses
+// the overwritten entries (counted) and carries on from the newest one.
+//
+// Files: <dir>/toyseq-ring.<addr>.<port>.<pid>.<n> per producer, plus one <dir>/toyseq-bell.<addr>.<port> per
+// stream holding the futex word idle consumers sleep on and a generation bumped whenever a ring comes or goes.
+// Ring files are unlinked by their producer; the bell is shared by everyone on the stream and stays.
+namespace shm_ring {
+
+constexpr uint32_t kMagic = 0x31525354; // "TSR1"
+constexpr uint32_t kVersion = 1;
+constexpr size_t kSlotBytes = 2048;
+constexpr size_t kPayloadBytes = kSlotBytes - 16;
+constexpr size_t kDefaultSlots = 4096;
+
+struct alignas(64) RingHeader {
+  std::atomic<uint32_t> magic; // stored last, once the rest of the header is filled in
+  uint32_t version;
+  uint64_t pid;
+  uint64_t created_unix_ns;
+  uint64_t slots; // power of two
+  std::atomic<uint32_t> closed;
+  alignas(64) std::atomic<uint64_t> head; // entries published so far
+};
+
+// stamp is position + 1 once the entry at that position is complete, 0 while it is being written
+struct alignas(64) Slot {
+  std::atomic<uint64_t> stamp;
+  uint32_t len;
+  uint32_t reserved;
+  uint8_t payload[kPayloadBytes];
+};
+
+struct alignas(64) Bell {
+  std::atomic<uint32_t> generation;
+  alignas(64) std::atomic<uint32_t> notify;
+  std::atomic<uint32_t> waiters;
+};
+
+static_assert(sizeof(Slot) == kSlotBytes, "slots are fixed size");
+
+// SHM_RING_DIR, defaulting to the shared-memory metrics directory
+std::string directory();
+// SHM_RING_SLOTS, defaulting to kDefaultSlots
+size_t slots_from_env();
+
+} // namespace shm_ring
+
+class ShmRingProducer {
+public:
+  // Throws std::runtime_error if the ring or bell file cannot be created
+  ShmRingProducer(const std::string &address, uint16_t port, size_t slots = shm_ring::slots_from_env());
+  ~ShmRingProducer();
+
+  ShmRingProducer(const ShmRingProducer &) = delete;
+  ShmRingProducer &operator=(const ShmRingProducer &) = delete;
+
+  // Publishes one entry; false if it does not fit a slot. Consumers asleep on the bell only wake on notify().
+  bool write(const uint8_t *data, size_t len);
+  void notify();
+
+  bool publish(const uint8_t *data, size_t len) {
+    const bool ok = write(data, len);
+    notify();
+    return ok;
+  }
+
+  const std::string &get_path() const { return path_; }
+
+private:
+  std::string path_;
+  void *map_ = nullptr;
+  size_t map_bytes_ = 0;
+  shm_ring::RingHeader *header_ = nullptr;
+  shm_ring::Slot *slots_ = nullptr;
+  uint64_t mask_ = 0;
+  uint64_t head_ = 0;
+  shm_ring::Bell *bell_ = nullptr;
+};
+
+class ShmRingConsumer {
+public:
+  struct Entry {
+    size_t len;
+    uint32_t producer_pid;
+    uint16_t producer_ring;
+  };
+
+  // Throws std::runtime_error if the bell file cannot be opened
+  ShmRingConsumer(const std::string &address, uint16_t port);
+  ~ShmRingConsumer();
+
+  ShmRingConsumer(const ShmRingConsumer &) = delete;
+  ShmRingConsumer &operator=(const ShmRingConsumer &) = delete;
+
+  // Copies up to max waiting entries, round-robin over the producers, into pool + i * stride (stride must be
+  // at least kPayloadBytes). Returns how many were copied.
+  size_t poll(uint8_t *pool, size_t stride, Entry *entries, size_t max);
+
+  // Sleeps on the bell until a producer publishes, a ring comes or goes, or the timeout passes
+  void wait(std::chrono::microseconds timeout);
+
+  // Entries overwritten before this consumer got to them
+  uint64_t get_lost() const { return lost_; }
+  size_t get_producer_count() const { return sources_.size(); }
+
+private:
+  struct Source {
+    std::string name;
+    void *map;
+    size_t map_bytes;
+    shm_ring::RingHeader *header;
+    shm_ring::Slot *slots;
+    uint64_t mask;
+    uint64_t cursor;
+    uint32_t pid;
+    uint16_t ring;
+  };
+
+  void rescan();
+  bool readable() const;
+  size_t drain(Source &source, uint8_t *pool, size_t stride, Entry *entries, size_t max);
+
+  std::string prefix_;
+  std::vector<Source> sources_;
+  size_t next_source_ = 0;
+  shm_ring::Bell *bell_ = nullptr;
+  uint32_t seen_generation_ = 0;
+  uint64_t start_unix_ns_ = 0;
+  uint64_t lost_ = 0;
+};
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+// Bounded single-producer/single-consumer ring. Capacity is rounded up to a power of two; head and tail live
+// on their own cache lines and each side caches the other's index, so an uncontended push or pop touches one
+// shared line at most.
+template <typename T> class SpscRing {
+public:
+  static constexpr size_t kCacheLine = 64;
+
+  explicit SpscRing(size_t capacity) {
+    if (capacity == 0) {
+      throw std::runtime_error("SpscRing capacity must be positive");
+    }
+    size_t size = 1;
+    while (size < capacity) {
+      size <<= 1;
+    }
+    mask_ = size - 1;
+    slots_ = std::make_unique<T[]>(size);
+  }
+
+  SpscRing(const SpscRing &) = delete;
+  SpscRing &operator=(const SpscRing &) = delete;
+
+  // Producer side. Returns nullptr when full; publish() makes the slot visible to the consumer.
+  T *claim() {
+    const uint64_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ > mask_) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      if (tail - cached_head_ > mask_) {
+        return nullptr;
+      }
+    }
+    return &slots_[tail & mask_];
+  }
+
+  void publish() { tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+  bool try_push(const T &value) {
+    T *slot = claim();
+    if (slot == nullptr) {
+      return false;
+    }
+    *slot = value;
+    publish();
+    return true;
+  }
+
+  // Consumer side. Returns nullptr when empty; release() hands the slot back to the producer.
+  T *front() {
+    const uint64_t head = head_.load(std::memory_order_relaxed);
+    if (head == cached_tail_) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      if (head == cached_tail_) {
+        return nullptr;
+      }
+    }
+    return &slots_[head & mask_];
+  }
+
+  void release() { head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+  // Consumer side, in bulk: how many slots are ready (at most max_count), the i-th of them, and release(n) to
+  // hand the first n back at once
+  size_t readable(size_t max_count) {
+    const uint64_t head = head_.load(std::memory_order_relaxed);
+    if (cached_tail_ - head < max_count) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+    }
+    const uint64_t ready = cached_tail_ - head;
+    return static_cast<size_t>(ready < max_count ? ready : max_count);
+  }
+
+  T &peek(size_t i) { return slots_[(head_.load(std::memory_order_relaxed) + i) & mask_]; }
+
+  void release(size_t n) { head_.store(head_.load(std::memory_order_relaxed) + n, std::memory_order_release); }
+
+  bool try_pop(T &out) {
+    T *slot = front();
+    if (slot == nullptr) {
+      return false;
+    }
+    out = std::move(*slot);
+    release();
+    return true;
+  }
+
+  // Approximate when read from a thread other than the producer or consumer
+  size_t size() const {
+    return static_cast<size_t>(tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire));
+  }
+  bool empty() const { return size() == 0; }
+  size_t capacity() const { return mask_ + 1; }
+
+private:
+  alignas(kCacheLine) std::atomic<uint64_t> head_{0};
+  uint64_t cached_tail_ = 0; // consumer's view of tail_
+
+  alignas(kCacheLine) std::atomic<uint64_t> tail_{0};
+  uint64_t cached_head_ = 0; // producer's view of head_
+
+  alignas(kCacheLine) size_t mask_ = 0;
+  std::unique_ptr<T[]> slots_;
+};
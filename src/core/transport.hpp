@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+
+// I/O backend for MulticastSender and MulticastReceiver. Classic is plain recvmmsg/sendto/sendmmsg;
+// IoUring (Linux) receives through a multishot recvmsg over a provided buffer ring and submits send batches as
+// one io_uring_enter. Shm skips the network entirely and goes through per-producer shared-memory rings (see
+// shm_ring.hpp), so it only reaches processes on the same host. A transport that cannot be set up falls back
+// to Classic.
+enum class Transport { Classic, IoUring, Shm };
+
+// MCAST_TRANSPORT=io_uring or shm selects that backend; anything else (or unset) is Classic
+inline Transport transport_from_env() {
+  const char *env = std::getenv("MCAST_TRANSPORT");
+  if (env && (std::strcmp(env, "io_uring") == 0 || std::strcmp(env, "uring") == 0)) {
+    return Transport::IoUring;
+  }
+  if (env && std::strcmp(env, "shm") == 0) {
+    return Transport::Shm;
+  }
+  return Transport::Classic;
+}
+
+inline const char *transport_name(Transport transport) {
+  switch (transport) {
+  case Transport::IoUring:
+    return "io_uring";
+  case Transport::Shm:
+    return "shm";
+  default:
+    return "classic";
+  }
+}
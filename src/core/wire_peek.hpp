@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Minimal protobuf wire-format reader for peeking at individual fields without parsing the whole message
+namespace wire {
+
+enum WireType : uint8_t { kVarint = 0, kFixed64 = 1, kLengthDelimited = 2, kFixed32 = 5 };
+
+inline bool read_varint(const uint8_t *&p, const uint8_t *end, uint64_t &out) {
+  uint64_t value = 0;
+  for (int shift = 0; shift < 64 && p < end; shift += 7) {
+    const uint8_t byte = *p++;
+    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) {
+      out = value;
+      return true;
+    }
+  }
+  return false;
+}
+
+inline bool skip_field(const uint8_t *&p, const uint8_t *end, uint8_t wire_type) {
+  uint64_t n = 0;
+  switch (wire_type) {
+  case kVarint:
+    return read_varint(p, end, n);
+  case kFixed64:
+    if (end - p < 8)
+      return false;
+    p += 8;
+    return true;
+  case kLengthDelimited:
+    if (!read_varint(p, end, n) || static_cast<uint64_t>(end - p) < n)
+      return false;
+    p += n;
+    return true;
+  case kFixed32:
+    if (end - p < 4)
+      return false;
+    p += 4;
+    return true;
+  default:
+    return false;
+  }
+}
+
+// Scans top-level fields for the first varint with the given field number
+inline bool find_varint_field(const uint8_t *data, size_t len, uint32_t field_number, uint64_t &out) {
+  const uint8_t *p = data;
+  const uint8_t *end = data + len;
+  while (p < end) {
+    uint64_t tag = 0;
+    if (!read_varint(p, end, tag)) {
+      return false;
+    }
+    const uint8_t wire_type = static_cast<uint8_t>(tag & 0x7);
+    if ((tag >> 3) == field_number && wire_type == kVarint) {
+      return read_varint(p, end, out);
+    }
+    if (!skip_field(p, end, wire_type)) {
+      return false;
+    }
+  }
+  return false;
+}
+
+// Scans top-level fields for the first length-delimited field (string, bytes) with the given field number;
+// `out` points into `data`
+inline bool find_bytes_field(const uint8_t *data, size_t len, uint32_t field_number, const uint8_t *&out,
+                             size_t &out_len) {
+  const uint8_t *p = data;
+  const uint8_t *end = data + len;
+  while (p < end) {
+    uint64_t tag = 0;
+    if (!read_varint(p, end, tag)) {
+      return false;
+    }
+    const uint8_t wire_type = static_cast<uint8_t>(tag & 0x7);
+    if ((tag >> 3) == field_number && wire_type == kLengthDelimited) {
+      uint64_t n = 0;
+      if (!read_varint(p, end, n) || static_cast<uint64_t>(end - p) < n) {
+        return false;
+      }
+      out = p;
+      out_len = static_cast<size_t>(n);
+      return true;
+    }
+    if (!skip_field(p, end, wire_type)) {
+      return false;
+    }
+  }
+  return false;
+}
+
+} // namespace wire
@@ -1,654 +1,557 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
-// NO CHECKED-IN PROTOBUF GENCODE
 // source: messages.proto
-// Protobuf C++ Version: 6.32.1
 
 #include "messages.pb.h"
 
 #include <algorithm>
-#include <type_traits>
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/generated_message_tctable_impl.h"
-#include "google/protobuf/extension_set.h"
-#include "google/protobuf/generated_message_util.h"
-#include "google/protobuf/wire_format_lite.h"
-#include "google/protobuf/descriptor.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/reflection_ops.h"
-#include "google/protobuf/wire_format.h"
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-// Must be included last.
-#include "google/protobuf/port_def.inc"
 PROTOBUF_PRAGMA_INIT_SEG
-namespace _pb = ::google::protobuf;
-namespace _pbi = ::google::protobuf::internal;
-namespace _fl = ::google::protobuf::internal::field_layout;
-namespace toysequencer {
 
-inline constexpr TopOfBookEvent::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        symbol_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        seq_{::uint64_t{0u}},
-        timestamp_{::uint64_t{0u}},
-        sid_{::uint64_t{0u}},
-        tin_{::uint64_t{0u}},
-        bid_price_{0},
-        bid_size_{::uint64_t{0u}},
-        ask_price_{0},
-        ask_size_{::uint64_t{0u}},
-        exchange_time_{::uint64_t{0u}},
-        msg_type_{static_cast< ::toysequencer::MessageType >(0)} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR TopOfBookEvent::TopOfBookEvent(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(TopOfBookEvent_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct TopOfBookEventDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR TopOfBookEventDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~TopOfBookEventDefaultTypeInternal() {}
-  union {
-    TopOfBookEvent _instance;
-  };
-};
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TopOfBookEventDefaultTypeInternal _TopOfBookEvent_default_instance_;
-
-inline constexpr TopOfBookCommand::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        symbol_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        sid_{::uint64_t{0u}},
-        tin_{::uint64_t{0u}},
-        bid_price_{0},
-        bid_size_{::uint64_t{0u}},
-        ask_price_{0},
-        ask_size_{::uint64_t{0u}},
-        exchange_time_{::uint64_t{0u}},
-        msg_type_{static_cast< ::toysequencer::MessageType >(0)} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR TopOfBookCommand::TopOfBookCommand(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(TopOfBookCommand_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct TopOfBookCommandDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR TopOfBookCommandDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~TopOfBookCommandDefaultTypeInternal() {}
+namespace toysequencer {
+PROTOBUF_CONSTEXPR TextCommand::TextCommand(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sid_)*/uint64_t{0u}
+  , /*decltype(_impl_.tin_)*/uint64_t{0u}
+  , /*decltype(_impl_.sender_epoch_)*/uint64_t{0u}
+  , /*decltype(_impl_.cseq_)*/uint64_t{0u}
+  , /*decltype(_impl_.msg_type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TextCommandDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TextCommandDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TextCommandDefaultTypeInternal() {}
   union {
-    TopOfBookCommand _instance;
+    TextCommand _instance;
   };
 };
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TopOfBookCommandDefaultTypeInternal _TopOfBookCommand_default_instance_;
-
-inline constexpr TextEvent::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        text_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        seq_{::uint64_t{0u}},
-        timestamp_{::uint64_t{0u}},
-        sid_{::uint64_t{0u}},
-        tin_{::uint64_t{0u}},
-        msg_type_{static_cast< ::toysequencer::MessageType >(0)} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR TextEvent::TextEvent(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(TextEvent_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TextCommandDefaultTypeInternal _TextCommand_default_instance_;
+PROTOBUF_CONSTEXPR TextEvent::TextEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.seq_)*/uint64_t{0u}
+  , /*decltype(_impl_.timestamp_)*/uint64_t{0u}
+  , /*decltype(_impl_.sid_)*/uint64_t{0u}
+  , /*decltype(_impl_.tin_)*/uint64_t{0u}
+  , /*decltype(_impl_.epoch_)*/uint64_t{0u}
+  , /*decltype(_impl_.cseq_)*/uint64_t{0u}
+  , /*decltype(_impl_.msg_type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct TextEventDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR TextEventDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR TextEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~TextEventDefaultTypeInternal() {}
   union {
     TextEvent _instance;
   };
 };
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TextEventDefaultTypeInternal _TextEvent_default_instance_;
-
-inline constexpr TextCommand::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        text_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        sid_{::uint64_t{0u}},
-        tin_{::uint64_t{0u}},
-        msg_type_{static_cast< ::toysequencer::MessageType >(0)} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR TextCommand::TextCommand(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(TextCommand_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct TextCommandDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR TextCommandDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~TextCommandDefaultTypeInternal() {}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TextEventDefaultTypeInternal _TextEvent_default_instance_;
+PROTOBUF_CONSTEXPR TopOfBookCommand::TopOfBookCommand(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.symbol_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sid_)*/uint64_t{0u}
+  , /*decltype(_impl_.tin_)*/uint64_t{0u}
+  , /*decltype(_impl_.bid_price_)*/0
+  , /*decltype(_impl_.bid_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.ask_price_)*/0
+  , /*decltype(_impl_.ask_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.exchange_time_)*/uint64_t{0u}
+  , /*decltype(_impl_.sender_epoch_)*/uint64_t{0u}
+  , /*decltype(_impl_.cseq_)*/uint64_t{0u}
+  , /*decltype(_impl_.msg_type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TopOfBookCommandDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TopOfBookCommandDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TopOfBookCommandDefaultTypeInternal() {}
   union {
-    TextCommand _instance;
+    TopOfBookCommand _instance;
   };
 };
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TextCommandDefaultTypeInternal _TextCommand_default_instance_;
-}  // namespace toysequencer
-static const ::_pb::EnumDescriptor* PROTOBUF_NONNULL
-    file_level_enum_descriptors_messages_2eproto[1];
-static constexpr const ::_pb::ServiceDescriptor *PROTOBUF_NONNULL *PROTOBUF_NULLABLE
-    file_level_service_descriptors_messages_2eproto = nullptr;
-const ::uint32_t
-    TableStruct_messages_2eproto::offsets[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-        protodesc_cold) = {
-        0x081, // bitmap
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TextCommand, _impl_._has_bits_),
-        7, // hasbit index offset
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TextCommand, _impl_.msg_type_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TextCommand, _impl_.sid_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TextCommand, _impl_.tin_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TextCommand, _impl_.text_),
-        3,
-        1,
-        2,
-        0,
-        0x081, // bitmap
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TextEvent, _impl_._has_bits_),
-        9, // hasbit index offset
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TextEvent, _impl_.msg_type_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TextEvent, _impl_.seq_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TextEvent, _impl_.timestamp_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TextEvent, _impl_.sid_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TextEvent, _impl_.tin_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TextEvent, _impl_.text_),
-        5,
-        1,
-        2,
-        3,
-        4,
-        0,
-        0x081, // bitmap
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_._has_bits_),
-        12, // hasbit index offset
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_.msg_type_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_.sid_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_.tin_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_.symbol_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_.bid_price_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_.bid_size_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_.ask_price_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_.ask_size_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_.exchange_time_),
-        8,
-        1,
-        2,
-        0,
-        3,
-        4,
-        5,
-        6,
-        7,
-        0x081, // bitmap
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_._has_bits_),
-        14, // hasbit index offset
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.msg_type_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.seq_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.timestamp_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.sid_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.tin_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.symbol_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.bid_price_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.bid_size_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.ask_price_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.ask_size_),
-        PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.exchange_time_),
-        10,
-        1,
-        2,
-        3,
-        4,
-        0,
-        5,
-        6,
-        7,
-        8,
-        9,
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TopOfBookCommandDefaultTypeInternal _TopOfBookCommand_default_instance_;
+PROTOBUF_CONSTEXPR TopOfBookEvent::TopOfBookEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.symbol_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.seq_)*/uint64_t{0u}
+  , /*decltype(_impl_.timestamp_)*/uint64_t{0u}
+  , /*decltype(_impl_.sid_)*/uint64_t{0u}
+  , /*decltype(_impl_.tin_)*/uint64_t{0u}
+  , /*decltype(_impl_.bid_price_)*/0
+  , /*decltype(_impl_.bid_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.ask_price_)*/0
+  , /*decltype(_impl_.ask_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.exchange_time_)*/uint64_t{0u}
+  , /*decltype(_impl_.epoch_)*/uint64_t{0u}
+  , /*decltype(_impl_.cseq_)*/uint64_t{0u}
+  , /*decltype(_impl_.msg_type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TopOfBookEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TopOfBookEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TopOfBookEventDefaultTypeInternal() {}
+  union {
+    TopOfBookEvent _instance;
+  };
 };
-
-static const ::_pbi::MigrationSchema
-    schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-        {0, sizeof(::toysequencer::TextCommand)},
-        {11, sizeof(::toysequencer::TextEvent)},
-        {26, sizeof(::toysequencer::TopOfBookCommand)},
-        {47, sizeof(::toysequencer::TopOfBookEvent)},
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TopOfBookEventDefaultTypeInternal _TopOfBookEvent_default_instance_;
+}  // namespace toysequencer
+static ::_pb::Metadata file_level_metadata_messages_2eproto[4];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_messages_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_messages_2eproto = nullptr;
+
+const uint32_t TableStruct_messages_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TextCommand, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TextCommand, _impl_.msg_type_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TextCommand, _impl_.sid_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TextCommand, _impl_.tin_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TextCommand, _impl_.text_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TextCommand, _impl_.sender_epoch_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TextCommand, _impl_.cseq_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TextEvent, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TextEvent, _impl_.msg_type_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TextEvent, _impl_.seq_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TextEvent, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TextEvent, _impl_.sid_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TextEvent, _impl_.tin_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TextEvent, _impl_.text_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TextEvent, _impl_.epoch_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TextEvent, _impl_.cseq_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_.msg_type_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_.sid_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_.tin_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_.symbol_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_.bid_price_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_.bid_size_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_.ask_price_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_.ask_size_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_.exchange_time_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_.sender_epoch_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookCommand, _impl_.cseq_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.msg_type_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.seq_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.sid_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.tin_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.symbol_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.bid_price_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.bid_size_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.ask_price_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.ask_size_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.exchange_time_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.epoch_),
+  PROTOBUF_FIELD_OFFSET(::toysequencer::TopOfBookEvent, _impl_.cseq_),
 };
-static const ::_pb::Message* PROTOBUF_NONNULL const file_default_instances[] = {
-    &::toysequencer::_TextCommand_default_instance_._instance,
-    &::toysequencer::_TextEvent_default_instance_._instance,
-    &::toysequencer::_TopOfBookCommand_default_instance_._instance,
-    &::toysequencer::_TopOfBookEvent_default_instance_._instance,
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::toysequencer::TextCommand)},
+  { 12, -1, -1, sizeof(::toysequencer::TextEvent)},
+  { 26, -1, -1, sizeof(::toysequencer::TopOfBookCommand)},
+  { 43, -1, -1, sizeof(::toysequencer::TopOfBookEvent)},
 };
-const char descriptor_table_protodef_messages_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-    protodesc_cold) = {
-    "\n\016messages.proto\022\014toysequencer\"b\n\013TextCo"
-    "mmand\022+\n\010msg_type\030\001 \001(\0162\031.toysequencer.M"
-    "essageType\022\013\n\003sid\030\002 \001(\004\022\013\n\003tin\030\003 \001(\004\022\014\n\004"
-    "text\030\004 \001(\t\"\200\001\n\tTextEvent\022+\n\010msg_type\030\001 \001"
-    "(\0162\031.toysequencer.MessageType\022\013\n\003seq\030\002 \001"
-    "(\004\022\021\n\ttimestamp\030\003 \001(\004\022\013\n\003sid\030\004 \001(\004\022\013\n\003ti"
-    "n\030\005 \001(\004\022\014\n\004text\030\006 \001(\t\"\312\001\n\020TopOfBookComma"
-    "nd\022+\n\010msg_type\030\001 \001(\0162\031.toysequencer.Mess"
-    "ageType\022\013\n\003sid\030\002 \001(\004\022\013\n\003tin\030\003 \001(\004\022\016\n\006sym"
-    "bol\030\004 \001(\t\022\021\n\tbid_price\030\005 \001(\001\022\020\n\010bid_size"
-    "\030\006 \001(\004\022\021\n\task_price\030\007 \001(\001\022\020\n\010ask_size\030\010 "
-    "\001(\004\022\025\n\rexchange_time\030\t \001(\004\"\350\001\n\016TopOfBook"
-    "Event\022+\n\010msg_type\030\001 \001(\0162\031.toysequencer.M"
-    "essageType\022\013\n\003seq\030\002 \001(\004\022\021\n\ttimestamp\030\003 \001"
-    "(\004\022\013\n\003sid\030\004 \001(\004\022\013\n\003tin\030\005 \001(\004\022\016\n\006symbol\030\006"
-    " \001(\t\022\021\n\tbid_price\030\007 \001(\001\022\020\n\010bid_size\030\010 \001("
-    "\004\022\021\n\task_price\030\t \001(\001\022\020\n\010ask_size\030\n \001(\004\022\025"
-    "\n\rexchange_time\030\013 \001(\004*m\n\013MessageType\022\034\n\030"
-    "MESSAGE_TYPE_UNSPECIFIED\020\000\022\020\n\014TEXT_COMMA"
-    "ND\020\001\022\016\n\nTEXT_EVENT\020\002\022\017\n\013TOB_COMMAND\020\003\022\r\n"
-    "\tTOB_EVENT\020\004b\006proto3"
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::toysequencer::_TextCommand_default_instance_._instance,
+  &::toysequencer::_TextEvent_default_instance_._instance,
+  &::toysequencer::_TopOfBookCommand_default_instance_._instance,
+  &::toysequencer::_TopOfBookEvent_default_instance_._instance,
 };
-static ::absl::once_flag descriptor_table_messages_2eproto_once;
-PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_messages_2eproto = {
-    false,
-    false,
-    820,
-    descriptor_table_protodef_messages_2eproto,
+
+const char descriptor_table_protodef_messages_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\016messages.proto\022\014toysequencer\"\206\001\n\013TextC"
+  "ommand\022+\n\010msg_type\030\001 \001(\0162\031.toysequencer."
+  "MessageType\022\013\n\003sid\030\002 \001(\004\022\013\n\003tin\030\003 \001(\004\022\014\n"
+  "\004text\030\004 \001(\t\022\024\n\014sender_epoch\030\016 \001(\004\022\014\n\004cse"
+  "q\030\017 \001(\004\"\235\001\n\tTextEvent\022+\n\010msg_type\030\001 \001(\0162"
+  "\031.toysequencer.MessageType\022\013\n\003seq\030\002 \001(\004\022"
+  "\021\n\ttimestamp\030\003 \001(\004\022\013\n\003sid\030\004 \001(\004\022\013\n\003tin\030\005"
+  " \001(\004\022\014\n\004text\030\006 \001(\t\022\r\n\005epoch\030\016 \001(\004\022\014\n\004cse"
+  "q\030\017 \001(\004\"\356\001\n\020TopOfBookCommand\022+\n\010msg_type"
+  "\030\001 \001(\0162\031.toysequencer.MessageType\022\013\n\003sid"
+  "\030\002 \001(\004\022\013\n\003tin\030\003 \001(\004\022\016\n\006symbol\030\004 \001(\t\022\021\n\tb"
+  "id_price\030\005 \001(\001\022\020\n\010bid_size\030\006 \001(\004\022\021\n\task_"
+  "price\030\007 \001(\001\022\020\n\010ask_size\030\010 \001(\004\022\025\n\rexchang"
+  "e_time\030\t \001(\004\022\024\n\014sender_epoch\030\016 \001(\004\022\014\n\004cs"
+  "eq\030\017 \001(\004\"\205\002\n\016TopOfBookEvent\022+\n\010msg_type\030"
+  "\001 \001(\0162\031.toysequencer.MessageType\022\013\n\003seq\030"
+  "\002 \001(\004\022\021\n\ttimestamp\030\003 \001(\004\022\013\n\003sid\030\004 \001(\004\022\013\n"
+  "\003tin\030\005 \001(\004\022\016\n\006symbol\030\006 \001(\t\022\021\n\tbid_price\030"
+  "\007 \001(\001\022\020\n\010bid_size\030\010 \001(\004\022\021\n\task_price\030\t \001"
+  "(\001\022\020\n\010ask_size\030\n \001(\004\022\025\n\rexchange_time\030\013 "
+  "\001(\004\022\r\n\005epoch\030\016 \001(\004\022\014\n\004cseq\030\017 \001(\004*m\n\013Mess"
+  "ageType\022\034\n\030MESSAGE_TYPE_UNSPECIFIED\020\000\022\020\n"
+  "\014TEXT_COMMAND\020\001\022\016\n\nTEXT_EVENT\020\002\022\017\n\013TOB_C"
+  "OMMAND\020\003\022\r\n\tTOB_EVENT\020\004b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_messages_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_messages_2eproto = {
+    false, false, 951, descriptor_table_protodef_messages_2eproto,
     "messages.proto",
-    &descriptor_table_messages_2eproto_once,
-    nullptr,
-    0,
-    4,
-    schemas,
-    file_default_instances,
-    TableStruct_messages_2eproto::offsets,
-    file_level_enum_descriptors_messages_2eproto,
+    &descriptor_table_messages_2eproto_once, nullptr, 0, 4,
+    schemas, file_default_instances, TableStruct_messages_2eproto::offsets,
+    file_level_metadata_messages_2eproto, file_level_enum_descriptors_messages_2eproto,
     file_level_service_descriptors_messages_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_messages_2eproto_getter() {
+  return &descriptor_table_messages_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_messages_2eproto(&descriptor_table_messages_2eproto);
 namespace toysequencer {
-const ::google::protobuf::EnumDescriptor* PROTOBUF_NONNULL MessageType_descriptor() {
-  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_messages_2eproto);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_messages_2eproto);
   return file_level_enum_descriptors_messages_2eproto[0];
 }
-PROTOBUF_CONSTINIT const uint32_t MessageType_internal_data_[] = {
-    327680u, 0u, };
+bool MessageType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
 // ===================================================================
 
 class TextCommand::_Internal {
  public:
-  using HasBits =
-      decltype(::std::declval<TextCommand>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(TextCommand, _impl_._has_bits_);
 };
 
-TextCommand::TextCommand(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, TextCommand_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
+TextCommand::TextCommand(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:toysequencer.TextCommand)
 }
-PROTOBUF_NDEBUG_INLINE TextCommand::Impl_::Impl_(
-    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
-    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    [[maybe_unused]] const ::toysequencer::TextCommand& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        text_(arena, from.text_) {}
-
-TextCommand::TextCommand(
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const TextCommand& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, TextCommand_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  TextCommand* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, sid_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, sid_),
-           offsetof(Impl_, msg_type_) -
-               offsetof(Impl_, sid_) +
-               sizeof(Impl_::msg_type_));
-
+TextCommand::TextCommand(const TextCommand& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TextCommand* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.text_){}
+    , decltype(_impl_.sid_){}
+    , decltype(_impl_.tin_){}
+    , decltype(_impl_.sender_epoch_){}
+    , decltype(_impl_.cseq_){}
+    , decltype(_impl_.msg_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_text().empty()) {
+    _this->_impl_.text_.Set(from._internal_text(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.sid_, &from._impl_.sid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.msg_type_) -
+    reinterpret_cast<char*>(&_impl_.sid_)) + sizeof(_impl_.msg_type_));
   // @@protoc_insertion_point(copy_constructor:toysequencer.TextCommand)
 }
-PROTOBUF_NDEBUG_INLINE TextCommand::Impl_::Impl_(
-    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
-    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-      : _cached_size_{0},
-        text_(arena) {}
-
-inline void TextCommand::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, sid_),
-           0,
-           offsetof(Impl_, msg_type_) -
-               offsetof(Impl_, sid_) +
-               sizeof(Impl_::msg_type_));
+
+inline void TextCommand::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.text_){}
+    , decltype(_impl_.sid_){uint64_t{0u}}
+    , decltype(_impl_.tin_){uint64_t{0u}}
+    , decltype(_impl_.sender_epoch_){uint64_t{0u}}
+    , decltype(_impl_.cseq_){uint64_t{0u}}
+    , decltype(_impl_.msg_type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
+
 TextCommand::~TextCommand() {
   // @@protoc_insertion_point(destructor:toysequencer.TextCommand)
-  SharedDtor(*this);
-}
-inline void TextCommand::SharedDtor(MessageLite& self) {
-  TextCommand& this_ = static_cast<TextCommand&>(self);
-  if constexpr (::_pbi::DebugHardenVerifyHasBitConsistency()) {
-    this_.VerifyHasBitConsistency();
-  }
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.text_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* PROTOBUF_NONNULL TextCommand::PlacementNew_(
-    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) TextCommand(arena);
-}
-constexpr auto TextCommand::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(TextCommand),
-                                            alignof(TextCommand));
-}
-constexpr auto TextCommand::InternalGenerateClassData_() {
-  return ::google::protobuf::internal::ClassDataFull{
-      ::google::protobuf::internal::ClassData{
-          &_TextCommand_default_instance_._instance,
-          &_table_.header,
-          nullptr,  // OnDemandRegisterArenaDtor
-          nullptr,  // IsInitialized
-          &TextCommand::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<TextCommand>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-          &TextCommand::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<TextCommand>(), &TextCommand::ByteSizeLong,
-              &TextCommand::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(TextCommand, _impl_._cached_size_),
-          false,
-      },
-      &TextCommand::kDescriptorMethods,
-      &descriptor_table_messages_2eproto,
-      nullptr,  // tracker
-  };
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull TextCommand_class_data_ =
-        TextCommand::InternalGenerateClassData_();
-
-PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-TextCommand::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&TextCommand_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(TextCommand_class_data_.tc_table);
-  return TextCommand_class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 0, 37, 2>
-TextCommand::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(TextCommand, _impl_._has_bits_),
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    TextCommand_class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::toysequencer::TextCommand>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string text = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 0, 0, PROTOBUF_FIELD_OFFSET(TextCommand, _impl_.text_)}},
-    // .toysequencer.MessageType msg_type = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TextCommand, _impl_.msg_type_), 3>(),
-     {8, 3, 0, PROTOBUF_FIELD_OFFSET(TextCommand, _impl_.msg_type_)}},
-    // uint64 sid = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TextCommand, _impl_.sid_), 1>(),
-     {16, 1, 0, PROTOBUF_FIELD_OFFSET(TextCommand, _impl_.sid_)}},
-    // uint64 tin = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TextCommand, _impl_.tin_), 2>(),
-     {24, 2, 0, PROTOBUF_FIELD_OFFSET(TextCommand, _impl_.tin_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .toysequencer.MessageType msg_type = 1;
-    {PROTOBUF_FIELD_OFFSET(TextCommand, _impl_.msg_type_), _Internal::kHasBitsOffset + 3, 0, (0 | ::_fl::kFcOptional | ::_fl::kOpenEnum)},
-    // uint64 sid = 2;
-    {PROTOBUF_FIELD_OFFSET(TextCommand, _impl_.sid_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
-    // uint64 tin = 3;
-    {PROTOBUF_FIELD_OFFSET(TextCommand, _impl_.tin_), _Internal::kHasBitsOffset + 2, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
-    // string text = 4;
-    {PROTOBUF_FIELD_OFFSET(TextCommand, _impl_.text_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\30\0\0\0\4\0\0\0"
-    "toysequencer.TextCommand"
-    "text"
-  }},
-};
-PROTOBUF_NOINLINE void TextCommand::Clear() {
+inline void TextCommand::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.text_.Destroy();
+}
+
+void TextCommand::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TextCommand::Clear() {
 // @@protoc_insertion_point(message_clear_start:toysequencer.TextCommand)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000001U) != 0) {
-    _impl_.text_.ClearNonDefaultToEmpty();
-  }
-  if ((cached_has_bits & 0x0000000eU) != 0) {
-    ::memset(&_impl_.sid_, 0, static_cast<::size_t>(
-        reinterpret_cast<char*>(&_impl_.msg_type_) -
-        reinterpret_cast<char*>(&_impl_.sid_)) + sizeof(_impl_.msg_type_));
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL TextCommand::_InternalSerialize(
-    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const TextCommand& this_ = static_cast<const TextCommand&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL TextCommand::_InternalSerialize(
-    ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const TextCommand& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  if constexpr (::_pbi::DebugHardenVerifyHasBitConsistency()) {
-    this_.VerifyHasBitConsistency();
-  }
+  _impl_.text_.ClearToEmpty();
+  ::memset(&_impl_.sid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.msg_type_) -
+      reinterpret_cast<char*>(&_impl_.sid_)) + sizeof(_impl_.msg_type_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TextCommand::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .toysequencer.MessageType msg_type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_msg_type(static_cast<::toysequencer::MessageType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.sid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 tin = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.tin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string text = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "toysequencer.TextCommand.text"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sender_epoch = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _impl_.sender_epoch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 cseq = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _impl_.cseq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TextCommand::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:toysequencer.TextCommand)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
   // .toysequencer.MessageType msg_type = 1;
-  if ((this_._impl_._has_bits_[0] & 0x00000008U) != 0) {
-    if (this_._internal_msg_type() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteEnumToArray(
-          1, this_._internal_msg_type(), target);
-    }
+  if (this->_internal_msg_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_msg_type(), target);
   }
 
   // uint64 sid = 2;
-  if ((this_._impl_._has_bits_[0] & 0x00000002U) != 0) {
-    if (this_._internal_sid() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-          2, this_._internal_sid(), target);
-    }
+  if (this->_internal_sid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_sid(), target);
   }
 
   // uint64 tin = 3;
-  if ((this_._impl_._has_bits_[0] & 0x00000004U) != 0) {
-    if (this_._internal_tin() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-          3, this_._internal_tin(), target);
-    }
+  if (this->_internal_tin() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_tin(), target);
   }
 
   // string text = 4;
-  if ((this_._impl_._has_bits_[0] & 0x00000001U) != 0) {
-    if (!this_._internal_text().empty()) {
-      const ::std::string& _s = this_._internal_text();
-      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "toysequencer.TextCommand.text");
-      target = stream->WriteStringMaybeAliased(4, _s, target);
-    }
+  if (!this->_internal_text().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "toysequencer.TextCommand.text");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_text(), target);
+  }
+
+  // uint64 sender_epoch = 14;
+  if (this->_internal_sender_epoch() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(14, this->_internal_sender_epoch(), target);
+  }
+
+  // uint64 cseq = 15;
+  if (this->_internal_cseq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(15, this->_internal_cseq(), target);
   }
 
-  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:toysequencer.TextCommand)
   return target;
 }
 
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t TextCommand::ByteSizeLong(const MessageLite& base) {
-  const TextCommand& this_ = static_cast<const TextCommand&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::size_t TextCommand::ByteSizeLong() const {
-  const TextCommand& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:toysequencer.TextCommand)
-  ::size_t total_size = 0;
+size_t TextCommand::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:toysequencer.TextCommand)
+  size_t total_size = 0;
 
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
-  (void)cached_has_bits;
-
-  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-  cached_has_bits = this_._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x0000000fU) != 0) {
-    // string text = 4;
-    if ((cached_has_bits & 0x00000001U) != 0) {
-      if (!this_._internal_text().empty()) {
-        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                        this_._internal_text());
-      }
-    }
-    // uint64 sid = 2;
-    if ((cached_has_bits & 0x00000002U) != 0) {
-      if (this_._internal_sid() != 0) {
-        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-            this_._internal_sid());
-      }
-    }
-    // uint64 tin = 3;
-    if ((cached_has_bits & 0x00000004U) != 0) {
-      if (this_._internal_tin() != 0) {
-        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-            this_._internal_tin());
-      }
-    }
-    // .toysequencer.MessageType msg_type = 1;
-    if ((cached_has_bits & 0x00000008U) != 0) {
-      if (this_._internal_msg_type() != 0) {
-        total_size += 1 +
-                      ::_pbi::WireFormatLite::EnumSize(this_._internal_msg_type());
-      }
-    }
+  (void) cached_has_bits;
+
+  // string text = 4;
+  if (!this->_internal_text().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_text());
+  }
+
+  // uint64 sid = 2;
+  if (this->_internal_sid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sid());
+  }
+
+  // uint64 tin = 3;
+  if (this->_internal_tin() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_tin());
+  }
+
+  // uint64 sender_epoch = 14;
+  if (this->_internal_sender_epoch() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sender_epoch());
+  }
+
+  // uint64 cseq = 15;
+  if (this->_internal_cseq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_cseq());
   }
-  return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                             &this_._impl_._cached_size_);
+
+  // .toysequencer.MessageType msg_type = 1;
+  if (this->_internal_msg_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_msg_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void TextCommand::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TextCommand::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TextCommand::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TextCommand::GetClassData() const { return &_class_data_; }
+
+
+void TextCommand::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
   auto* const _this = static_cast<TextCommand*>(&to_msg);
   auto& from = static_cast<const TextCommand&>(from_msg);
-  if constexpr (::_pbi::DebugHardenVerifyHasBitConsistency()) {
-    from.VerifyHasBitConsistency();
-  }
   // @@protoc_insertion_point(class_specific_merge_from_start:toysequencer.TextCommand)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x0000000fU) != 0) {
-    if ((cached_has_bits & 0x00000001U) != 0) {
-      if (!from._internal_text().empty()) {
-        _this->_internal_set_text(from._internal_text());
-      } else {
-        if (_this->_impl_.text_.IsDefault()) {
-          _this->_internal_set_text("");
-        }
-      }
-    }
-    if ((cached_has_bits & 0x00000002U) != 0) {
-      if (from._internal_sid() != 0) {
-        _this->_impl_.sid_ = from._impl_.sid_;
-      }
-    }
-    if ((cached_has_bits & 0x00000004U) != 0) {
-      if (from._internal_tin() != 0) {
-        _this->_impl_.tin_ = from._impl_.tin_;
-      }
-    }
-    if ((cached_has_bits & 0x00000008U) != 0) {
-      if (from._internal_msg_type() != 0) {
-        _this->_impl_.msg_type_ = from._impl_.msg_type_;
-      }
-    }
+  if (!from._internal_text().empty()) {
+    _this->_internal_set_text(from._internal_text());
+  }
+  if (from._internal_sid() != 0) {
+    _this->_internal_set_sid(from._internal_sid());
+  }
+  if (from._internal_tin() != 0) {
+    _this->_internal_set_tin(from._internal_tin());
+  }
+  if (from._internal_sender_epoch() != 0) {
+    _this->_internal_set_sender_epoch(from._internal_sender_epoch());
+  }
+  if (from._internal_cseq() != 0) {
+    _this->_internal_set_cseq(from._internal_cseq());
+  }
+  if (from._internal_msg_type() != 0) {
+    _this->_internal_set_msg_type(from._internal_msg_type());
   }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void TextCommand::CopyFrom(const TextCommand& from) {
@@ -658,15 +561,20 @@ void TextCommand::CopyFrom(const TextCommand& from) {
   MergeFrom(from);
 }
 
+bool TextCommand::IsInitialized() const {
+  return true;
+}
 
-void TextCommand::InternalSwap(TextCommand* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
-  using ::std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
+void TextCommand::InternalSwap(TextCommand* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.text_, &other->_impl_.text_, arena);
-  ::google::protobuf::internal::memswap<
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.text_, lhs_arena,
+      &other->_impl_.text_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
       PROTOBUF_FIELD_OFFSET(TextCommand, _impl_.msg_type_)
       + sizeof(TextCommand::_impl_.msg_type_)
       - PROTOBUF_FIELD_OFFSET(TextCommand, _impl_.sid_)>(
@@ -674,410 +582,362 @@ void TextCommand::InternalSwap(TextCommand* PROTOBUF_RESTRICT PROTOBUF_NONNULL o
           reinterpret_cast<char*>(&other->_impl_.sid_));
 }
 
-::google::protobuf::Metadata TextCommand::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+::PROTOBUF_NAMESPACE_ID::Metadata TextCommand::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[0]);
 }
+
 // ===================================================================
 
 class TextEvent::_Internal {
  public:
-  using HasBits =
-      decltype(::std::declval<TextEvent>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(TextEvent, _impl_._has_bits_);
 };
 
-TextEvent::TextEvent(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, TextEvent_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
+TextEvent::TextEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:toysequencer.TextEvent)
 }
-PROTOBUF_NDEBUG_INLINE TextEvent::Impl_::Impl_(
-    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
-    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    [[maybe_unused]] const ::toysequencer::TextEvent& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        text_(arena, from.text_) {}
-
-TextEvent::TextEvent(
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const TextEvent& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, TextEvent_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  TextEvent* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, seq_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, seq_),
-           offsetof(Impl_, msg_type_) -
-               offsetof(Impl_, seq_) +
-               sizeof(Impl_::msg_type_));
-
+TextEvent::TextEvent(const TextEvent& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TextEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.text_){}
+    , decltype(_impl_.seq_){}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.sid_){}
+    , decltype(_impl_.tin_){}
+    , decltype(_impl_.epoch_){}
+    , decltype(_impl_.cseq_){}
+    , decltype(_impl_.msg_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_text().empty()) {
+    _this->_impl_.text_.Set(from._internal_text(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.seq_, &from._impl_.seq_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.msg_type_) -
+    reinterpret_cast<char*>(&_impl_.seq_)) + sizeof(_impl_.msg_type_));
   // @@protoc_insertion_point(copy_constructor:toysequencer.TextEvent)
 }
-PROTOBUF_NDEBUG_INLINE TextEvent::Impl_::Impl_(
-    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
-    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-      : _cached_size_{0},
-        text_(arena) {}
-
-inline void TextEvent::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, seq_),
-           0,
-           offsetof(Impl_, msg_type_) -
-               offsetof(Impl_, seq_) +
-               sizeof(Impl_::msg_type_));
+
+inline void TextEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.text_){}
+    , decltype(_impl_.seq_){uint64_t{0u}}
+    , decltype(_impl_.timestamp_){uint64_t{0u}}
+    , decltype(_impl_.sid_){uint64_t{0u}}
+    , decltype(_impl_.tin_){uint64_t{0u}}
+    , decltype(_impl_.epoch_){uint64_t{0u}}
+    , decltype(_impl_.cseq_){uint64_t{0u}}
+    , decltype(_impl_.msg_type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
+
 TextEvent::~TextEvent() {
   // @@protoc_insertion_point(destructor:toysequencer.TextEvent)
-  SharedDtor(*this);
-}
-inline void TextEvent::SharedDtor(MessageLite& self) {
-  TextEvent& this_ = static_cast<TextEvent&>(self);
-  if constexpr (::_pbi::DebugHardenVerifyHasBitConsistency()) {
-    this_.VerifyHasBitConsistency();
-  }
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.text_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* PROTOBUF_NONNULL TextEvent::PlacementNew_(
-    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) TextEvent(arena);
-}
-constexpr auto TextEvent::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(TextEvent),
-                                            alignof(TextEvent));
-}
-constexpr auto TextEvent::InternalGenerateClassData_() {
-  return ::google::protobuf::internal::ClassDataFull{
-      ::google::protobuf::internal::ClassData{
-          &_TextEvent_default_instance_._instance,
-          &_table_.header,
-          nullptr,  // OnDemandRegisterArenaDtor
-          nullptr,  // IsInitialized
-          &TextEvent::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<TextEvent>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-          &TextEvent::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<TextEvent>(), &TextEvent::ByteSizeLong,
-              &TextEvent::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(TextEvent, _impl_._cached_size_),
-          false,
-      },
-      &TextEvent::kDescriptorMethods,
-      &descriptor_table_messages_2eproto,
-      nullptr,  // tracker
-  };
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull TextEvent_class_data_ =
-        TextEvent::InternalGenerateClassData_();
-
-PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-TextEvent::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&TextEvent_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(TextEvent_class_data_.tc_table);
-  return TextEvent_class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 6, 0, 35, 2>
-TextEvent::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(TextEvent, _impl_._has_bits_),
-    0, // no _extensions_
-    6, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967232,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    6,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    TextEvent_class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::toysequencer::TextEvent>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // .toysequencer.MessageType msg_type = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TextEvent, _impl_.msg_type_), 5>(),
-     {8, 5, 0, PROTOBUF_FIELD_OFFSET(TextEvent, _impl_.msg_type_)}},
-    // uint64 seq = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TextEvent, _impl_.seq_), 1>(),
-     {16, 1, 0, PROTOBUF_FIELD_OFFSET(TextEvent, _impl_.seq_)}},
-    // uint64 timestamp = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TextEvent, _impl_.timestamp_), 2>(),
-     {24, 2, 0, PROTOBUF_FIELD_OFFSET(TextEvent, _impl_.timestamp_)}},
-    // uint64 sid = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TextEvent, _impl_.sid_), 3>(),
-     {32, 3, 0, PROTOBUF_FIELD_OFFSET(TextEvent, _impl_.sid_)}},
-    // uint64 tin = 5;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TextEvent, _impl_.tin_), 4>(),
-     {40, 4, 0, PROTOBUF_FIELD_OFFSET(TextEvent, _impl_.tin_)}},
-    // string text = 6;
-    {::_pbi::TcParser::FastUS1,
-     {50, 0, 0, PROTOBUF_FIELD_OFFSET(TextEvent, _impl_.text_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .toysequencer.MessageType msg_type = 1;
-    {PROTOBUF_FIELD_OFFSET(TextEvent, _impl_.msg_type_), _Internal::kHasBitsOffset + 5, 0, (0 | ::_fl::kFcOptional | ::_fl::kOpenEnum)},
-    // uint64 seq = 2;
-    {PROTOBUF_FIELD_OFFSET(TextEvent, _impl_.seq_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
-    // uint64 timestamp = 3;
-    {PROTOBUF_FIELD_OFFSET(TextEvent, _impl_.timestamp_), _Internal::kHasBitsOffset + 2, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
-    // uint64 sid = 4;
-    {PROTOBUF_FIELD_OFFSET(TextEvent, _impl_.sid_), _Internal::kHasBitsOffset + 3, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
-    // uint64 tin = 5;
-    {PROTOBUF_FIELD_OFFSET(TextEvent, _impl_.tin_), _Internal::kHasBitsOffset + 4, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
-    // string text = 6;
-    {PROTOBUF_FIELD_OFFSET(TextEvent, _impl_.text_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\26\0\0\0\0\0\4\0"
-    "toysequencer.TextEvent"
-    "text"
-  }},
-};
-PROTOBUF_NOINLINE void TextEvent::Clear() {
+inline void TextEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.text_.Destroy();
+}
+
+void TextEvent::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TextEvent::Clear() {
 // @@protoc_insertion_point(message_clear_start:toysequencer.TextEvent)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000001U) != 0) {
-    _impl_.text_.ClearNonDefaultToEmpty();
-  }
-  if ((cached_has_bits & 0x0000003eU) != 0) {
-    ::memset(&_impl_.seq_, 0, static_cast<::size_t>(
-        reinterpret_cast<char*>(&_impl_.msg_type_) -
-        reinterpret_cast<char*>(&_impl_.seq_)) + sizeof(_impl_.msg_type_));
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL TextEvent::_InternalSerialize(
-    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const TextEvent& this_ = static_cast<const TextEvent&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL TextEvent::_InternalSerialize(
-    ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const TextEvent& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  if constexpr (::_pbi::DebugHardenVerifyHasBitConsistency()) {
-    this_.VerifyHasBitConsistency();
-  }
+  _impl_.text_.ClearToEmpty();
+  ::memset(&_impl_.seq_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.msg_type_) -
+      reinterpret_cast<char*>(&_impl_.seq_)) + sizeof(_impl_.msg_type_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TextEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .toysequencer.MessageType msg_type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_msg_type(static_cast<::toysequencer::MessageType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 seq = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 timestamp = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sid = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.sid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 tin = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.tin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string text = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "toysequencer.TextEvent.text"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 epoch = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _impl_.epoch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 cseq = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _impl_.cseq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TextEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:toysequencer.TextEvent)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
   // .toysequencer.MessageType msg_type = 1;
-  if ((this_._impl_._has_bits_[0] & 0x00000020U) != 0) {
-    if (this_._internal_msg_type() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteEnumToArray(
-          1, this_._internal_msg_type(), target);
-    }
+  if (this->_internal_msg_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_msg_type(), target);
   }
 
   // uint64 seq = 2;
-  if ((this_._impl_._has_bits_[0] & 0x00000002U) != 0) {
-    if (this_._internal_seq() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-          2, this_._internal_seq(), target);
-    }
+  if (this->_internal_seq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_seq(), target);
   }
 
   // uint64 timestamp = 3;
-  if ((this_._impl_._has_bits_[0] & 0x00000004U) != 0) {
-    if (this_._internal_timestamp() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-          3, this_._internal_timestamp(), target);
-    }
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_timestamp(), target);
   }
 
   // uint64 sid = 4;
-  if ((this_._impl_._has_bits_[0] & 0x00000008U) != 0) {
-    if (this_._internal_sid() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-          4, this_._internal_sid(), target);
-    }
+  if (this->_internal_sid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_sid(), target);
   }
 
   // uint64 tin = 5;
-  if ((this_._impl_._has_bits_[0] & 0x00000010U) != 0) {
-    if (this_._internal_tin() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-          5, this_._internal_tin(), target);
-    }
+  if (this->_internal_tin() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_tin(), target);
   }
 
   // string text = 6;
-  if ((this_._impl_._has_bits_[0] & 0x00000001U) != 0) {
-    if (!this_._internal_text().empty()) {
-      const ::std::string& _s = this_._internal_text();
-      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "toysequencer.TextEvent.text");
-      target = stream->WriteStringMaybeAliased(6, _s, target);
-    }
+  if (!this->_internal_text().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "toysequencer.TextEvent.text");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_text(), target);
+  }
+
+  // uint64 epoch = 14;
+  if (this->_internal_epoch() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(14, this->_internal_epoch(), target);
+  }
+
+  // uint64 cseq = 15;
+  if (this->_internal_cseq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(15, this->_internal_cseq(), target);
   }
 
-  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:toysequencer.TextEvent)
   return target;
 }
 
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t TextEvent::ByteSizeLong(const MessageLite& base) {
-  const TextEvent& this_ = static_cast<const TextEvent&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::size_t TextEvent::ByteSizeLong() const {
-  const TextEvent& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:toysequencer.TextEvent)
-  ::size_t total_size = 0;
+size_t TextEvent::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:toysequencer.TextEvent)
+  size_t total_size = 0;
 
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
-  (void)cached_has_bits;
-
-  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-  cached_has_bits = this_._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x0000003fU) != 0) {
-    // string text = 6;
-    if ((cached_has_bits & 0x00000001U) != 0) {
-      if (!this_._internal_text().empty()) {
-        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                        this_._internal_text());
-      }
-    }
-    // uint64 seq = 2;
-    if ((cached_has_bits & 0x00000002U) != 0) {
-      if (this_._internal_seq() != 0) {
-        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-            this_._internal_seq());
-      }
-    }
-    // uint64 timestamp = 3;
-    if ((cached_has_bits & 0x00000004U) != 0) {
-      if (this_._internal_timestamp() != 0) {
-        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-            this_._internal_timestamp());
-      }
-    }
-    // uint64 sid = 4;
-    if ((cached_has_bits & 0x00000008U) != 0) {
-      if (this_._internal_sid() != 0) {
-        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-            this_._internal_sid());
-      }
-    }
-    // uint64 tin = 5;
-    if ((cached_has_bits & 0x00000010U) != 0) {
-      if (this_._internal_tin() != 0) {
-        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-            this_._internal_tin());
-      }
-    }
-    // .toysequencer.MessageType msg_type = 1;
-    if ((cached_has_bits & 0x00000020U) != 0) {
-      if (this_._internal_msg_type() != 0) {
-        total_size += 1 +
-                      ::_pbi::WireFormatLite::EnumSize(this_._internal_msg_type());
-      }
-    }
+  (void) cached_has_bits;
+
+  // string text = 6;
+  if (!this->_internal_text().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_text());
   }
-  return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                             &this_._impl_._cached_size_);
+
+  // uint64 seq = 2;
+  if (this->_internal_seq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_seq());
+  }
+
+  // uint64 timestamp = 3;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp());
+  }
+
+  // uint64 sid = 4;
+  if (this->_internal_sid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sid());
+  }
+
+  // uint64 tin = 5;
+  if (this->_internal_tin() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_tin());
+  }
+
+  // uint64 epoch = 14;
+  if (this->_internal_epoch() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_epoch());
+  }
+
+  // uint64 cseq = 15;
+  if (this->_internal_cseq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_cseq());
+  }
+
+  // .toysequencer.MessageType msg_type = 1;
+  if (this->_internal_msg_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_msg_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void TextEvent::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TextEvent::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TextEvent::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TextEvent::GetClassData() const { return &_class_data_; }
+
+
+void TextEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
   auto* const _this = static_cast<TextEvent*>(&to_msg);
   auto& from = static_cast<const TextEvent&>(from_msg);
-  if constexpr (::_pbi::DebugHardenVerifyHasBitConsistency()) {
-    from.VerifyHasBitConsistency();
-  }
   // @@protoc_insertion_point(class_specific_merge_from_start:toysequencer.TextEvent)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x0000003fU) != 0) {
-    if ((cached_has_bits & 0x00000001U) != 0) {
-      if (!from._internal_text().empty()) {
-        _this->_internal_set_text(from._internal_text());
-      } else {
-        if (_this->_impl_.text_.IsDefault()) {
-          _this->_internal_set_text("");
-        }
-      }
-    }
-    if ((cached_has_bits & 0x00000002U) != 0) {
-      if (from._internal_seq() != 0) {
-        _this->_impl_.seq_ = from._impl_.seq_;
-      }
-    }
-    if ((cached_has_bits & 0x00000004U) != 0) {
-      if (from._internal_timestamp() != 0) {
-        _this->_impl_.timestamp_ = from._impl_.timestamp_;
-      }
-    }
-    if ((cached_has_bits & 0x00000008U) != 0) {
-      if (from._internal_sid() != 0) {
-        _this->_impl_.sid_ = from._impl_.sid_;
-      }
-    }
-    if ((cached_has_bits & 0x00000010U) != 0) {
-      if (from._internal_tin() != 0) {
-        _this->_impl_.tin_ = from._impl_.tin_;
-      }
-    }
-    if ((cached_has_bits & 0x00000020U) != 0) {
-      if (from._internal_msg_type() != 0) {
-        _this->_impl_.msg_type_ = from._impl_.msg_type_;
-      }
-    }
+  if (!from._internal_text().empty()) {
+    _this->_internal_set_text(from._internal_text());
   }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_seq() != 0) {
+    _this->_internal_set_seq(from._internal_seq());
+  }
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  if (from._internal_sid() != 0) {
+    _this->_internal_set_sid(from._internal_sid());
+  }
+  if (from._internal_tin() != 0) {
+    _this->_internal_set_tin(from._internal_tin());
+  }
+  if (from._internal_epoch() != 0) {
+    _this->_internal_set_epoch(from._internal_epoch());
+  }
+  if (from._internal_cseq() != 0) {
+    _this->_internal_set_cseq(from._internal_cseq());
+  }
+  if (from._internal_msg_type() != 0) {
+    _this->_internal_set_msg_type(from._internal_msg_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void TextEvent::CopyFrom(const TextEvent& from) {
@@ -1087,15 +947,20 @@ void TextEvent::CopyFrom(const TextEvent& from) {
   MergeFrom(from);
 }
 
+bool TextEvent::IsInitialized() const {
+  return true;
+}
 
-void TextEvent::InternalSwap(TextEvent* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
-  using ::std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
+void TextEvent::InternalSwap(TextEvent* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.text_, &other->_impl_.text_, arena);
-  ::google::protobuf::internal::memswap<
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.text_, lhs_arena,
+      &other->_impl_.text_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
       PROTOBUF_FIELD_OFFSET(TextEvent, _impl_.msg_type_)
       + sizeof(TextEvent::_impl_.msg_type_)
       - PROTOBUF_FIELD_OFFSET(TextEvent, _impl_.seq_)>(
@@ -1103,494 +968,458 @@ void TextEvent::InternalSwap(TextEvent* PROTOBUF_RESTRICT PROTOBUF_NONNULL other
           reinterpret_cast<char*>(&other->_impl_.seq_));
 }
 
-::google::protobuf::Metadata TextEvent::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+::PROTOBUF_NAMESPACE_ID::Metadata TextEvent::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[1]);
 }
+
 // ===================================================================
 
 class TopOfBookCommand::_Internal {
  public:
-  using HasBits =
-      decltype(::std::declval<TopOfBookCommand>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_._has_bits_);
 };
 
-TopOfBookCommand::TopOfBookCommand(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, TopOfBookCommand_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
+TopOfBookCommand::TopOfBookCommand(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:toysequencer.TopOfBookCommand)
 }
-PROTOBUF_NDEBUG_INLINE TopOfBookCommand::Impl_::Impl_(
-    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
-    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    [[maybe_unused]] const ::toysequencer::TopOfBookCommand& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        symbol_(arena, from.symbol_) {}
-
-TopOfBookCommand::TopOfBookCommand(
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const TopOfBookCommand& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, TopOfBookCommand_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  TopOfBookCommand* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, sid_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, sid_),
-           offsetof(Impl_, msg_type_) -
-               offsetof(Impl_, sid_) +
-               sizeof(Impl_::msg_type_));
-
+TopOfBookCommand::TopOfBookCommand(const TopOfBookCommand& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TopOfBookCommand* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.symbol_){}
+    , decltype(_impl_.sid_){}
+    , decltype(_impl_.tin_){}
+    , decltype(_impl_.bid_price_){}
+    , decltype(_impl_.bid_size_){}
+    , decltype(_impl_.ask_price_){}
+    , decltype(_impl_.ask_size_){}
+    , decltype(_impl_.exchange_time_){}
+    , decltype(_impl_.sender_epoch_){}
+    , decltype(_impl_.cseq_){}
+    , decltype(_impl_.msg_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.symbol_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.symbol_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_symbol().empty()) {
+    _this->_impl_.symbol_.Set(from._internal_symbol(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.sid_, &from._impl_.sid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.msg_type_) -
+    reinterpret_cast<char*>(&_impl_.sid_)) + sizeof(_impl_.msg_type_));
   // @@protoc_insertion_point(copy_constructor:toysequencer.TopOfBookCommand)
 }
-PROTOBUF_NDEBUG_INLINE TopOfBookCommand::Impl_::Impl_(
-    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
-    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-      : _cached_size_{0},
-        symbol_(arena) {}
-
-inline void TopOfBookCommand::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, sid_),
-           0,
-           offsetof(Impl_, msg_type_) -
-               offsetof(Impl_, sid_) +
-               sizeof(Impl_::msg_type_));
+
+inline void TopOfBookCommand::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.symbol_){}
+    , decltype(_impl_.sid_){uint64_t{0u}}
+    , decltype(_impl_.tin_){uint64_t{0u}}
+    , decltype(_impl_.bid_price_){0}
+    , decltype(_impl_.bid_size_){uint64_t{0u}}
+    , decltype(_impl_.ask_price_){0}
+    , decltype(_impl_.ask_size_){uint64_t{0u}}
+    , decltype(_impl_.exchange_time_){uint64_t{0u}}
+    , decltype(_impl_.sender_epoch_){uint64_t{0u}}
+    , decltype(_impl_.cseq_){uint64_t{0u}}
+    , decltype(_impl_.msg_type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.symbol_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.symbol_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
+
 TopOfBookCommand::~TopOfBookCommand() {
   // @@protoc_insertion_point(destructor:toysequencer.TopOfBookCommand)
-  SharedDtor(*this);
-}
-inline void TopOfBookCommand::SharedDtor(MessageLite& self) {
-  TopOfBookCommand& this_ = static_cast<TopOfBookCommand&>(self);
-  if constexpr (::_pbi::DebugHardenVerifyHasBitConsistency()) {
-    this_.VerifyHasBitConsistency();
-  }
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.symbol_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* PROTOBUF_NONNULL TopOfBookCommand::PlacementNew_(
-    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) TopOfBookCommand(arena);
-}
-constexpr auto TopOfBookCommand::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(TopOfBookCommand),
-                                            alignof(TopOfBookCommand));
-}
-constexpr auto TopOfBookCommand::InternalGenerateClassData_() {
-  return ::google::protobuf::internal::ClassDataFull{
-      ::google::protobuf::internal::ClassData{
-          &_TopOfBookCommand_default_instance_._instance,
-          &_table_.header,
-          nullptr,  // OnDemandRegisterArenaDtor
-          nullptr,  // IsInitialized
-          &TopOfBookCommand::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<TopOfBookCommand>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-          &TopOfBookCommand::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<TopOfBookCommand>(), &TopOfBookCommand::ByteSizeLong,
-              &TopOfBookCommand::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_._cached_size_),
-          false,
-      },
-      &TopOfBookCommand::kDescriptorMethods,
-      &descriptor_table_messages_2eproto,
-      nullptr,  // tracker
-  };
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull TopOfBookCommand_class_data_ =
-        TopOfBookCommand::InternalGenerateClassData_();
-
-PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-TopOfBookCommand::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&TopOfBookCommand_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(TopOfBookCommand_class_data_.tc_table);
-  return TopOfBookCommand_class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<4, 9, 0, 52, 2>
-TopOfBookCommand::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_._has_bits_),
-    0, // no _extensions_
-    9, 120,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294966784,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    9,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    TopOfBookCommand_class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::toysequencer::TopOfBookCommand>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // .toysequencer.MessageType msg_type = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TopOfBookCommand, _impl_.msg_type_), 8>(),
-     {8, 8, 0, PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_.msg_type_)}},
-    // uint64 sid = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TopOfBookCommand, _impl_.sid_), 1>(),
-     {16, 1, 0, PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_.sid_)}},
-    // uint64 tin = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TopOfBookCommand, _impl_.tin_), 2>(),
-     {24, 2, 0, PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_.tin_)}},
-    // string symbol = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 0, 0, PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_.symbol_)}},
-    // double bid_price = 5;
-    {::_pbi::TcParser::FastF64S1,
-     {41, 3, 0, PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_.bid_price_)}},
-    // uint64 bid_size = 6;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TopOfBookCommand, _impl_.bid_size_), 4>(),
-     {48, 4, 0, PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_.bid_size_)}},
-    // double ask_price = 7;
-    {::_pbi::TcParser::FastF64S1,
-     {57, 5, 0, PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_.ask_price_)}},
-    // uint64 ask_size = 8;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TopOfBookCommand, _impl_.ask_size_), 6>(),
-     {64, 6, 0, PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_.ask_size_)}},
-    // uint64 exchange_time = 9;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TopOfBookCommand, _impl_.exchange_time_), 7>(),
-     {72, 7, 0, PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_.exchange_time_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .toysequencer.MessageType msg_type = 1;
-    {PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_.msg_type_), _Internal::kHasBitsOffset + 8, 0, (0 | ::_fl::kFcOptional | ::_fl::kOpenEnum)},
-    // uint64 sid = 2;
-    {PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_.sid_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
-    // uint64 tin = 3;
-    {PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_.tin_), _Internal::kHasBitsOffset + 2, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
-    // string symbol = 4;
-    {PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_.symbol_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // double bid_price = 5;
-    {PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_.bid_price_), _Internal::kHasBitsOffset + 3, 0, (0 | ::_fl::kFcOptional | ::_fl::kDouble)},
-    // uint64 bid_size = 6;
-    {PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_.bid_size_), _Internal::kHasBitsOffset + 4, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
-    // double ask_price = 7;
-    {PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_.ask_price_), _Internal::kHasBitsOffset + 5, 0, (0 | ::_fl::kFcOptional | ::_fl::kDouble)},
-    // uint64 ask_size = 8;
-    {PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_.ask_size_), _Internal::kHasBitsOffset + 6, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
-    // uint64 exchange_time = 9;
-    {PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_.exchange_time_), _Internal::kHasBitsOffset + 7, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
-  }},
-  // no aux_entries
-  {{
-    "\35\0\0\0\6\0\0\0\0\0\0\0\0\0\0\0"
-    "toysequencer.TopOfBookCommand"
-    "symbol"
-  }},
-};
-PROTOBUF_NOINLINE void TopOfBookCommand::Clear() {
+inline void TopOfBookCommand::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.symbol_.Destroy();
+}
+
+void TopOfBookCommand::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TopOfBookCommand::Clear() {
 // @@protoc_insertion_point(message_clear_start:toysequencer.TopOfBookCommand)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000001U) != 0) {
-    _impl_.symbol_.ClearNonDefaultToEmpty();
-  }
-  if ((cached_has_bits & 0x000000feU) != 0) {
-    ::memset(&_impl_.sid_, 0, static_cast<::size_t>(
-        reinterpret_cast<char*>(&_impl_.exchange_time_) -
-        reinterpret_cast<char*>(&_impl_.sid_)) + sizeof(_impl_.exchange_time_));
-  }
-  _impl_.msg_type_ = 0;
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL TopOfBookCommand::_InternalSerialize(
-    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const TopOfBookCommand& this_ = static_cast<const TopOfBookCommand&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL TopOfBookCommand::_InternalSerialize(
-    ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const TopOfBookCommand& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  if constexpr (::_pbi::DebugHardenVerifyHasBitConsistency()) {
-    this_.VerifyHasBitConsistency();
-  }
+  _impl_.symbol_.ClearToEmpty();
+  ::memset(&_impl_.sid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.msg_type_) -
+      reinterpret_cast<char*>(&_impl_.sid_)) + sizeof(_impl_.msg_type_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TopOfBookCommand::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .toysequencer.MessageType msg_type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_msg_type(static_cast<::toysequencer::MessageType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.sid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 tin = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.tin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string symbol = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_symbol();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "toysequencer.TopOfBookCommand.symbol"));
+        } else
+          goto handle_unusual;
+        continue;
+      // double bid_price = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.bid_price_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 bid_size = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.bid_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double ask_price = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _impl_.ask_price_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 ask_size = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.ask_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 exchange_time = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.exchange_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sender_epoch = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _impl_.sender_epoch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 cseq = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _impl_.cseq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TopOfBookCommand::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:toysequencer.TopOfBookCommand)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
   // .toysequencer.MessageType msg_type = 1;
-  if ((this_._impl_._has_bits_[0] & 0x00000100U) != 0) {
-    if (this_._internal_msg_type() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteEnumToArray(
-          1, this_._internal_msg_type(), target);
-    }
+  if (this->_internal_msg_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_msg_type(), target);
   }
 
   // uint64 sid = 2;
-  if ((this_._impl_._has_bits_[0] & 0x00000002U) != 0) {
-    if (this_._internal_sid() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-          2, this_._internal_sid(), target);
-    }
+  if (this->_internal_sid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_sid(), target);
   }
 
   // uint64 tin = 3;
-  if ((this_._impl_._has_bits_[0] & 0x00000004U) != 0) {
-    if (this_._internal_tin() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-          3, this_._internal_tin(), target);
-    }
+  if (this->_internal_tin() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_tin(), target);
   }
 
   // string symbol = 4;
-  if ((this_._impl_._has_bits_[0] & 0x00000001U) != 0) {
-    if (!this_._internal_symbol().empty()) {
-      const ::std::string& _s = this_._internal_symbol();
-      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "toysequencer.TopOfBookCommand.symbol");
-      target = stream->WriteStringMaybeAliased(4, _s, target);
-    }
+  if (!this->_internal_symbol().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_symbol().data(), static_cast<int>(this->_internal_symbol().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "toysequencer.TopOfBookCommand.symbol");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_symbol(), target);
   }
 
   // double bid_price = 5;
-  if ((this_._impl_._has_bits_[0] & 0x00000008U) != 0) {
-    if (::absl::bit_cast<::uint64_t>(this_._internal_bid_price()) != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-          5, this_._internal_bid_price(), target);
-    }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_bid_price = this->_internal_bid_price();
+  uint64_t raw_bid_price;
+  memcpy(&raw_bid_price, &tmp_bid_price, sizeof(tmp_bid_price));
+  if (raw_bid_price != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_bid_price(), target);
   }
 
   // uint64 bid_size = 6;
-  if ((this_._impl_._has_bits_[0] & 0x00000010U) != 0) {
-    if (this_._internal_bid_size() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-          6, this_._internal_bid_size(), target);
-    }
+  if (this->_internal_bid_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_bid_size(), target);
   }
 
   // double ask_price = 7;
-  if ((this_._impl_._has_bits_[0] & 0x00000020U) != 0) {
-    if (::absl::bit_cast<::uint64_t>(this_._internal_ask_price()) != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-          7, this_._internal_ask_price(), target);
-    }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_ask_price = this->_internal_ask_price();
+  uint64_t raw_ask_price;
+  memcpy(&raw_ask_price, &tmp_ask_price, sizeof(tmp_ask_price));
+  if (raw_ask_price != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_ask_price(), target);
   }
 
   // uint64 ask_size = 8;
-  if ((this_._impl_._has_bits_[0] & 0x00000040U) != 0) {
-    if (this_._internal_ask_size() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-          8, this_._internal_ask_size(), target);
-    }
+  if (this->_internal_ask_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_ask_size(), target);
   }
 
   // uint64 exchange_time = 9;
-  if ((this_._impl_._has_bits_[0] & 0x00000080U) != 0) {
-    if (this_._internal_exchange_time() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-          9, this_._internal_exchange_time(), target);
-    }
+  if (this->_internal_exchange_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_exchange_time(), target);
+  }
+
+  // uint64 sender_epoch = 14;
+  if (this->_internal_sender_epoch() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(14, this->_internal_sender_epoch(), target);
+  }
+
+  // uint64 cseq = 15;
+  if (this->_internal_cseq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(15, this->_internal_cseq(), target);
   }
 
-  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:toysequencer.TopOfBookCommand)
   return target;
 }
 
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t TopOfBookCommand::ByteSizeLong(const MessageLite& base) {
-  const TopOfBookCommand& this_ = static_cast<const TopOfBookCommand&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::size_t TopOfBookCommand::ByteSizeLong() const {
-  const TopOfBookCommand& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:toysequencer.TopOfBookCommand)
-  ::size_t total_size = 0;
+size_t TopOfBookCommand::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:toysequencer.TopOfBookCommand)
+  size_t total_size = 0;
 
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
-  (void)cached_has_bits;
-
-  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-  cached_has_bits = this_._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x000000ffU) != 0) {
-    // string symbol = 4;
-    if ((cached_has_bits & 0x00000001U) != 0) {
-      if (!this_._internal_symbol().empty()) {
-        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                        this_._internal_symbol());
-      }
-    }
-    // uint64 sid = 2;
-    if ((cached_has_bits & 0x00000002U) != 0) {
-      if (this_._internal_sid() != 0) {
-        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-            this_._internal_sid());
-      }
-    }
-    // uint64 tin = 3;
-    if ((cached_has_bits & 0x00000004U) != 0) {
-      if (this_._internal_tin() != 0) {
-        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-            this_._internal_tin());
-      }
-    }
-    // double bid_price = 5;
-    if ((cached_has_bits & 0x00000008U) != 0) {
-      if (::absl::bit_cast<::uint64_t>(this_._internal_bid_price()) != 0) {
-        total_size += 9;
-      }
-    }
-    // uint64 bid_size = 6;
-    if ((cached_has_bits & 0x00000010U) != 0) {
-      if (this_._internal_bid_size() != 0) {
-        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-            this_._internal_bid_size());
-      }
-    }
-    // double ask_price = 7;
-    if ((cached_has_bits & 0x00000020U) != 0) {
-      if (::absl::bit_cast<::uint64_t>(this_._internal_ask_price()) != 0) {
-        total_size += 9;
-      }
-    }
-    // uint64 ask_size = 8;
-    if ((cached_has_bits & 0x00000040U) != 0) {
-      if (this_._internal_ask_size() != 0) {
-        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-            this_._internal_ask_size());
-      }
-    }
-    // uint64 exchange_time = 9;
-    if ((cached_has_bits & 0x00000080U) != 0) {
-      if (this_._internal_exchange_time() != 0) {
-        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-            this_._internal_exchange_time());
-      }
-    }
+  (void) cached_has_bits;
+
+  // string symbol = 4;
+  if (!this->_internal_symbol().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_symbol());
   }
-   {
-    // .toysequencer.MessageType msg_type = 1;
-    if ((cached_has_bits & 0x00000100U) != 0) {
-      if (this_._internal_msg_type() != 0) {
-        total_size += 1 +
-                      ::_pbi::WireFormatLite::EnumSize(this_._internal_msg_type());
-      }
-    }
+
+  // uint64 sid = 2;
+  if (this->_internal_sid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sid());
+  }
+
+  // uint64 tin = 3;
+  if (this->_internal_tin() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_tin());
+  }
+
+  // double bid_price = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_bid_price = this->_internal_bid_price();
+  uint64_t raw_bid_price;
+  memcpy(&raw_bid_price, &tmp_bid_price, sizeof(tmp_bid_price));
+  if (raw_bid_price != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 bid_size = 6;
+  if (this->_internal_bid_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bid_size());
   }
-  return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                             &this_._impl_._cached_size_);
+
+  // double ask_price = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_ask_price = this->_internal_ask_price();
+  uint64_t raw_ask_price;
+  memcpy(&raw_ask_price, &tmp_ask_price, sizeof(tmp_ask_price));
+  if (raw_ask_price != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 ask_size = 8;
+  if (this->_internal_ask_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_ask_size());
+  }
+
+  // uint64 exchange_time = 9;
+  if (this->_internal_exchange_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_exchange_time());
+  }
+
+  // uint64 sender_epoch = 14;
+  if (this->_internal_sender_epoch() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sender_epoch());
+  }
+
+  // uint64 cseq = 15;
+  if (this->_internal_cseq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_cseq());
+  }
+
+  // .toysequencer.MessageType msg_type = 1;
+  if (this->_internal_msg_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_msg_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void TopOfBookCommand::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TopOfBookCommand::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TopOfBookCommand::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TopOfBookCommand::GetClassData() const { return &_class_data_; }
+
+
+void TopOfBookCommand::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
   auto* const _this = static_cast<TopOfBookCommand*>(&to_msg);
   auto& from = static_cast<const TopOfBookCommand&>(from_msg);
-  if constexpr (::_pbi::DebugHardenVerifyHasBitConsistency()) {
-    from.VerifyHasBitConsistency();
-  }
   // @@protoc_insertion_point(class_specific_merge_from_start:toysequencer.TopOfBookCommand)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x000000ffU) != 0) {
-    if ((cached_has_bits & 0x00000001U) != 0) {
-      if (!from._internal_symbol().empty()) {
-        _this->_internal_set_symbol(from._internal_symbol());
-      } else {
-        if (_this->_impl_.symbol_.IsDefault()) {
-          _this->_internal_set_symbol("");
-        }
-      }
-    }
-    if ((cached_has_bits & 0x00000002U) != 0) {
-      if (from._internal_sid() != 0) {
-        _this->_impl_.sid_ = from._impl_.sid_;
-      }
-    }
-    if ((cached_has_bits & 0x00000004U) != 0) {
-      if (from._internal_tin() != 0) {
-        _this->_impl_.tin_ = from._impl_.tin_;
-      }
-    }
-    if ((cached_has_bits & 0x00000008U) != 0) {
-      if (::absl::bit_cast<::uint64_t>(from._internal_bid_price()) != 0) {
-        _this->_impl_.bid_price_ = from._impl_.bid_price_;
-      }
-    }
-    if ((cached_has_bits & 0x00000010U) != 0) {
-      if (from._internal_bid_size() != 0) {
-        _this->_impl_.bid_size_ = from._impl_.bid_size_;
-      }
-    }
-    if ((cached_has_bits & 0x00000020U) != 0) {
-      if (::absl::bit_cast<::uint64_t>(from._internal_ask_price()) != 0) {
-        _this->_impl_.ask_price_ = from._impl_.ask_price_;
-      }
-    }
-    if ((cached_has_bits & 0x00000040U) != 0) {
-      if (from._internal_ask_size() != 0) {
-        _this->_impl_.ask_size_ = from._impl_.ask_size_;
-      }
-    }
-    if ((cached_has_bits & 0x00000080U) != 0) {
-      if (from._internal_exchange_time() != 0) {
-        _this->_impl_.exchange_time_ = from._impl_.exchange_time_;
-      }
-    }
+  if (!from._internal_symbol().empty()) {
+    _this->_internal_set_symbol(from._internal_symbol());
   }
-  if ((cached_has_bits & 0x00000100U) != 0) {
-    if (from._internal_msg_type() != 0) {
-      _this->_impl_.msg_type_ = from._impl_.msg_type_;
-    }
+  if (from._internal_sid() != 0) {
+    _this->_internal_set_sid(from._internal_sid());
+  }
+  if (from._internal_tin() != 0) {
+    _this->_internal_set_tin(from._internal_tin());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_bid_price = from._internal_bid_price();
+  uint64_t raw_bid_price;
+  memcpy(&raw_bid_price, &tmp_bid_price, sizeof(tmp_bid_price));
+  if (raw_bid_price != 0) {
+    _this->_internal_set_bid_price(from._internal_bid_price());
+  }
+  if (from._internal_bid_size() != 0) {
+    _this->_internal_set_bid_size(from._internal_bid_size());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_ask_price = from._internal_ask_price();
+  uint64_t raw_ask_price;
+  memcpy(&raw_ask_price, &tmp_ask_price, sizeof(tmp_ask_price));
+  if (raw_ask_price != 0) {
+    _this->_internal_set_ask_price(from._internal_ask_price());
+  }
+  if (from._internal_ask_size() != 0) {
+    _this->_internal_set_ask_size(from._internal_ask_size());
   }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_exchange_time() != 0) {
+    _this->_internal_set_exchange_time(from._internal_exchange_time());
+  }
+  if (from._internal_sender_epoch() != 0) {
+    _this->_internal_set_sender_epoch(from._internal_sender_epoch());
+  }
+  if (from._internal_cseq() != 0) {
+    _this->_internal_set_cseq(from._internal_cseq());
+  }
+  if (from._internal_msg_type() != 0) {
+    _this->_internal_set_msg_type(from._internal_msg_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void TopOfBookCommand::CopyFrom(const TopOfBookCommand& from) {
@@ -1600,15 +1429,20 @@ void TopOfBookCommand::CopyFrom(const TopOfBookCommand& from) {
   MergeFrom(from);
 }
 
+bool TopOfBookCommand::IsInitialized() const {
+  return true;
+}
 
-void TopOfBookCommand::InternalSwap(TopOfBookCommand* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
-  using ::std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
+void TopOfBookCommand::InternalSwap(TopOfBookCommand* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.symbol_, &other->_impl_.symbol_, arena);
-  ::google::protobuf::internal::memswap<
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.symbol_, lhs_arena,
+      &other->_impl_.symbol_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
       PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_.msg_type_)
       + sizeof(TopOfBookCommand::_impl_.msg_type_)
       - PROTOBUF_FIELD_OFFSET(TopOfBookCommand, _impl_.sid_)>(
@@ -1616,550 +1450,506 @@ void TopOfBookCommand::InternalSwap(TopOfBookCommand* PROTOBUF_RESTRICT PROTOBUF
           reinterpret_cast<char*>(&other->_impl_.sid_));
 }
 
-::google::protobuf::Metadata TopOfBookCommand::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+::PROTOBUF_NAMESPACE_ID::Metadata TopOfBookCommand::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[2]);
 }
+
 // ===================================================================
 
 class TopOfBookEvent::_Internal {
  public:
-  using HasBits =
-      decltype(::std::declval<TopOfBookEvent>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_._has_bits_);
 };
 
-TopOfBookEvent::TopOfBookEvent(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, TopOfBookEvent_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
+TopOfBookEvent::TopOfBookEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:toysequencer.TopOfBookEvent)
 }
-PROTOBUF_NDEBUG_INLINE TopOfBookEvent::Impl_::Impl_(
-    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
-    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-    [[maybe_unused]] const ::toysequencer::TopOfBookEvent& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        symbol_(arena, from.symbol_) {}
-
-TopOfBookEvent::TopOfBookEvent(
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
-    const TopOfBookEvent& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, TopOfBookEvent_class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  TopOfBookEvent* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, seq_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, seq_),
-           offsetof(Impl_, msg_type_) -
-               offsetof(Impl_, seq_) +
-               sizeof(Impl_::msg_type_));
-
+TopOfBookEvent::TopOfBookEvent(const TopOfBookEvent& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TopOfBookEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.symbol_){}
+    , decltype(_impl_.seq_){}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.sid_){}
+    , decltype(_impl_.tin_){}
+    , decltype(_impl_.bid_price_){}
+    , decltype(_impl_.bid_size_){}
+    , decltype(_impl_.ask_price_){}
+    , decltype(_impl_.ask_size_){}
+    , decltype(_impl_.exchange_time_){}
+    , decltype(_impl_.epoch_){}
+    , decltype(_impl_.cseq_){}
+    , decltype(_impl_.msg_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.symbol_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.symbol_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_symbol().empty()) {
+    _this->_impl_.symbol_.Set(from._internal_symbol(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.seq_, &from._impl_.seq_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.msg_type_) -
+    reinterpret_cast<char*>(&_impl_.seq_)) + sizeof(_impl_.msg_type_));
   // @@protoc_insertion_point(copy_constructor:toysequencer.TopOfBookEvent)
 }
-PROTOBUF_NDEBUG_INLINE TopOfBookEvent::Impl_::Impl_(
-    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
-    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-      : _cached_size_{0},
-        symbol_(arena) {}
-
-inline void TopOfBookEvent::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, seq_),
-           0,
-           offsetof(Impl_, msg_type_) -
-               offsetof(Impl_, seq_) +
-               sizeof(Impl_::msg_type_));
+
+inline void TopOfBookEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.symbol_){}
+    , decltype(_impl_.seq_){uint64_t{0u}}
+    , decltype(_impl_.timestamp_){uint64_t{0u}}
+    , decltype(_impl_.sid_){uint64_t{0u}}
+    , decltype(_impl_.tin_){uint64_t{0u}}
+    , decltype(_impl_.bid_price_){0}
+    , decltype(_impl_.bid_size_){uint64_t{0u}}
+    , decltype(_impl_.ask_price_){0}
+    , decltype(_impl_.ask_size_){uint64_t{0u}}
+    , decltype(_impl_.exchange_time_){uint64_t{0u}}
+    , decltype(_impl_.epoch_){uint64_t{0u}}
+    , decltype(_impl_.cseq_){uint64_t{0u}}
+    , decltype(_impl_.msg_type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.symbol_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.symbol_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
+
 TopOfBookEvent::~TopOfBookEvent() {
   // @@protoc_insertion_point(destructor:toysequencer.TopOfBookEvent)
-  SharedDtor(*this);
-}
-inline void TopOfBookEvent::SharedDtor(MessageLite& self) {
-  TopOfBookEvent& this_ = static_cast<TopOfBookEvent&>(self);
-  if constexpr (::_pbi::DebugHardenVerifyHasBitConsistency()) {
-    this_.VerifyHasBitConsistency();
-  }
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.symbol_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* PROTOBUF_NONNULL TopOfBookEvent::PlacementNew_(
-    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
-  return ::new (mem) TopOfBookEvent(arena);
-}
-constexpr auto TopOfBookEvent::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(TopOfBookEvent),
-                                            alignof(TopOfBookEvent));
-}
-constexpr auto TopOfBookEvent::InternalGenerateClassData_() {
-  return ::google::protobuf::internal::ClassDataFull{
-      ::google::protobuf::internal::ClassData{
-          &_TopOfBookEvent_default_instance_._instance,
-          &_table_.header,
-          nullptr,  // OnDemandRegisterArenaDtor
-          nullptr,  // IsInitialized
-          &TopOfBookEvent::MergeImpl,
-          ::google::protobuf::Message::GetNewImpl<TopOfBookEvent>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-          &TopOfBookEvent::SharedDtor,
-          ::google::protobuf::Message::GetClearImpl<TopOfBookEvent>(), &TopOfBookEvent::ByteSizeLong,
-              &TopOfBookEvent::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_._cached_size_),
-          false,
-      },
-      &TopOfBookEvent::kDescriptorMethods,
-      &descriptor_table_messages_2eproto,
-      nullptr,  // tracker
-  };
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
-    ::google::protobuf::internal::ClassDataFull TopOfBookEvent_class_data_ =
-        TopOfBookEvent::InternalGenerateClassData_();
-
-PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
-TopOfBookEvent::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&TopOfBookEvent_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(TopOfBookEvent_class_data_.tc_table);
-  return TopOfBookEvent_class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<4, 11, 0, 50, 2>
-TopOfBookEvent::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_._has_bits_),
-    0, // no _extensions_
-    11, 120,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294965248,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    11,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    TopOfBookEvent_class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::toysequencer::TopOfBookEvent>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // .toysequencer.MessageType msg_type = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(TopOfBookEvent, _impl_.msg_type_), 10>(),
-     {8, 10, 0, PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.msg_type_)}},
-    // uint64 seq = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TopOfBookEvent, _impl_.seq_), 1>(),
-     {16, 1, 0, PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.seq_)}},
-    // uint64 timestamp = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TopOfBookEvent, _impl_.timestamp_), 2>(),
-     {24, 2, 0, PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.timestamp_)}},
-    // uint64 sid = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TopOfBookEvent, _impl_.sid_), 3>(),
-     {32, 3, 0, PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.sid_)}},
-    // uint64 tin = 5;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TopOfBookEvent, _impl_.tin_), 4>(),
-     {40, 4, 0, PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.tin_)}},
-    // string symbol = 6;
-    {::_pbi::TcParser::FastUS1,
-     {50, 0, 0, PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.symbol_)}},
-    // double bid_price = 7;
-    {::_pbi::TcParser::FastF64S1,
-     {57, 5, 0, PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.bid_price_)}},
-    // uint64 bid_size = 8;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TopOfBookEvent, _impl_.bid_size_), 6>(),
-     {64, 6, 0, PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.bid_size_)}},
-    // double ask_price = 9;
-    {::_pbi::TcParser::FastF64S1,
-     {73, 7, 0, PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.ask_price_)}},
-    // uint64 ask_size = 10;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TopOfBookEvent, _impl_.ask_size_), 8>(),
-     {80, 8, 0, PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.ask_size_)}},
-    // uint64 exchange_time = 11;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(TopOfBookEvent, _impl_.exchange_time_), 9>(),
-     {88, 9, 0, PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.exchange_time_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .toysequencer.MessageType msg_type = 1;
-    {PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.msg_type_), _Internal::kHasBitsOffset + 10, 0, (0 | ::_fl::kFcOptional | ::_fl::kOpenEnum)},
-    // uint64 seq = 2;
-    {PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.seq_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
-    // uint64 timestamp = 3;
-    {PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.timestamp_), _Internal::kHasBitsOffset + 2, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
-    // uint64 sid = 4;
-    {PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.sid_), _Internal::kHasBitsOffset + 3, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
-    // uint64 tin = 5;
-    {PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.tin_), _Internal::kHasBitsOffset + 4, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
-    // string symbol = 6;
-    {PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.symbol_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // double bid_price = 7;
-    {PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.bid_price_), _Internal::kHasBitsOffset + 5, 0, (0 | ::_fl::kFcOptional | ::_fl::kDouble)},
-    // uint64 bid_size = 8;
-    {PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.bid_size_), _Internal::kHasBitsOffset + 6, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
-    // double ask_price = 9;
-    {PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.ask_price_), _Internal::kHasBitsOffset + 7, 0, (0 | ::_fl::kFcOptional | ::_fl::kDouble)},
-    // uint64 ask_size = 10;
-    {PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.ask_size_), _Internal::kHasBitsOffset + 8, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
-    // uint64 exchange_time = 11;
-    {PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.exchange_time_), _Internal::kHasBitsOffset + 9, 0, (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
-  }},
-  // no aux_entries
-  {{
-    "\33\0\0\0\0\0\6\0\0\0\0\0\0\0\0\0"
-    "toysequencer.TopOfBookEvent"
-    "symbol"
-  }},
-};
-PROTOBUF_NOINLINE void TopOfBookEvent::Clear() {
+inline void TopOfBookEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.symbol_.Destroy();
+}
+
+void TopOfBookEvent::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TopOfBookEvent::Clear() {
 // @@protoc_insertion_point(message_clear_start:toysequencer.TopOfBookEvent)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000001U) != 0) {
-    _impl_.symbol_.ClearNonDefaultToEmpty();
-  }
-  if ((cached_has_bits & 0x000000feU) != 0) {
-    ::memset(&_impl_.seq_, 0, static_cast<::size_t>(
-        reinterpret_cast<char*>(&_impl_.ask_price_) -
-        reinterpret_cast<char*>(&_impl_.seq_)) + sizeof(_impl_.ask_price_));
-  }
-  if ((cached_has_bits & 0x00000700U) != 0) {
-    ::memset(&_impl_.ask_size_, 0, static_cast<::size_t>(
-        reinterpret_cast<char*>(&_impl_.msg_type_) -
-        reinterpret_cast<char*>(&_impl_.ask_size_)) + sizeof(_impl_.msg_type_));
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::uint8_t* PROTOBUF_NONNULL TopOfBookEvent::_InternalSerialize(
-    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
-  const TopOfBookEvent& this_ = static_cast<const TopOfBookEvent&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::uint8_t* PROTOBUF_NONNULL TopOfBookEvent::_InternalSerialize(
-    ::uint8_t* PROTOBUF_NONNULL target,
-    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-  const TopOfBookEvent& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  if constexpr (::_pbi::DebugHardenVerifyHasBitConsistency()) {
-    this_.VerifyHasBitConsistency();
-  }
+  _impl_.symbol_.ClearToEmpty();
+  ::memset(&_impl_.seq_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.msg_type_) -
+      reinterpret_cast<char*>(&_impl_.seq_)) + sizeof(_impl_.msg_type_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TopOfBookEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .toysequencer.MessageType msg_type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_msg_type(static_cast<::toysequencer::MessageType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 seq = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 timestamp = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sid = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.sid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 tin = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.tin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string symbol = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_symbol();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "toysequencer.TopOfBookEvent.symbol"));
+        } else
+          goto handle_unusual;
+        continue;
+      // double bid_price = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _impl_.bid_price_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 bid_size = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.bid_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double ask_price = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _impl_.ask_price_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 ask_size = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.ask_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 exchange_time = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.exchange_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 epoch = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _impl_.epoch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 cseq = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _impl_.cseq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TopOfBookEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:toysequencer.TopOfBookEvent)
-  ::uint32_t cached_has_bits = 0;
-  (void)cached_has_bits;
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
   // .toysequencer.MessageType msg_type = 1;
-  if ((this_._impl_._has_bits_[0] & 0x00000400U) != 0) {
-    if (this_._internal_msg_type() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteEnumToArray(
-          1, this_._internal_msg_type(), target);
-    }
+  if (this->_internal_msg_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_msg_type(), target);
   }
 
   // uint64 seq = 2;
-  if ((this_._impl_._has_bits_[0] & 0x00000002U) != 0) {
-    if (this_._internal_seq() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-          2, this_._internal_seq(), target);
-    }
+  if (this->_internal_seq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_seq(), target);
   }
 
   // uint64 timestamp = 3;
-  if ((this_._impl_._has_bits_[0] & 0x00000004U) != 0) {
-    if (this_._internal_timestamp() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-          3, this_._internal_timestamp(), target);
-    }
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_timestamp(), target);
   }
 
   // uint64 sid = 4;
-  if ((this_._impl_._has_bits_[0] & 0x00000008U) != 0) {
-    if (this_._internal_sid() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-          4, this_._internal_sid(), target);
-    }
+  if (this->_internal_sid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_sid(), target);
   }
 
   // uint64 tin = 5;
-  if ((this_._impl_._has_bits_[0] & 0x00000010U) != 0) {
-    if (this_._internal_tin() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-          5, this_._internal_tin(), target);
-    }
+  if (this->_internal_tin() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_tin(), target);
   }
 
   // string symbol = 6;
-  if ((this_._impl_._has_bits_[0] & 0x00000001U) != 0) {
-    if (!this_._internal_symbol().empty()) {
-      const ::std::string& _s = this_._internal_symbol();
-      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "toysequencer.TopOfBookEvent.symbol");
-      target = stream->WriteStringMaybeAliased(6, _s, target);
-    }
+  if (!this->_internal_symbol().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_symbol().data(), static_cast<int>(this->_internal_symbol().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "toysequencer.TopOfBookEvent.symbol");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_symbol(), target);
   }
 
   // double bid_price = 7;
-  if ((this_._impl_._has_bits_[0] & 0x00000020U) != 0) {
-    if (::absl::bit_cast<::uint64_t>(this_._internal_bid_price()) != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-          7, this_._internal_bid_price(), target);
-    }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_bid_price = this->_internal_bid_price();
+  uint64_t raw_bid_price;
+  memcpy(&raw_bid_price, &tmp_bid_price, sizeof(tmp_bid_price));
+  if (raw_bid_price != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_bid_price(), target);
   }
 
   // uint64 bid_size = 8;
-  if ((this_._impl_._has_bits_[0] & 0x00000040U) != 0) {
-    if (this_._internal_bid_size() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-          8, this_._internal_bid_size(), target);
-    }
+  if (this->_internal_bid_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_bid_size(), target);
   }
 
   // double ask_price = 9;
-  if ((this_._impl_._has_bits_[0] & 0x00000080U) != 0) {
-    if (::absl::bit_cast<::uint64_t>(this_._internal_ask_price()) != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteDoubleToArray(
-          9, this_._internal_ask_price(), target);
-    }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_ask_price = this->_internal_ask_price();
+  uint64_t raw_ask_price;
+  memcpy(&raw_ask_price, &tmp_ask_price, sizeof(tmp_ask_price));
+  if (raw_ask_price != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_ask_price(), target);
   }
 
   // uint64 ask_size = 10;
-  if ((this_._impl_._has_bits_[0] & 0x00000100U) != 0) {
-    if (this_._internal_ask_size() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-          10, this_._internal_ask_size(), target);
-    }
+  if (this->_internal_ask_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_ask_size(), target);
   }
 
   // uint64 exchange_time = 11;
-  if ((this_._impl_._has_bits_[0] & 0x00000200U) != 0) {
-    if (this_._internal_exchange_time() != 0) {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-          11, this_._internal_exchange_time(), target);
-    }
+  if (this->_internal_exchange_time() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(11, this->_internal_exchange_time(), target);
+  }
+
+  // uint64 epoch = 14;
+  if (this->_internal_epoch() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(14, this->_internal_epoch(), target);
   }
 
-  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-    target =
-        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  // uint64 cseq = 15;
+  if (this->_internal_cseq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(15, this->_internal_cseq(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:toysequencer.TopOfBookEvent)
   return target;
 }
 
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-::size_t TopOfBookEvent::ByteSizeLong(const MessageLite& base) {
-  const TopOfBookEvent& this_ = static_cast<const TopOfBookEvent&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-::size_t TopOfBookEvent::ByteSizeLong() const {
-  const TopOfBookEvent& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  // @@protoc_insertion_point(message_byte_size_start:toysequencer.TopOfBookEvent)
-  ::size_t total_size = 0;
+size_t TopOfBookEvent::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:toysequencer.TopOfBookEvent)
+  size_t total_size = 0;
 
-  ::uint32_t cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
-  (void)cached_has_bits;
-
-  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-  cached_has_bits = this_._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x000000ffU) != 0) {
-    // string symbol = 6;
-    if ((cached_has_bits & 0x00000001U) != 0) {
-      if (!this_._internal_symbol().empty()) {
-        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                        this_._internal_symbol());
-      }
-    }
-    // uint64 seq = 2;
-    if ((cached_has_bits & 0x00000002U) != 0) {
-      if (this_._internal_seq() != 0) {
-        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-            this_._internal_seq());
-      }
-    }
-    // uint64 timestamp = 3;
-    if ((cached_has_bits & 0x00000004U) != 0) {
-      if (this_._internal_timestamp() != 0) {
-        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-            this_._internal_timestamp());
-      }
-    }
-    // uint64 sid = 4;
-    if ((cached_has_bits & 0x00000008U) != 0) {
-      if (this_._internal_sid() != 0) {
-        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-            this_._internal_sid());
-      }
-    }
-    // uint64 tin = 5;
-    if ((cached_has_bits & 0x00000010U) != 0) {
-      if (this_._internal_tin() != 0) {
-        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-            this_._internal_tin());
-      }
-    }
-    // double bid_price = 7;
-    if ((cached_has_bits & 0x00000020U) != 0) {
-      if (::absl::bit_cast<::uint64_t>(this_._internal_bid_price()) != 0) {
-        total_size += 9;
-      }
-    }
-    // uint64 bid_size = 8;
-    if ((cached_has_bits & 0x00000040U) != 0) {
-      if (this_._internal_bid_size() != 0) {
-        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-            this_._internal_bid_size());
-      }
-    }
-    // double ask_price = 9;
-    if ((cached_has_bits & 0x00000080U) != 0) {
-      if (::absl::bit_cast<::uint64_t>(this_._internal_ask_price()) != 0) {
-        total_size += 9;
-      }
-    }
+  (void) cached_has_bits;
+
+  // string symbol = 6;
+  if (!this->_internal_symbol().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_symbol());
   }
-  if ((cached_has_bits & 0x00000700U) != 0) {
-    // uint64 ask_size = 10;
-    if ((cached_has_bits & 0x00000100U) != 0) {
-      if (this_._internal_ask_size() != 0) {
-        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-            this_._internal_ask_size());
-      }
-    }
-    // uint64 exchange_time = 11;
-    if ((cached_has_bits & 0x00000200U) != 0) {
-      if (this_._internal_exchange_time() != 0) {
-        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-            this_._internal_exchange_time());
-      }
-    }
-    // .toysequencer.MessageType msg_type = 1;
-    if ((cached_has_bits & 0x00000400U) != 0) {
-      if (this_._internal_msg_type() != 0) {
-        total_size += 1 +
-                      ::_pbi::WireFormatLite::EnumSize(this_._internal_msg_type());
-      }
-    }
+
+  // uint64 seq = 2;
+  if (this->_internal_seq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_seq());
+  }
+
+  // uint64 timestamp = 3;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp());
+  }
+
+  // uint64 sid = 4;
+  if (this->_internal_sid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sid());
+  }
+
+  // uint64 tin = 5;
+  if (this->_internal_tin() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_tin());
+  }
+
+  // double bid_price = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_bid_price = this->_internal_bid_price();
+  uint64_t raw_bid_price;
+  memcpy(&raw_bid_price, &tmp_bid_price, sizeof(tmp_bid_price));
+  if (raw_bid_price != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 bid_size = 8;
+  if (this->_internal_bid_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bid_size());
+  }
+
+  // double ask_price = 9;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_ask_price = this->_internal_ask_price();
+  uint64_t raw_ask_price;
+  memcpy(&raw_ask_price, &tmp_ask_price, sizeof(tmp_ask_price));
+  if (raw_ask_price != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 ask_size = 10;
+  if (this->_internal_ask_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_ask_size());
+  }
+
+  // uint64 exchange_time = 11;
+  if (this->_internal_exchange_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_exchange_time());
+  }
+
+  // uint64 epoch = 14;
+  if (this->_internal_epoch() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_epoch());
+  }
+
+  // uint64 cseq = 15;
+  if (this->_internal_cseq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_cseq());
+  }
+
+  // .toysequencer.MessageType msg_type = 1;
+  if (this->_internal_msg_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_msg_type());
   }
-  return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                             &this_._impl_._cached_size_);
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void TopOfBookEvent::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TopOfBookEvent::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TopOfBookEvent::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TopOfBookEvent::GetClassData() const { return &_class_data_; }
+
+
+void TopOfBookEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
   auto* const _this = static_cast<TopOfBookEvent*>(&to_msg);
   auto& from = static_cast<const TopOfBookEvent&>(from_msg);
-  if constexpr (::_pbi::DebugHardenVerifyHasBitConsistency()) {
-    from.VerifyHasBitConsistency();
-  }
   // @@protoc_insertion_point(class_specific_merge_from_start:toysequencer.TopOfBookEvent)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x000000ffU) != 0) {
-    if ((cached_has_bits & 0x00000001U) != 0) {
-      if (!from._internal_symbol().empty()) {
-        _this->_internal_set_symbol(from._internal_symbol());
-      } else {
-        if (_this->_impl_.symbol_.IsDefault()) {
-          _this->_internal_set_symbol("");
-        }
-      }
-    }
-    if ((cached_has_bits & 0x00000002U) != 0) {
-      if (from._internal_seq() != 0) {
-        _this->_impl_.seq_ = from._impl_.seq_;
-      }
-    }
-    if ((cached_has_bits & 0x00000004U) != 0) {
-      if (from._internal_timestamp() != 0) {
-        _this->_impl_.timestamp_ = from._impl_.timestamp_;
-      }
-    }
-    if ((cached_has_bits & 0x00000008U) != 0) {
-      if (from._internal_sid() != 0) {
-        _this->_impl_.sid_ = from._impl_.sid_;
-      }
-    }
-    if ((cached_has_bits & 0x00000010U) != 0) {
-      if (from._internal_tin() != 0) {
-        _this->_impl_.tin_ = from._impl_.tin_;
-      }
-    }
-    if ((cached_has_bits & 0x00000020U) != 0) {
-      if (::absl::bit_cast<::uint64_t>(from._internal_bid_price()) != 0) {
-        _this->_impl_.bid_price_ = from._impl_.bid_price_;
-      }
-    }
-    if ((cached_has_bits & 0x00000040U) != 0) {
-      if (from._internal_bid_size() != 0) {
-        _this->_impl_.bid_size_ = from._impl_.bid_size_;
-      }
-    }
-    if ((cached_has_bits & 0x00000080U) != 0) {
-      if (::absl::bit_cast<::uint64_t>(from._internal_ask_price()) != 0) {
-        _this->_impl_.ask_price_ = from._impl_.ask_price_;
-      }
-    }
+  if (!from._internal_symbol().empty()) {
+    _this->_internal_set_symbol(from._internal_symbol());
   }
-  if ((cached_has_bits & 0x00000700U) != 0) {
-    if ((cached_has_bits & 0x00000100U) != 0) {
-      if (from._internal_ask_size() != 0) {
-        _this->_impl_.ask_size_ = from._impl_.ask_size_;
-      }
-    }
-    if ((cached_has_bits & 0x00000200U) != 0) {
-      if (from._internal_exchange_time() != 0) {
-        _this->_impl_.exchange_time_ = from._impl_.exchange_time_;
-      }
-    }
-    if ((cached_has_bits & 0x00000400U) != 0) {
-      if (from._internal_msg_type() != 0) {
-        _this->_impl_.msg_type_ = from._impl_.msg_type_;
-      }
-    }
+  if (from._internal_seq() != 0) {
+    _this->_internal_set_seq(from._internal_seq());
+  }
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  if (from._internal_sid() != 0) {
+    _this->_internal_set_sid(from._internal_sid());
+  }
+  if (from._internal_tin() != 0) {
+    _this->_internal_set_tin(from._internal_tin());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_bid_price = from._internal_bid_price();
+  uint64_t raw_bid_price;
+  memcpy(&raw_bid_price, &tmp_bid_price, sizeof(tmp_bid_price));
+  if (raw_bid_price != 0) {
+    _this->_internal_set_bid_price(from._internal_bid_price());
+  }
+  if (from._internal_bid_size() != 0) {
+    _this->_internal_set_bid_size(from._internal_bid_size());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_ask_price = from._internal_ask_price();
+  uint64_t raw_ask_price;
+  memcpy(&raw_ask_price, &tmp_ask_price, sizeof(tmp_ask_price));
+  if (raw_ask_price != 0) {
+    _this->_internal_set_ask_price(from._internal_ask_price());
+  }
+  if (from._internal_ask_size() != 0) {
+    _this->_internal_set_ask_size(from._internal_ask_size());
   }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_exchange_time() != 0) {
+    _this->_internal_set_exchange_time(from._internal_exchange_time());
+  }
+  if (from._internal_epoch() != 0) {
+    _this->_internal_set_epoch(from._internal_epoch());
+  }
+  if (from._internal_cseq() != 0) {
+    _this->_internal_set_cseq(from._internal_cseq());
+  }
+  if (from._internal_msg_type() != 0) {
+    _this->_internal_set_msg_type(from._internal_msg_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void TopOfBookEvent::CopyFrom(const TopOfBookEvent& from) {
@@ -2169,15 +1959,20 @@ void TopOfBookEvent::CopyFrom(const TopOfBookEvent& from) {
   MergeFrom(from);
 }
 
+bool TopOfBookEvent::IsInitialized() const {
+  return true;
+}
 
-void TopOfBookEvent::InternalSwap(TopOfBookEvent* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
-  using ::std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
+void TopOfBookEvent::InternalSwap(TopOfBookEvent* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.symbol_, &other->_impl_.symbol_, arena);
-  ::google::protobuf::internal::memswap<
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.symbol_, lhs_arena,
+      &other->_impl_.symbol_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
       PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.msg_type_)
       + sizeof(TopOfBookEvent::_impl_.msg_type_)
       - PROTOBUF_FIELD_OFFSET(TopOfBookEvent, _impl_.seq_)>(
@@ -2185,18 +1980,32 @@ void TopOfBookEvent::InternalSwap(TopOfBookEvent* PROTOBUF_RESTRICT PROTOBUF_NON
           reinterpret_cast<char*>(&other->_impl_.seq_));
 }
 
-::google::protobuf::Metadata TopOfBookEvent::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+::PROTOBUF_NAMESPACE_ID::Metadata TopOfBookEvent::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[3]);
 }
+
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace toysequencer
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::toysequencer::TextCommand*
+Arena::CreateMaybeMessage< ::toysequencer::TextCommand >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::toysequencer::TextCommand >(arena);
+}
+template<> PROTOBUF_NOINLINE ::toysequencer::TextEvent*
+Arena::CreateMaybeMessage< ::toysequencer::TextEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::toysequencer::TextEvent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::toysequencer::TopOfBookCommand*
+Arena::CreateMaybeMessage< ::toysequencer::TopOfBookCommand >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::toysequencer::TopOfBookCommand >(arena);
+}
+template<> PROTOBUF_NOINLINE ::toysequencer::TopOfBookEvent*
+Arena::CreateMaybeMessage< ::toysequencer::TopOfBookEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::toysequencer::TopOfBookEvent >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::std::false_type
-    _static_init2_ [[maybe_unused]] =
-        (::_pbi::AddDescriptors(&descriptor_table_messages_2eproto),
-         ::std::false_type{});
-#include "google/protobuf/port_undef.inc"
+#include <google/protobuf/port_undef.inc>
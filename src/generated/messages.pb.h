@@ -1,158 +1,126 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
-// NO CHECKED-IN PROTOBUF GENCODE
 // source: messages.proto
-// Protobuf C++ Version: 6.32.1
 
-#ifndef messages_2eproto_2epb_2eh
-#define messages_2eproto_2epb_2eh
+#ifndef GOOGLE_PROTOBUF_INCLUDED_messages_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_messages_2eproto
 
 #include <limits>
 #include <string>
-#include <type_traits>
-#include <utility>
-
-#include "google/protobuf/runtime_version.h"
-#if PROTOBUF_VERSION != 6032001
-#error "Protobuf C++ gencode is built with an incompatible version of"
-#error "Protobuf C++ headers/runtime. See"
-#error "https://protobuf.dev/support/cross-version-runtime-guarantee/#cpp"
-#endif
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/arena.h"
-#include "google/protobuf/arenastring.h"
-#include "google/protobuf/generated_message_tctable_decl.h"
-#include "google/protobuf/generated_message_util.h"
-#include "google/protobuf/metadata_lite.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/message.h"
-#include "google/protobuf/message_lite.h"
-#include "google/protobuf/repeated_field.h"  // IWYU pragma: export
-#include "google/protobuf/extension_set.h"  // IWYU pragma: export
-#include "google/protobuf/generated_enum_reflection.h"
-#include "google/protobuf/unknown_field_set.h"
-// @@protoc_insertion_point(includes)
 
-// Must be included last.
-#include "google/protobuf/port_def.inc"
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 #define PROTOBUF_INTERNAL_EXPORT_messages_2eproto
-
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 namespace internal {
-template <typename T>
-::absl::string_view GetAnyMessageName();
+class AnyMetadata;
 }  // namespace internal
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_messages_2eproto {
-  static const ::uint32_t offsets[];
+  static const uint32_t offsets[];
 };
-extern "C" {
-extern const ::google::protobuf::internal::DescriptorTable descriptor_table_messages_2eproto;
-}  // extern "C"
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_messages_2eproto;
 namespace toysequencer {
-enum MessageType : int;
-extern const uint32_t MessageType_internal_data_[];
 class TextCommand;
 struct TextCommandDefaultTypeInternal;
 extern TextCommandDefaultTypeInternal _TextCommand_default_instance_;
-extern const ::google::protobuf::internal::ClassDataFull TextCommand_class_data_;
 class TextEvent;
 struct TextEventDefaultTypeInternal;
 extern TextEventDefaultTypeInternal _TextEvent_default_instance_;
-extern const ::google::protobuf::internal::ClassDataFull TextEvent_class_data_;
 class TopOfBookCommand;
 struct TopOfBookCommandDefaultTypeInternal;
 extern TopOfBookCommandDefaultTypeInternal _TopOfBookCommand_default_instance_;
-extern const ::google::protobuf::internal::ClassDataFull TopOfBookCommand_class_data_;
 class TopOfBookEvent;
 struct TopOfBookEventDefaultTypeInternal;
 extern TopOfBookEventDefaultTypeInternal _TopOfBookEvent_default_instance_;
-extern const ::google::protobuf::internal::ClassDataFull TopOfBookEvent_class_data_;
 }  // namespace toysequencer
-namespace google {
-namespace protobuf {
-template <>
-internal::EnumTraitsT<::toysequencer::MessageType_internal_data_>
-    internal::EnumTraitsImpl::value<::toysequencer::MessageType>;
-}  // namespace protobuf
-}  // namespace google
-
+PROTOBUF_NAMESPACE_OPEN
+template<> ::toysequencer::TextCommand* Arena::CreateMaybeMessage<::toysequencer::TextCommand>(Arena*);
+template<> ::toysequencer::TextEvent* Arena::CreateMaybeMessage<::toysequencer::TextEvent>(Arena*);
+template<> ::toysequencer::TopOfBookCommand* Arena::CreateMaybeMessage<::toysequencer::TopOfBookCommand>(Arena*);
+template<> ::toysequencer::TopOfBookEvent* Arena::CreateMaybeMessage<::toysequencer::TopOfBookEvent>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 namespace toysequencer {
+
 enum MessageType : int {
   MESSAGE_TYPE_UNSPECIFIED = 0,
   TEXT_COMMAND = 1,
   TEXT_EVENT = 2,
   TOB_COMMAND = 3,
   TOB_EVENT = 4,
-  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ =
-      ::std::numeric_limits<::int32_t>::min(),
-  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ =
-      ::std::numeric_limits<::int32_t>::max(),
+  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
-
-extern const uint32_t MessageType_internal_data_[];
-inline constexpr MessageType MessageType_MIN =
-    static_cast<MessageType>(0);
-inline constexpr MessageType MessageType_MAX =
-    static_cast<MessageType>(4);
-inline bool MessageType_IsValid(int value) {
-  return 0 <= value && value <= 4;
-}
-inline constexpr int MessageType_ARRAYSIZE = 4 + 1;
-const ::google::protobuf::EnumDescriptor* PROTOBUF_NONNULL MessageType_descriptor();
-template <typename T>
-const ::std::string& MessageType_Name(T value) {
+bool MessageType_IsValid(int value);
+constexpr MessageType MessageType_MIN = MESSAGE_TYPE_UNSPECIFIED;
+constexpr MessageType MessageType_MAX = TOB_EVENT;
+constexpr int MessageType_ARRAYSIZE = MessageType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor();
+template<typename T>
+inline const std::string& MessageType_Name(T enum_t_value) {
   static_assert(::std::is_same<T, MessageType>::value ||
-                    ::std::is_integral<T>::value,
-                "Incorrect type passed to MessageType_Name().");
-  return MessageType_Name(static_cast<MessageType>(value));
-}
-template <>
-inline const ::std::string& MessageType_Name(MessageType value) {
-  return ::google::protobuf::internal::NameOfDenseEnum<MessageType_descriptor, 0, 4>(
-      static_cast<int>(value));
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MessageType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MessageType_descriptor(), enum_t_value);
 }
 inline bool MessageType_Parse(
-    ::absl::string_view name, MessageType* PROTOBUF_NONNULL value) {
-  return ::google::protobuf::internal::ParseNamedEnum<MessageType>(MessageType_descriptor(), name,
-                                           value);
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MessageType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MessageType>(
+    MessageType_descriptor(), name, value);
 }
-
 // ===================================================================
 
-
-// -------------------------------------------------------------------
-
-class TopOfBookEvent final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:toysequencer.TopOfBookEvent) */ {
+class TextCommand final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:toysequencer.TextCommand) */ {
  public:
-  inline TopOfBookEvent() : TopOfBookEvent(nullptr) {}
-  ~TopOfBookEvent() PROTOBUF_FINAL;
+  inline TextCommand() : TextCommand(nullptr) {}
+  ~TextCommand() override;
+  explicit PROTOBUF_CONSTEXPR TextCommand(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(TopOfBookEvent* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(TopOfBookEvent));
+  TextCommand(const TextCommand& from);
+  TextCommand(TextCommand&& from) noexcept
+    : TextCommand() {
+    *this = ::std::move(from);
   }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR TopOfBookEvent(::google::protobuf::internal::ConstantInitialized);
 
-  inline TopOfBookEvent(const TopOfBookEvent& from) : TopOfBookEvent(nullptr, from) {}
-  inline TopOfBookEvent(TopOfBookEvent&& from) noexcept
-      : TopOfBookEvent(nullptr, ::std::move(from)) {}
-  inline TopOfBookEvent& operator=(const TopOfBookEvent& from) {
+  inline TextCommand& operator=(const TextCommand& from) {
     CopyFrom(from);
     return *this;
   }
-  inline TopOfBookEvent& operator=(TopOfBookEvent&& from) noexcept {
+  inline TextCommand& operator=(TextCommand&& from) noexcept {
     if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
       InternalSwap(&from);
     } else {
       CopyFrom(from);
@@ -160,315 +128,207 @@ class TopOfBookEvent final : public ::google::protobuf::Message
     return *this;
   }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
     return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const TopOfBookEvent& default_instance() {
-    return *reinterpret_cast<const TopOfBookEvent*>(
-        &_TopOfBookEvent_default_instance_);
+  static const TextCommand& default_instance() {
+    return *internal_default_instance();
   }
-  static constexpr int kIndexInFileMessages = 3;
-  friend void swap(TopOfBookEvent& a, TopOfBookEvent& b) { a.Swap(&b); }
-  inline void Swap(TopOfBookEvent* PROTOBUF_NONNULL other) {
+  static inline const TextCommand* internal_default_instance() {
+    return reinterpret_cast<const TextCommand*>(
+               &_TextCommand_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TextCommand& a, TextCommand& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TextCommand* other) {
     if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(TopOfBookEvent* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(TextCommand* other) {
     if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  TopOfBookEvent* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<TopOfBookEvent>(arena);
+  TextCommand* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TextCommand>(arena);
   }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const TopOfBookEvent& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const TopOfBookEvent& from) { TopOfBookEvent::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
-                        const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TextCommand& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TextCommand& from) {
+    TextCommand::MergeImpl(*this, from);
   }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
   private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
-
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  private:
-  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(TopOfBookEvent* PROTOBUF_NONNULL other);
- private:
-  template <typename T>
-  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "toysequencer.TopOfBookEvent"; }
-
- protected:
-  explicit TopOfBookEvent(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  TopOfBookEvent(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const TopOfBookEvent& from);
-  TopOfBookEvent(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, TopOfBookEvent&& from) noexcept
-      : TopOfBookEvent(arena) {
-    *this = ::std::move(from);
-  }
-  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
-  static void* PROTOBUF_NONNULL PlacementNew_(
-      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static constexpr auto InternalNewImpl_();
-
- public:
-  static constexpr auto InternalGenerateClassData_();
-
-  ::google::protobuf::Metadata GetMetadata() const;
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-  enum : int {
-    kSymbolFieldNumber = 6,
-    kSeqFieldNumber = 2,
-    kTimestampFieldNumber = 3,
-    kSidFieldNumber = 4,
-    kTinFieldNumber = 5,
-    kBidPriceFieldNumber = 7,
-    kBidSizeFieldNumber = 8,
-    kAskPriceFieldNumber = 9,
-    kAskSizeFieldNumber = 10,
-    kExchangeTimeFieldNumber = 11,
-    kMsgTypeFieldNumber = 1,
-  };
-  // string symbol = 6;
-  void clear_symbol() ;
-  const ::std::string& symbol() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_symbol(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_symbol();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_symbol();
-  void set_allocated_symbol(::std::string* PROTOBUF_NULLABLE value);
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  const ::std::string& _internal_symbol() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_symbol(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_symbol();
-
-  public:
-  // uint64 seq = 2;
-  void clear_seq() ;
-  ::uint64_t seq() const;
-  void set_seq(::uint64_t value);
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TextCommand* other);
 
   private:
-  ::uint64_t _internal_seq() const;
-  void _internal_set_seq(::uint64_t value);
-
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "toysequencer.TextCommand";
+  }
+  protected:
+  explicit TextCommand(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  // uint64 timestamp = 3;
-  void clear_timestamp() ;
-  ::uint64_t timestamp() const;
-  void set_timestamp(::uint64_t value);
 
-  private:
-  ::uint64_t _internal_timestamp() const;
-  void _internal_set_timestamp(::uint64_t value);
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
-  // uint64 sid = 4;
-  void clear_sid() ;
-  ::uint64_t sid() const;
-  void set_sid(::uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  private:
-  ::uint64_t _internal_sid() const;
-  void _internal_set_sid(::uint64_t value);
+  // nested types ----------------------------------------------------
 
-  public:
-  // uint64 tin = 5;
-  void clear_tin() ;
-  ::uint64_t tin() const;
-  void set_tin(::uint64_t value);
+  // accessors -------------------------------------------------------
 
+  enum : int {
+    kTextFieldNumber = 4,
+    kSidFieldNumber = 2,
+    kTinFieldNumber = 3,
+    kSenderEpochFieldNumber = 14,
+    kCseqFieldNumber = 15,
+    kMsgTypeFieldNumber = 1,
+  };
+  // string text = 4;
+  void clear_text();
+  const std::string& text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* text);
   private:
-  ::uint64_t _internal_tin() const;
-  void _internal_set_tin(::uint64_t value);
-
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(const std::string& value);
+  std::string* _internal_mutable_text();
   public:
-  // double bid_price = 7;
-  void clear_bid_price() ;
-  double bid_price() const;
-  void set_bid_price(double value);
 
+  // uint64 sid = 2;
+  void clear_sid();
+  uint64_t sid() const;
+  void set_sid(uint64_t value);
   private:
-  double _internal_bid_price() const;
-  void _internal_set_bid_price(double value);
-
+  uint64_t _internal_sid() const;
+  void _internal_set_sid(uint64_t value);
   public:
-  // uint64 bid_size = 8;
-  void clear_bid_size() ;
-  ::uint64_t bid_size() const;
-  void set_bid_size(::uint64_t value);
 
+  // uint64 tin = 3;
+  void clear_tin();
+  uint64_t tin() const;
+  void set_tin(uint64_t value);
   private:
-  ::uint64_t _internal_bid_size() const;
-  void _internal_set_bid_size(::uint64_t value);
-
+  uint64_t _internal_tin() const;
+  void _internal_set_tin(uint64_t value);
   public:
-  // double ask_price = 9;
-  void clear_ask_price() ;
-  double ask_price() const;
-  void set_ask_price(double value);
 
+  // uint64 sender_epoch = 14;
+  void clear_sender_epoch();
+  uint64_t sender_epoch() const;
+  void set_sender_epoch(uint64_t value);
   private:
-  double _internal_ask_price() const;
-  void _internal_set_ask_price(double value);
-
+  uint64_t _internal_sender_epoch() const;
+  void _internal_set_sender_epoch(uint64_t value);
   public:
-  // uint64 ask_size = 10;
-  void clear_ask_size() ;
-  ::uint64_t ask_size() const;
-  void set_ask_size(::uint64_t value);
 
+  // uint64 cseq = 15;
+  void clear_cseq();
+  uint64_t cseq() const;
+  void set_cseq(uint64_t value);
   private:
-  ::uint64_t _internal_ask_size() const;
-  void _internal_set_ask_size(::uint64_t value);
-
+  uint64_t _internal_cseq() const;
+  void _internal_set_cseq(uint64_t value);
   public:
-  // uint64 exchange_time = 11;
-  void clear_exchange_time() ;
-  ::uint64_t exchange_time() const;
-  void set_exchange_time(::uint64_t value);
-
-  private:
-  ::uint64_t _internal_exchange_time() const;
-  void _internal_set_exchange_time(::uint64_t value);
 
-  public:
   // .toysequencer.MessageType msg_type = 1;
-  void clear_msg_type() ;
+  void clear_msg_type();
   ::toysequencer::MessageType msg_type() const;
   void set_msg_type(::toysequencer::MessageType value);
-
   private:
   ::toysequencer::MessageType _internal_msg_type() const;
   void _internal_set_msg_type(::toysequencer::MessageType value);
-
   public:
-  // @@protoc_insertion_point(class_scope:toysequencer.TopOfBookEvent)
+
+  // @@protoc_insertion_point(class_scope:toysequencer.TextCommand)
  private:
   class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<4, 11,
-                                   0, 50,
-                                   2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   struct Impl_ {
-    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const TopOfBookEvent& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr symbol_;
-    ::uint64_t seq_;
-    ::uint64_t timestamp_;
-    ::uint64_t sid_;
-    ::uint64_t tin_;
-    double bid_price_;
-    ::uint64_t bid_size_;
-    double ask_price_;
-    ::uint64_t ask_size_;
-    ::uint64_t exchange_time_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+    uint64_t sid_;
+    uint64_t tin_;
+    uint64_t sender_epoch_;
+    uint64_t cseq_;
     int msg_type_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
-
-extern const ::google::protobuf::internal::ClassDataFull TopOfBookEvent_class_data_;
 // -------------------------------------------------------------------
 
-class TopOfBookCommand final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:toysequencer.TopOfBookCommand) */ {
+class TextEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:toysequencer.TextEvent) */ {
  public:
-  inline TopOfBookCommand() : TopOfBookCommand(nullptr) {}
-  ~TopOfBookCommand() PROTOBUF_FINAL;
+  inline TextEvent() : TextEvent(nullptr) {}
+  ~TextEvent() override;
+  explicit PROTOBUF_CONSTEXPR TextEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(TopOfBookCommand* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(TopOfBookCommand));
+  TextEvent(const TextEvent& from);
+  TextEvent(TextEvent&& from) noexcept
+    : TextEvent() {
+    *this = ::std::move(from);
   }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR TopOfBookCommand(::google::protobuf::internal::ConstantInitialized);
 
-  inline TopOfBookCommand(const TopOfBookCommand& from) : TopOfBookCommand(nullptr, from) {}
-  inline TopOfBookCommand(TopOfBookCommand&& from) noexcept
-      : TopOfBookCommand(nullptr, ::std::move(from)) {}
-  inline TopOfBookCommand& operator=(const TopOfBookCommand& from) {
+  inline TextEvent& operator=(const TextEvent& from) {
     CopyFrom(from);
     return *this;
   }
-  inline TopOfBookCommand& operator=(TopOfBookCommand&& from) noexcept {
+  inline TextEvent& operator=(TextEvent&& from) noexcept {
     if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
       InternalSwap(&from);
     } else {
       CopyFrom(from);
@@ -476,291 +336,229 @@ class TopOfBookCommand final : public ::google::protobuf::Message
     return *this;
   }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
     return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const TopOfBookCommand& default_instance() {
-    return *reinterpret_cast<const TopOfBookCommand*>(
-        &_TopOfBookCommand_default_instance_);
+  static const TextEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TextEvent* internal_default_instance() {
+    return reinterpret_cast<const TextEvent*>(
+               &_TextEvent_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(TextEvent& a, TextEvent& b) {
+    a.Swap(&b);
   }
-  static constexpr int kIndexInFileMessages = 2;
-  friend void swap(TopOfBookCommand& a, TopOfBookCommand& b) { a.Swap(&b); }
-  inline void Swap(TopOfBookCommand* PROTOBUF_NONNULL other) {
+  inline void Swap(TextEvent* other) {
     if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(TopOfBookCommand* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(TextEvent* other) {
     if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  TopOfBookCommand* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<TopOfBookCommand>(arena);
+  TextEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TextEvent>(arena);
   }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const TopOfBookCommand& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const TopOfBookCommand& from) { TopOfBookCommand::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
-                        const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TextEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TextEvent& from) {
+    TextEvent::MergeImpl(*this, from);
   }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
   private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
-
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(TopOfBookCommand* PROTOBUF_NONNULL other);
- private:
-  template <typename T>
-  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "toysequencer.TopOfBookCommand"; }
-
- protected:
-  explicit TopOfBookCommand(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  TopOfBookCommand(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const TopOfBookCommand& from);
-  TopOfBookCommand(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, TopOfBookCommand&& from) noexcept
-      : TopOfBookCommand(arena) {
-    *this = ::std::move(from);
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TextEvent* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "toysequencer.TextEvent";
   }
-  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
-  static void* PROTOBUF_NONNULL PlacementNew_(
-      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static constexpr auto InternalNewImpl_();
+  protected:
+  explicit TextEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
- public:
-  static constexpr auto InternalGenerateClassData_();
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
+
   enum : int {
-    kSymbolFieldNumber = 4,
-    kSidFieldNumber = 2,
-    kTinFieldNumber = 3,
-    kBidPriceFieldNumber = 5,
-    kBidSizeFieldNumber = 6,
-    kAskPriceFieldNumber = 7,
-    kAskSizeFieldNumber = 8,
-    kExchangeTimeFieldNumber = 9,
+    kTextFieldNumber = 6,
+    kSeqFieldNumber = 2,
+    kTimestampFieldNumber = 3,
+    kSidFieldNumber = 4,
+    kTinFieldNumber = 5,
+    kEpochFieldNumber = 14,
+    kCseqFieldNumber = 15,
     kMsgTypeFieldNumber = 1,
   };
-  // string symbol = 4;
-  void clear_symbol() ;
-  const ::std::string& symbol() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_symbol(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_symbol();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_symbol();
-  void set_allocated_symbol(::std::string* PROTOBUF_NULLABLE value);
-
+  // string text = 6;
+  void clear_text();
+  const std::string& text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* text);
   private:
-  const ::std::string& _internal_symbol() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_symbol(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_symbol();
-
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(const std::string& value);
+  std::string* _internal_mutable_text();
   public:
-  // uint64 sid = 2;
-  void clear_sid() ;
-  ::uint64_t sid() const;
-  void set_sid(::uint64_t value);
 
+  // uint64 seq = 2;
+  void clear_seq();
+  uint64_t seq() const;
+  void set_seq(uint64_t value);
   private:
-  ::uint64_t _internal_sid() const;
-  void _internal_set_sid(::uint64_t value);
-
+  uint64_t _internal_seq() const;
+  void _internal_set_seq(uint64_t value);
   public:
-  // uint64 tin = 3;
-  void clear_tin() ;
-  ::uint64_t tin() const;
-  void set_tin(::uint64_t value);
 
+  // uint64 timestamp = 3;
+  void clear_timestamp();
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
   private:
-  ::uint64_t _internal_tin() const;
-  void _internal_set_tin(::uint64_t value);
-
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
   public:
-  // double bid_price = 5;
-  void clear_bid_price() ;
-  double bid_price() const;
-  void set_bid_price(double value);
 
+  // uint64 sid = 4;
+  void clear_sid();
+  uint64_t sid() const;
+  void set_sid(uint64_t value);
   private:
-  double _internal_bid_price() const;
-  void _internal_set_bid_price(double value);
-
+  uint64_t _internal_sid() const;
+  void _internal_set_sid(uint64_t value);
   public:
-  // uint64 bid_size = 6;
-  void clear_bid_size() ;
-  ::uint64_t bid_size() const;
-  void set_bid_size(::uint64_t value);
 
+  // uint64 tin = 5;
+  void clear_tin();
+  uint64_t tin() const;
+  void set_tin(uint64_t value);
   private:
-  ::uint64_t _internal_bid_size() const;
-  void _internal_set_bid_size(::uint64_t value);
-
+  uint64_t _internal_tin() const;
+  void _internal_set_tin(uint64_t value);
   public:
-  // double ask_price = 7;
-  void clear_ask_price() ;
-  double ask_price() const;
-  void set_ask_price(double value);
 
+  // uint64 epoch = 14;
+  void clear_epoch();
+  uint64_t epoch() const;
+  void set_epoch(uint64_t value);
   private:
-  double _internal_ask_price() const;
-  void _internal_set_ask_price(double value);
-
+  uint64_t _internal_epoch() const;
+  void _internal_set_epoch(uint64_t value);
   public:
-  // uint64 ask_size = 8;
-  void clear_ask_size() ;
-  ::uint64_t ask_size() const;
-  void set_ask_size(::uint64_t value);
 
+  // uint64 cseq = 15;
+  void clear_cseq();
+  uint64_t cseq() const;
+  void set_cseq(uint64_t value);
   private:
-  ::uint64_t _internal_ask_size() const;
-  void _internal_set_ask_size(::uint64_t value);
-
+  uint64_t _internal_cseq() const;
+  void _internal_set_cseq(uint64_t value);
   public:
-  // uint64 exchange_time = 9;
-  void clear_exchange_time() ;
-  ::uint64_t exchange_time() const;
-  void set_exchange_time(::uint64_t value);
-
-  private:
-  ::uint64_t _internal_exchange_time() const;
-  void _internal_set_exchange_time(::uint64_t value);
 
-  public:
   // .toysequencer.MessageType msg_type = 1;
-  void clear_msg_type() ;
+  void clear_msg_type();
   ::toysequencer::MessageType msg_type() const;
   void set_msg_type(::toysequencer::MessageType value);
-
   private:
   ::toysequencer::MessageType _internal_msg_type() const;
   void _internal_set_msg_type(::toysequencer::MessageType value);
-
   public:
-  // @@protoc_insertion_point(class_scope:toysequencer.TopOfBookCommand)
+
+  // @@protoc_insertion_point(class_scope:toysequencer.TextEvent)
  private:
   class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<4, 9,
-                                   0, 52,
-                                   2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   struct Impl_ {
-    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const TopOfBookCommand& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr symbol_;
-    ::uint64_t sid_;
-    ::uint64_t tin_;
-    double bid_price_;
-    ::uint64_t bid_size_;
-    double ask_price_;
-    ::uint64_t ask_size_;
-    ::uint64_t exchange_time_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+    uint64_t seq_;
+    uint64_t timestamp_;
+    uint64_t sid_;
+    uint64_t tin_;
+    uint64_t epoch_;
+    uint64_t cseq_;
     int msg_type_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
-
-extern const ::google::protobuf::internal::ClassDataFull TopOfBookCommand_class_data_;
 // -------------------------------------------------------------------
 
-class TextEvent final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:toysequencer.TextEvent) */ {
+class TopOfBookCommand final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:toysequencer.TopOfBookCommand) */ {
  public:
-  inline TextEvent() : TextEvent(nullptr) {}
-  ~TextEvent() PROTOBUF_FINAL;
+  inline TopOfBookCommand() : TopOfBookCommand(nullptr) {}
+  ~TopOfBookCommand() override;
+  explicit PROTOBUF_CONSTEXPR TopOfBookCommand(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(TextEvent* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(TextEvent));
+  TopOfBookCommand(const TopOfBookCommand& from);
+  TopOfBookCommand(TopOfBookCommand&& from) noexcept
+    : TopOfBookCommand() {
+    *this = ::std::move(from);
   }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR TextEvent(::google::protobuf::internal::ConstantInitialized);
 
-  inline TextEvent(const TextEvent& from) : TextEvent(nullptr, from) {}
-  inline TextEvent(TextEvent&& from) noexcept
-      : TextEvent(nullptr, ::std::move(from)) {}
-  inline TextEvent& operator=(const TextEvent& from) {
+  inline TopOfBookCommand& operator=(const TopOfBookCommand& from) {
     CopyFrom(from);
     return *this;
   }
-  inline TextEvent& operator=(TextEvent&& from) noexcept {
+  inline TopOfBookCommand& operator=(TopOfBookCommand&& from) noexcept {
     if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
       InternalSwap(&from);
     } else {
       CopyFrom(from);
@@ -768,255 +566,262 @@ class TextEvent final : public ::google::protobuf::Message
     return *this;
   }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
     return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const TextEvent& default_instance() {
-    return *reinterpret_cast<const TextEvent*>(
-        &_TextEvent_default_instance_);
+  static const TopOfBookCommand& default_instance() {
+    return *internal_default_instance();
   }
-  static constexpr int kIndexInFileMessages = 1;
-  friend void swap(TextEvent& a, TextEvent& b) { a.Swap(&b); }
-  inline void Swap(TextEvent* PROTOBUF_NONNULL other) {
+  static inline const TopOfBookCommand* internal_default_instance() {
+    return reinterpret_cast<const TopOfBookCommand*>(
+               &_TopOfBookCommand_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(TopOfBookCommand& a, TopOfBookCommand& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TopOfBookCommand* other) {
     if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(TextEvent* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(TopOfBookCommand* other) {
     if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  TextEvent* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<TextEvent>(arena);
+  TopOfBookCommand* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TopOfBookCommand>(arena);
   }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const TextEvent& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const TextEvent& from) { TextEvent::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
-                        const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TopOfBookCommand& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TopOfBookCommand& from) {
+    TopOfBookCommand::MergeImpl(*this, from);
   }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
   private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
-
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(TextEvent* PROTOBUF_NONNULL other);
- private:
-  template <typename T>
-  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "toysequencer.TextEvent"; }
-
- protected:
-  explicit TextEvent(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  TextEvent(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const TextEvent& from);
-  TextEvent(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, TextEvent&& from) noexcept
-      : TextEvent(arena) {
-    *this = ::std::move(from);
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TopOfBookCommand* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "toysequencer.TopOfBookCommand";
   }
-  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
-  static void* PROTOBUF_NONNULL PlacementNew_(
-      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static constexpr auto InternalNewImpl_();
+  protected:
+  explicit TopOfBookCommand(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
- public:
-  static constexpr auto InternalGenerateClassData_();
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
+
   enum : int {
-    kTextFieldNumber = 6,
-    kSeqFieldNumber = 2,
-    kTimestampFieldNumber = 3,
-    kSidFieldNumber = 4,
-    kTinFieldNumber = 5,
+    kSymbolFieldNumber = 4,
+    kSidFieldNumber = 2,
+    kTinFieldNumber = 3,
+    kBidPriceFieldNumber = 5,
+    kBidSizeFieldNumber = 6,
+    kAskPriceFieldNumber = 7,
+    kAskSizeFieldNumber = 8,
+    kExchangeTimeFieldNumber = 9,
+    kSenderEpochFieldNumber = 14,
+    kCseqFieldNumber = 15,
     kMsgTypeFieldNumber = 1,
   };
-  // string text = 6;
-  void clear_text() ;
-  const ::std::string& text() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_text(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_text();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_text();
-  void set_allocated_text(::std::string* PROTOBUF_NULLABLE value);
-
+  // string symbol = 4;
+  void clear_symbol();
+  const std::string& symbol() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_symbol(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_symbol();
+  PROTOBUF_NODISCARD std::string* release_symbol();
+  void set_allocated_symbol(std::string* symbol);
   private:
-  const ::std::string& _internal_text() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_text(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_text();
+  const std::string& _internal_symbol() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_symbol(const std::string& value);
+  std::string* _internal_mutable_symbol();
+  public:
 
+  // uint64 sid = 2;
+  void clear_sid();
+  uint64_t sid() const;
+  void set_sid(uint64_t value);
+  private:
+  uint64_t _internal_sid() const;
+  void _internal_set_sid(uint64_t value);
   public:
-  // uint64 seq = 2;
-  void clear_seq() ;
-  ::uint64_t seq() const;
-  void set_seq(::uint64_t value);
 
+  // uint64 tin = 3;
+  void clear_tin();
+  uint64_t tin() const;
+  void set_tin(uint64_t value);
   private:
-  ::uint64_t _internal_seq() const;
-  void _internal_set_seq(::uint64_t value);
+  uint64_t _internal_tin() const;
+  void _internal_set_tin(uint64_t value);
+  public:
 
+  // double bid_price = 5;
+  void clear_bid_price();
+  double bid_price() const;
+  void set_bid_price(double value);
+  private:
+  double _internal_bid_price() const;
+  void _internal_set_bid_price(double value);
   public:
-  // uint64 timestamp = 3;
-  void clear_timestamp() ;
-  ::uint64_t timestamp() const;
-  void set_timestamp(::uint64_t value);
 
+  // uint64 bid_size = 6;
+  void clear_bid_size();
+  uint64_t bid_size() const;
+  void set_bid_size(uint64_t value);
   private:
-  ::uint64_t _internal_timestamp() const;
-  void _internal_set_timestamp(::uint64_t value);
+  uint64_t _internal_bid_size() const;
+  void _internal_set_bid_size(uint64_t value);
+  public:
 
+  // double ask_price = 7;
+  void clear_ask_price();
+  double ask_price() const;
+  void set_ask_price(double value);
+  private:
+  double _internal_ask_price() const;
+  void _internal_set_ask_price(double value);
   public:
-  // uint64 sid = 4;
-  void clear_sid() ;
-  ::uint64_t sid() const;
-  void set_sid(::uint64_t value);
 
+  // uint64 ask_size = 8;
+  void clear_ask_size();
+  uint64_t ask_size() const;
+  void set_ask_size(uint64_t value);
   private:
-  ::uint64_t _internal_sid() const;
-  void _internal_set_sid(::uint64_t value);
+  uint64_t _internal_ask_size() const;
+  void _internal_set_ask_size(uint64_t value);
+  public:
 
+  // uint64 exchange_time = 9;
+  void clear_exchange_time();
+  uint64_t exchange_time() const;
+  void set_exchange_time(uint64_t value);
+  private:
+  uint64_t _internal_exchange_time() const;
+  void _internal_set_exchange_time(uint64_t value);
   public:
-  // uint64 tin = 5;
-  void clear_tin() ;
-  ::uint64_t tin() const;
-  void set_tin(::uint64_t value);
 
+  // uint64 sender_epoch = 14;
+  void clear_sender_epoch();
+  uint64_t sender_epoch() const;
+  void set_sender_epoch(uint64_t value);
   private:
-  ::uint64_t _internal_tin() const;
-  void _internal_set_tin(::uint64_t value);
+  uint64_t _internal_sender_epoch() const;
+  void _internal_set_sender_epoch(uint64_t value);
+  public:
 
+  // uint64 cseq = 15;
+  void clear_cseq();
+  uint64_t cseq() const;
+  void set_cseq(uint64_t value);
+  private:
+  uint64_t _internal_cseq() const;
+  void _internal_set_cseq(uint64_t value);
   public:
+
   // .toysequencer.MessageType msg_type = 1;
-  void clear_msg_type() ;
+  void clear_msg_type();
   ::toysequencer::MessageType msg_type() const;
   void set_msg_type(::toysequencer::MessageType value);
-
   private:
   ::toysequencer::MessageType _internal_msg_type() const;
   void _internal_set_msg_type(::toysequencer::MessageType value);
-
   public:
-  // @@protoc_insertion_point(class_scope:toysequencer.TextEvent)
+
+  // @@protoc_insertion_point(class_scope:toysequencer.TopOfBookCommand)
  private:
   class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<3, 6,
-                                   0, 35,
-                                   2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   struct Impl_ {
-    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const TextEvent& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr text_;
-    ::uint64_t seq_;
-    ::uint64_t timestamp_;
-    ::uint64_t sid_;
-    ::uint64_t tin_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr symbol_;
+    uint64_t sid_;
+    uint64_t tin_;
+    double bid_price_;
+    uint64_t bid_size_;
+    double ask_price_;
+    uint64_t ask_size_;
+    uint64_t exchange_time_;
+    uint64_t sender_epoch_;
+    uint64_t cseq_;
     int msg_type_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
-
-extern const ::google::protobuf::internal::ClassDataFull TextEvent_class_data_;
 // -------------------------------------------------------------------
 
-class TextCommand final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:toysequencer.TextCommand) */ {
+class TopOfBookEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:toysequencer.TopOfBookEvent) */ {
  public:
-  inline TextCommand() : TextCommand(nullptr) {}
-  ~TextCommand() PROTOBUF_FINAL;
+  inline TopOfBookEvent() : TopOfBookEvent(nullptr) {}
+  ~TopOfBookEvent() override;
+  explicit PROTOBUF_CONSTEXPR TopOfBookEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(TextCommand* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
-    SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(TextCommand));
+  TopOfBookEvent(const TopOfBookEvent& from);
+  TopOfBookEvent(TopOfBookEvent&& from) noexcept
+    : TopOfBookEvent() {
+    *this = ::std::move(from);
   }
-#endif
-
-  template <typename = void>
-  explicit PROTOBUF_CONSTEXPR TextCommand(::google::protobuf::internal::ConstantInitialized);
 
-  inline TextCommand(const TextCommand& from) : TextCommand(nullptr, from) {}
-  inline TextCommand(TextCommand&& from) noexcept
-      : TextCommand(nullptr, ::std::move(from)) {}
-  inline TextCommand& operator=(const TextCommand& from) {
+  inline TopOfBookEvent& operator=(const TopOfBookEvent& from) {
     CopyFrom(from);
     return *this;
   }
-  inline TextCommand& operator=(TextCommand&& from) noexcept {
+  inline TopOfBookEvent& operator=(TopOfBookEvent&& from) noexcept {
     if (this == &from) return *this;
-    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
       InternalSwap(&from);
     } else {
       CopyFrom(from);
@@ -1024,355 +829,417 @@ class TextCommand final : public ::google::protobuf::Message
     return *this;
   }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
-  }
-  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
-      ABSL_ATTRIBUTE_LIFETIME_BOUND {
-    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
-  }
-
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
-  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
     return default_instance().GetMetadata().descriptor;
   }
-  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const TextCommand& default_instance() {
-    return *reinterpret_cast<const TextCommand*>(
-        &_TextCommand_default_instance_);
+  static const TopOfBookEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TopOfBookEvent* internal_default_instance() {
+    return reinterpret_cast<const TopOfBookEvent*>(
+               &_TopOfBookEvent_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 0;
-  friend void swap(TextCommand& a, TextCommand& b) { a.Swap(&b); }
-  inline void Swap(TextCommand* PROTOBUF_NONNULL other) {
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(TopOfBookEvent& a, TopOfBookEvent& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TopOfBookEvent* other) {
     if (other == this) return;
-    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
-      ::google::protobuf::internal::GenericSwap(this, other);
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(TextCommand* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(TopOfBookEvent* other) {
     if (other == this) return;
-    ABSL_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  TextCommand* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<TextCommand>(arena);
+  TopOfBookEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TopOfBookEvent>(arena);
   }
-  using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const TextCommand& from);
-  using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const TextCommand& from) { TextCommand::MergeImpl(*this, from); }
-
-  private:
-  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
-                        const ::google::protobuf::MessageLite& from_msg);
-
-  public:
-  bool IsInitialized() const {
-    return true;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TopOfBookEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TopOfBookEvent& from) {
+    TopOfBookEvent::MergeImpl(*this, from);
   }
-  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
-  #if defined(PROTOBUF_CUSTOM_VTABLE)
   private:
-  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
-  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
-
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
-    return _InternalSerialize(*this, target, stream);
-  }
-  #else   // PROTOBUF_CUSTOM_VTABLE
-  ::size_t ByteSizeLong() const final;
-  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
-      ::uint8_t* PROTOBUF_NONNULL target,
-      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
-  #endif  // PROTOBUF_CUSTOM_VTABLE
-  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static void SharedDtor(MessageLite& self);
-  void InternalSwap(TextCommand* PROTOBUF_NONNULL other);
- private:
-  template <typename T>
-  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "toysequencer.TextCommand"; }
-
- protected:
-  explicit TextCommand(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  TextCommand(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const TextCommand& from);
-  TextCommand(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, TextCommand&& from) noexcept
-      : TextCommand(arena) {
-    *this = ::std::move(from);
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TopOfBookEvent* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "toysequencer.TopOfBookEvent";
   }
-  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
-  static void* PROTOBUF_NONNULL PlacementNew_(
-      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  static constexpr auto InternalNewImpl_();
+  protected:
+  explicit TopOfBookEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
- public:
-  static constexpr auto InternalGenerateClassData_();
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  ::google::protobuf::Metadata GetMetadata() const;
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
+
   enum : int {
-    kTextFieldNumber = 4,
-    kSidFieldNumber = 2,
-    kTinFieldNumber = 3,
+    kSymbolFieldNumber = 6,
+    kSeqFieldNumber = 2,
+    kTimestampFieldNumber = 3,
+    kSidFieldNumber = 4,
+    kTinFieldNumber = 5,
+    kBidPriceFieldNumber = 7,
+    kBidSizeFieldNumber = 8,
+    kAskPriceFieldNumber = 9,
+    kAskSizeFieldNumber = 10,
+    kExchangeTimeFieldNumber = 11,
+    kEpochFieldNumber = 14,
+    kCseqFieldNumber = 15,
     kMsgTypeFieldNumber = 1,
   };
-  // string text = 4;
-  void clear_text() ;
-  const ::std::string& text() const;
-  template <typename Arg_ = const ::std::string&, typename... Args_>
-  void set_text(Arg_&& arg, Args_... args);
-  ::std::string* PROTOBUF_NONNULL mutable_text();
-  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_text();
-  void set_allocated_text(::std::string* PROTOBUF_NULLABLE value);
+  // string symbol = 6;
+  void clear_symbol();
+  const std::string& symbol() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_symbol(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_symbol();
+  PROTOBUF_NODISCARD std::string* release_symbol();
+  void set_allocated_symbol(std::string* symbol);
+  private:
+  const std::string& _internal_symbol() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_symbol(const std::string& value);
+  std::string* _internal_mutable_symbol();
+  public:
 
+  // uint64 seq = 2;
+  void clear_seq();
+  uint64_t seq() const;
+  void set_seq(uint64_t value);
   private:
-  const ::std::string& _internal_text() const;
-  PROTOBUF_ALWAYS_INLINE void _internal_set_text(const ::std::string& value);
-  ::std::string* PROTOBUF_NONNULL _internal_mutable_text();
+  uint64_t _internal_seq() const;
+  void _internal_set_seq(uint64_t value);
+  public:
 
+  // uint64 timestamp = 3;
+  void clear_timestamp();
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
   public:
-  // uint64 sid = 2;
-  void clear_sid() ;
-  ::uint64_t sid() const;
-  void set_sid(::uint64_t value);
 
+  // uint64 sid = 4;
+  void clear_sid();
+  uint64_t sid() const;
+  void set_sid(uint64_t value);
   private:
-  ::uint64_t _internal_sid() const;
-  void _internal_set_sid(::uint64_t value);
+  uint64_t _internal_sid() const;
+  void _internal_set_sid(uint64_t value);
+  public:
 
+  // uint64 tin = 5;
+  void clear_tin();
+  uint64_t tin() const;
+  void set_tin(uint64_t value);
+  private:
+  uint64_t _internal_tin() const;
+  void _internal_set_tin(uint64_t value);
   public:
-  // uint64 tin = 3;
-  void clear_tin() ;
-  ::uint64_t tin() const;
-  void set_tin(::uint64_t value);
 
+  // double bid_price = 7;
+  void clear_bid_price();
+  double bid_price() const;
+  void set_bid_price(double value);
   private:
-  ::uint64_t _internal_tin() const;
-  void _internal_set_tin(::uint64_t value);
+  double _internal_bid_price() const;
+  void _internal_set_bid_price(double value);
+  public:
+
+  // uint64 bid_size = 8;
+  void clear_bid_size();
+  uint64_t bid_size() const;
+  void set_bid_size(uint64_t value);
+  private:
+  uint64_t _internal_bid_size() const;
+  void _internal_set_bid_size(uint64_t value);
+  public:
 
+  // double ask_price = 9;
+  void clear_ask_price();
+  double ask_price() const;
+  void set_ask_price(double value);
+  private:
+  double _internal_ask_price() const;
+  void _internal_set_ask_price(double value);
+  public:
+
+  // uint64 ask_size = 10;
+  void clear_ask_size();
+  uint64_t ask_size() const;
+  void set_ask_size(uint64_t value);
+  private:
+  uint64_t _internal_ask_size() const;
+  void _internal_set_ask_size(uint64_t value);
+  public:
+
+  // uint64 exchange_time = 11;
+  void clear_exchange_time();
+  uint64_t exchange_time() const;
+  void set_exchange_time(uint64_t value);
+  private:
+  uint64_t _internal_exchange_time() const;
+  void _internal_set_exchange_time(uint64_t value);
+  public:
+
+  // uint64 epoch = 14;
+  void clear_epoch();
+  uint64_t epoch() const;
+  void set_epoch(uint64_t value);
+  private:
+  uint64_t _internal_epoch() const;
+  void _internal_set_epoch(uint64_t value);
+  public:
+
+  // uint64 cseq = 15;
+  void clear_cseq();
+  uint64_t cseq() const;
+  void set_cseq(uint64_t value);
+  private:
+  uint64_t _internal_cseq() const;
+  void _internal_set_cseq(uint64_t value);
   public:
+
   // .toysequencer.MessageType msg_type = 1;
-  void clear_msg_type() ;
+  void clear_msg_type();
   ::toysequencer::MessageType msg_type() const;
   void set_msg_type(::toysequencer::MessageType value);
-
   private:
   ::toysequencer::MessageType _internal_msg_type() const;
   void _internal_set_msg_type(::toysequencer::MessageType value);
-
   public:
-  // @@protoc_insertion_point(class_scope:toysequencer.TextCommand)
+
+  // @@protoc_insertion_point(class_scope:toysequencer.TopOfBookEvent)
  private:
   class _Internal;
-  friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<2, 4,
-                                   0, 37,
-                                   2>
-      _table_;
-
-  friend class ::google::protobuf::MessageLite;
-  friend class ::google::protobuf::Arena;
-  template <typename T>
-  friend class ::google::protobuf::Arena::InternalHelper;
-  using InternalArenaConstructable_ = void;
-  using DestructorSkippable_ = void;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   struct Impl_ {
-    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-    inline explicit Impl_(
-        ::google::protobuf::internal::InternalVisibility visibility,
-        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const TextCommand& from_msg);
-    ::google::protobuf::internal::HasBits<1> _has_bits_;
-    ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr text_;
-    ::uint64_t sid_;
-    ::uint64_t tin_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr symbol_;
+    uint64_t seq_;
+    uint64_t timestamp_;
+    uint64_t sid_;
+    uint64_t tin_;
+    double bid_price_;
+    uint64_t bid_size_;
+    double ask_price_;
+    uint64_t ask_size_;
+    uint64_t exchange_time_;
+    uint64_t epoch_;
+    uint64_t cseq_;
     int msg_type_;
-    PROTOBUF_TSAN_DECLARE_MEMBER
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
-
-extern const ::google::protobuf::internal::ClassDataFull TextCommand_class_data_;
-
 // ===================================================================
 
 
-
-
 // ===================================================================
 
-
 #ifdef __GNUC__
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
 #endif  // __GNUC__
-// -------------------------------------------------------------------
-
 // TextCommand
 
 // .toysequencer.MessageType msg_type = 1;
 inline void TextCommand::clear_msg_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.msg_type_ = 0;
-  _impl_._has_bits_[0] &= ~0x00000008U;
+}
+inline ::toysequencer::MessageType TextCommand::_internal_msg_type() const {
+  return static_cast< ::toysequencer::MessageType >(_impl_.msg_type_);
 }
 inline ::toysequencer::MessageType TextCommand::msg_type() const {
   // @@protoc_insertion_point(field_get:toysequencer.TextCommand.msg_type)
   return _internal_msg_type();
 }
+inline void TextCommand::_internal_set_msg_type(::toysequencer::MessageType value) {
+  
+  _impl_.msg_type_ = value;
+}
 inline void TextCommand::set_msg_type(::toysequencer::MessageType value) {
   _internal_set_msg_type(value);
-  _impl_._has_bits_[0] |= 0x00000008U;
   // @@protoc_insertion_point(field_set:toysequencer.TextCommand.msg_type)
 }
-inline ::toysequencer::MessageType TextCommand::_internal_msg_type() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return static_cast<::toysequencer::MessageType>(_impl_.msg_type_);
-}
-inline void TextCommand::_internal_set_msg_type(::toysequencer::MessageType value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.msg_type_ = value;
-}
 
 // uint64 sid = 2;
 inline void TextCommand::clear_sid() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.sid_ = ::uint64_t{0u};
-  _impl_._has_bits_[0] &= ~0x00000002U;
+  _impl_.sid_ = uint64_t{0u};
+}
+inline uint64_t TextCommand::_internal_sid() const {
+  return _impl_.sid_;
 }
-inline ::uint64_t TextCommand::sid() const {
+inline uint64_t TextCommand::sid() const {
   // @@protoc_insertion_point(field_get:toysequencer.TextCommand.sid)
   return _internal_sid();
 }
-inline void TextCommand::set_sid(::uint64_t value) {
+inline void TextCommand::_internal_set_sid(uint64_t value) {
+  
+  _impl_.sid_ = value;
+}
+inline void TextCommand::set_sid(uint64_t value) {
   _internal_set_sid(value);
-  _impl_._has_bits_[0] |= 0x00000002U;
   // @@protoc_insertion_point(field_set:toysequencer.TextCommand.sid)
 }
-inline ::uint64_t TextCommand::_internal_sid() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.sid_;
-}
-inline void TextCommand::_internal_set_sid(::uint64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.sid_ = value;
-}
 
 // uint64 tin = 3;
 inline void TextCommand::clear_tin() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.tin_ = ::uint64_t{0u};
-  _impl_._has_bits_[0] &= ~0x00000004U;
+  _impl_.tin_ = uint64_t{0u};
 }
-inline ::uint64_t TextCommand::tin() const {
+inline uint64_t TextCommand::_internal_tin() const {
+  return _impl_.tin_;
+}
+inline uint64_t TextCommand::tin() const {
   // @@protoc_insertion_point(field_get:toysequencer.TextCommand.tin)
   return _internal_tin();
 }
-inline void TextCommand::set_tin(::uint64_t value) {
+inline void TextCommand::_internal_set_tin(uint64_t value) {
+  
+  _impl_.tin_ = value;
+}
+inline void TextCommand::set_tin(uint64_t value) {
   _internal_set_tin(value);
-  _impl_._has_bits_[0] |= 0x00000004U;
   // @@protoc_insertion_point(field_set:toysequencer.TextCommand.tin)
 }
-inline ::uint64_t TextCommand::_internal_tin() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.tin_;
-}
-inline void TextCommand::_internal_set_tin(::uint64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.tin_ = value;
-}
 
 // string text = 4;
 inline void TextCommand::clear_text() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.text_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001U;
 }
-inline const ::std::string& TextCommand::text() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline const std::string& TextCommand::text() const {
   // @@protoc_insertion_point(field_get:toysequencer.TextCommand.text)
   return _internal_text();
 }
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void TextCommand::set_text(Arg_&& arg, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001U;
-  _impl_.text_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TextCommand::set_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:toysequencer.TextCommand.text)
 }
-inline ::std::string* PROTOBUF_NONNULL TextCommand::mutable_text()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::std::string* _s = _internal_mutable_text();
+inline std::string* TextCommand::mutable_text() {
+  std::string* _s = _internal_mutable_text();
   // @@protoc_insertion_point(field_mutable:toysequencer.TextCommand.text)
   return _s;
 }
-inline const ::std::string& TextCommand::_internal_text() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
+inline const std::string& TextCommand::_internal_text() const {
   return _impl_.text_.Get();
 }
-inline void TextCommand::_internal_set_text(const ::std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001U;
-  _impl_.text_.Set(value, GetArena());
+inline void TextCommand::_internal_set_text(const std::string& value) {
+  
+  _impl_.text_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PROTOBUF_NONNULL TextCommand::_internal_mutable_text() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001U;
-  return _impl_.text_.Mutable( GetArena());
+inline std::string* TextCommand::_internal_mutable_text() {
+  
+  return _impl_.text_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PROTOBUF_NULLABLE TextCommand::release_text() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
+inline std::string* TextCommand::release_text() {
   // @@protoc_insertion_point(field_release:toysequencer.TextCommand.text)
-  if ((_impl_._has_bits_[0] & 0x00000001U) == 0) {
-    return nullptr;
+  return _impl_.text_.Release();
+}
+inline void TextCommand::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
+    
+  } else {
+    
   }
-  _impl_._has_bits_[0] &= ~0x00000001U;
-  auto* released = _impl_.text_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.text_.Set("", GetArena());
+  _impl_.text_.SetAllocated(text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
   }
-  return released;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:toysequencer.TextCommand.text)
+}
+
+// uint64 sender_epoch = 14;
+inline void TextCommand::clear_sender_epoch() {
+  _impl_.sender_epoch_ = uint64_t{0u};
+}
+inline uint64_t TextCommand::_internal_sender_epoch() const {
+  return _impl_.sender_epoch_;
+}
+inline uint64_t TextCommand::sender_epoch() const {
+  // @@protoc_insertion_point(field_get:toysequencer.TextCommand.sender_epoch)
+  return _internal_sender_epoch();
+}
+inline void TextCommand::_internal_set_sender_epoch(uint64_t value) {
+  
+  _impl_.sender_epoch_ = value;
+}
+inline void TextCommand::set_sender_epoch(uint64_t value) {
+  _internal_set_sender_epoch(value);
+  // @@protoc_insertion_point(field_set:toysequencer.TextCommand.sender_epoch)
+}
+
+// uint64 cseq = 15;
+inline void TextCommand::clear_cseq() {
+  _impl_.cseq_ = uint64_t{0u};
+}
+inline uint64_t TextCommand::_internal_cseq() const {
+  return _impl_.cseq_;
 }
-inline void TextCommand::set_allocated_text(::std::string* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001U;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001U;
-  }
-  _impl_.text_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.text_.IsDefault()) {
-    _impl_.text_.Set("", GetArena());
-  }
-  // @@protoc_insertion_point(field_set_allocated:toysequencer.TextCommand.text)
+inline uint64_t TextCommand::cseq() const {
+  // @@protoc_insertion_point(field_get:toysequencer.TextCommand.cseq)
+  return _internal_cseq();
+}
+inline void TextCommand::_internal_set_cseq(uint64_t value) {
+  
+  _impl_.cseq_ = value;
+}
+inline void TextCommand::set_cseq(uint64_t value) {
+  _internal_set_cseq(value);
+  // @@protoc_insertion_point(field_set:toysequencer.TextCommand.cseq)
 }
 
 // -------------------------------------------------------------------
@@ -1381,448 +1248,446 @@ inline void TextCommand::set_allocated_text(::std::string* PROTOBUF_NULLABLE val
 
 // .toysequencer.MessageType msg_type = 1;
 inline void TextEvent::clear_msg_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.msg_type_ = 0;
-  _impl_._has_bits_[0] &= ~0x00000020U;
+}
+inline ::toysequencer::MessageType TextEvent::_internal_msg_type() const {
+  return static_cast< ::toysequencer::MessageType >(_impl_.msg_type_);
 }
 inline ::toysequencer::MessageType TextEvent::msg_type() const {
   // @@protoc_insertion_point(field_get:toysequencer.TextEvent.msg_type)
   return _internal_msg_type();
 }
+inline void TextEvent::_internal_set_msg_type(::toysequencer::MessageType value) {
+  
+  _impl_.msg_type_ = value;
+}
 inline void TextEvent::set_msg_type(::toysequencer::MessageType value) {
   _internal_set_msg_type(value);
-  _impl_._has_bits_[0] |= 0x00000020U;
   // @@protoc_insertion_point(field_set:toysequencer.TextEvent.msg_type)
 }
-inline ::toysequencer::MessageType TextEvent::_internal_msg_type() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return static_cast<::toysequencer::MessageType>(_impl_.msg_type_);
-}
-inline void TextEvent::_internal_set_msg_type(::toysequencer::MessageType value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.msg_type_ = value;
-}
 
 // uint64 seq = 2;
 inline void TextEvent::clear_seq() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.seq_ = ::uint64_t{0u};
-  _impl_._has_bits_[0] &= ~0x00000002U;
+  _impl_.seq_ = uint64_t{0u};
 }
-inline ::uint64_t TextEvent::seq() const {
+inline uint64_t TextEvent::_internal_seq() const {
+  return _impl_.seq_;
+}
+inline uint64_t TextEvent::seq() const {
   // @@protoc_insertion_point(field_get:toysequencer.TextEvent.seq)
   return _internal_seq();
 }
-inline void TextEvent::set_seq(::uint64_t value) {
+inline void TextEvent::_internal_set_seq(uint64_t value) {
+  
+  _impl_.seq_ = value;
+}
+inline void TextEvent::set_seq(uint64_t value) {
   _internal_set_seq(value);
-  _impl_._has_bits_[0] |= 0x00000002U;
   // @@protoc_insertion_point(field_set:toysequencer.TextEvent.seq)
 }
-inline ::uint64_t TextEvent::_internal_seq() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.seq_;
-}
-inline void TextEvent::_internal_set_seq(::uint64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.seq_ = value;
-}
 
 // uint64 timestamp = 3;
 inline void TextEvent::clear_timestamp() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.timestamp_ = ::uint64_t{0u};
-  _impl_._has_bits_[0] &= ~0x00000004U;
+  _impl_.timestamp_ = uint64_t{0u};
 }
-inline ::uint64_t TextEvent::timestamp() const {
+inline uint64_t TextEvent::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline uint64_t TextEvent::timestamp() const {
   // @@protoc_insertion_point(field_get:toysequencer.TextEvent.timestamp)
   return _internal_timestamp();
 }
-inline void TextEvent::set_timestamp(::uint64_t value) {
+inline void TextEvent::_internal_set_timestamp(uint64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void TextEvent::set_timestamp(uint64_t value) {
   _internal_set_timestamp(value);
-  _impl_._has_bits_[0] |= 0x00000004U;
   // @@protoc_insertion_point(field_set:toysequencer.TextEvent.timestamp)
 }
-inline ::uint64_t TextEvent::_internal_timestamp() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.timestamp_;
-}
-inline void TextEvent::_internal_set_timestamp(::uint64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.timestamp_ = value;
-}
 
 // uint64 sid = 4;
 inline void TextEvent::clear_sid() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.sid_ = ::uint64_t{0u};
-  _impl_._has_bits_[0] &= ~0x00000008U;
+  _impl_.sid_ = uint64_t{0u};
 }
-inline ::uint64_t TextEvent::sid() const {
+inline uint64_t TextEvent::_internal_sid() const {
+  return _impl_.sid_;
+}
+inline uint64_t TextEvent::sid() const {
   // @@protoc_insertion_point(field_get:toysequencer.TextEvent.sid)
   return _internal_sid();
 }
-inline void TextEvent::set_sid(::uint64_t value) {
+inline void TextEvent::_internal_set_sid(uint64_t value) {
+  
+  _impl_.sid_ = value;
+}
+inline void TextEvent::set_sid(uint64_t value) {
   _internal_set_sid(value);
-  _impl_._has_bits_[0] |= 0x00000008U;
   // @@protoc_insertion_point(field_set:toysequencer.TextEvent.sid)
 }
-inline ::uint64_t TextEvent::_internal_sid() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.sid_;
-}
-inline void TextEvent::_internal_set_sid(::uint64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.sid_ = value;
-}
 
 // uint64 tin = 5;
 inline void TextEvent::clear_tin() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.tin_ = ::uint64_t{0u};
-  _impl_._has_bits_[0] &= ~0x00000010U;
+  _impl_.tin_ = uint64_t{0u};
 }
-inline ::uint64_t TextEvent::tin() const {
+inline uint64_t TextEvent::_internal_tin() const {
+  return _impl_.tin_;
+}
+inline uint64_t TextEvent::tin() const {
   // @@protoc_insertion_point(field_get:toysequencer.TextEvent.tin)
   return _internal_tin();
 }
-inline void TextEvent::set_tin(::uint64_t value) {
+inline void TextEvent::_internal_set_tin(uint64_t value) {
+  
+  _impl_.tin_ = value;
+}
+inline void TextEvent::set_tin(uint64_t value) {
   _internal_set_tin(value);
-  _impl_._has_bits_[0] |= 0x00000010U;
   // @@protoc_insertion_point(field_set:toysequencer.TextEvent.tin)
 }
-inline ::uint64_t TextEvent::_internal_tin() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.tin_;
-}
-inline void TextEvent::_internal_set_tin(::uint64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.tin_ = value;
-}
 
 // string text = 6;
 inline void TextEvent::clear_text() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.text_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001U;
 }
-inline const ::std::string& TextEvent::text() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline const std::string& TextEvent::text() const {
   // @@protoc_insertion_point(field_get:toysequencer.TextEvent.text)
   return _internal_text();
 }
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void TextEvent::set_text(Arg_&& arg, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001U;
-  _impl_.text_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TextEvent::set_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:toysequencer.TextEvent.text)
 }
-inline ::std::string* PROTOBUF_NONNULL TextEvent::mutable_text()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::std::string* _s = _internal_mutable_text();
+inline std::string* TextEvent::mutable_text() {
+  std::string* _s = _internal_mutable_text();
   // @@protoc_insertion_point(field_mutable:toysequencer.TextEvent.text)
   return _s;
 }
-inline const ::std::string& TextEvent::_internal_text() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
+inline const std::string& TextEvent::_internal_text() const {
   return _impl_.text_.Get();
 }
-inline void TextEvent::_internal_set_text(const ::std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001U;
-  _impl_.text_.Set(value, GetArena());
+inline void TextEvent::_internal_set_text(const std::string& value) {
+  
+  _impl_.text_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PROTOBUF_NONNULL TextEvent::_internal_mutable_text() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001U;
-  return _impl_.text_.Mutable( GetArena());
+inline std::string* TextEvent::_internal_mutable_text() {
+  
+  return _impl_.text_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PROTOBUF_NULLABLE TextEvent::release_text() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
+inline std::string* TextEvent::release_text() {
   // @@protoc_insertion_point(field_release:toysequencer.TextEvent.text)
-  if ((_impl_._has_bits_[0] & 0x00000001U) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001U;
-  auto* released = _impl_.text_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.text_.Set("", GetArena());
-  }
-  return released;
+  return _impl_.text_.Release();
 }
-inline void TextEvent::set_allocated_text(::std::string* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001U;
+inline void TextEvent::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
+    
   } else {
-    _impl_._has_bits_[0] &= ~0x00000001U;
+    
   }
-  _impl_.text_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.text_.IsDefault()) {
-    _impl_.text_.Set("", GetArena());
+  _impl_.text_.SetAllocated(text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:toysequencer.TextEvent.text)
 }
 
+// uint64 epoch = 14;
+inline void TextEvent::clear_epoch() {
+  _impl_.epoch_ = uint64_t{0u};
+}
+inline uint64_t TextEvent::_internal_epoch() const {
+  return _impl_.epoch_;
+}
+inline uint64_t TextEvent::epoch() const {
+  // @@protoc_insertion_point(field_get:toysequencer.TextEvent.epoch)
+  return _internal_epoch();
+}
+inline void TextEvent::_internal_set_epoch(uint64_t value) {
+  
+  _impl_.epoch_ = value;
+}
+inline void TextEvent::set_epoch(uint64_t value) {
+  _internal_set_epoch(value);
+  // @@protoc_insertion_point(field_set:toysequencer.TextEvent.epoch)
+}
+
+// uint64 cseq = 15;
+inline void TextEvent::clear_cseq() {
+  _impl_.cseq_ = uint64_t{0u};
+}
+inline uint64_t TextEvent::_internal_cseq() const {
+  return _impl_.cseq_;
+}
+inline uint64_t TextEvent::cseq() const {
+  // @@protoc_insertion_point(field_get:toysequencer.TextEvent.cseq)
+  return _internal_cseq();
+}
+inline void TextEvent::_internal_set_cseq(uint64_t value) {
+  
+  _impl_.cseq_ = value;
+}
+inline void TextEvent::set_cseq(uint64_t value) {
+  _internal_set_cseq(value);
+  // @@protoc_insertion_point(field_set:toysequencer.TextEvent.cseq)
+}
+
 // -------------------------------------------------------------------
 
 // TopOfBookCommand
 
 // .toysequencer.MessageType msg_type = 1;
 inline void TopOfBookCommand::clear_msg_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.msg_type_ = 0;
-  _impl_._has_bits_[0] &= ~0x00000100U;
+}
+inline ::toysequencer::MessageType TopOfBookCommand::_internal_msg_type() const {
+  return static_cast< ::toysequencer::MessageType >(_impl_.msg_type_);
 }
 inline ::toysequencer::MessageType TopOfBookCommand::msg_type() const {
   // @@protoc_insertion_point(field_get:toysequencer.TopOfBookCommand.msg_type)
   return _internal_msg_type();
 }
+inline void TopOfBookCommand::_internal_set_msg_type(::toysequencer::MessageType value) {
+  
+  _impl_.msg_type_ = value;
+}
 inline void TopOfBookCommand::set_msg_type(::toysequencer::MessageType value) {
   _internal_set_msg_type(value);
-  _impl_._has_bits_[0] |= 0x00000100U;
   // @@protoc_insertion_point(field_set:toysequencer.TopOfBookCommand.msg_type)
 }
-inline ::toysequencer::MessageType TopOfBookCommand::_internal_msg_type() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return static_cast<::toysequencer::MessageType>(_impl_.msg_type_);
-}
-inline void TopOfBookCommand::_internal_set_msg_type(::toysequencer::MessageType value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.msg_type_ = value;
-}
 
 // uint64 sid = 2;
 inline void TopOfBookCommand::clear_sid() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.sid_ = ::uint64_t{0u};
-  _impl_._has_bits_[0] &= ~0x00000002U;
+  _impl_.sid_ = uint64_t{0u};
 }
-inline ::uint64_t TopOfBookCommand::sid() const {
+inline uint64_t TopOfBookCommand::_internal_sid() const {
+  return _impl_.sid_;
+}
+inline uint64_t TopOfBookCommand::sid() const {
   // @@protoc_insertion_point(field_get:toysequencer.TopOfBookCommand.sid)
   return _internal_sid();
 }
-inline void TopOfBookCommand::set_sid(::uint64_t value) {
+inline void TopOfBookCommand::_internal_set_sid(uint64_t value) {
+  
+  _impl_.sid_ = value;
+}
+inline void TopOfBookCommand::set_sid(uint64_t value) {
   _internal_set_sid(value);
-  _impl_._has_bits_[0] |= 0x00000002U;
   // @@protoc_insertion_point(field_set:toysequencer.TopOfBookCommand.sid)
 }
-inline ::uint64_t TopOfBookCommand::_internal_sid() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.sid_;
-}
-inline void TopOfBookCommand::_internal_set_sid(::uint64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.sid_ = value;
-}
 
 // uint64 tin = 3;
 inline void TopOfBookCommand::clear_tin() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.tin_ = ::uint64_t{0u};
-  _impl_._has_bits_[0] &= ~0x00000004U;
+  _impl_.tin_ = uint64_t{0u};
 }
-inline ::uint64_t TopOfBookCommand::tin() const {
+inline uint64_t TopOfBookCommand::_internal_tin() const {
+  return _impl_.tin_;
+}
+inline uint64_t TopOfBookCommand::tin() const {
   // @@protoc_insertion_point(field_get:toysequencer.TopOfBookCommand.tin)
   return _internal_tin();
 }
-inline void TopOfBookCommand::set_tin(::uint64_t value) {
+inline void TopOfBookCommand::_internal_set_tin(uint64_t value) {
+  
+  _impl_.tin_ = value;
+}
+inline void TopOfBookCommand::set_tin(uint64_t value) {
   _internal_set_tin(value);
-  _impl_._has_bits_[0] |= 0x00000004U;
   // @@protoc_insertion_point(field_set:toysequencer.TopOfBookCommand.tin)
 }
-inline ::uint64_t TopOfBookCommand::_internal_tin() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.tin_;
-}
-inline void TopOfBookCommand::_internal_set_tin(::uint64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.tin_ = value;
-}
 
 // string symbol = 4;
 inline void TopOfBookCommand::clear_symbol() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.symbol_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001U;
 }
-inline const ::std::string& TopOfBookCommand::symbol() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline const std::string& TopOfBookCommand::symbol() const {
   // @@protoc_insertion_point(field_get:toysequencer.TopOfBookCommand.symbol)
   return _internal_symbol();
 }
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void TopOfBookCommand::set_symbol(Arg_&& arg, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001U;
-  _impl_.symbol_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TopOfBookCommand::set_symbol(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.symbol_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:toysequencer.TopOfBookCommand.symbol)
 }
-inline ::std::string* PROTOBUF_NONNULL TopOfBookCommand::mutable_symbol()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::std::string* _s = _internal_mutable_symbol();
+inline std::string* TopOfBookCommand::mutable_symbol() {
+  std::string* _s = _internal_mutable_symbol();
   // @@protoc_insertion_point(field_mutable:toysequencer.TopOfBookCommand.symbol)
   return _s;
 }
-inline const ::std::string& TopOfBookCommand::_internal_symbol() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
+inline const std::string& TopOfBookCommand::_internal_symbol() const {
   return _impl_.symbol_.Get();
 }
-inline void TopOfBookCommand::_internal_set_symbol(const ::std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001U;
-  _impl_.symbol_.Set(value, GetArena());
+inline void TopOfBookCommand::_internal_set_symbol(const std::string& value) {
+  
+  _impl_.symbol_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PROTOBUF_NONNULL TopOfBookCommand::_internal_mutable_symbol() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001U;
-  return _impl_.symbol_.Mutable( GetArena());
+inline std::string* TopOfBookCommand::_internal_mutable_symbol() {
+  
+  return _impl_.symbol_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PROTOBUF_NULLABLE TopOfBookCommand::release_symbol() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
+inline std::string* TopOfBookCommand::release_symbol() {
   // @@protoc_insertion_point(field_release:toysequencer.TopOfBookCommand.symbol)
-  if ((_impl_._has_bits_[0] & 0x00000001U) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001U;
-  auto* released = _impl_.symbol_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.symbol_.Set("", GetArena());
-  }
-  return released;
+  return _impl_.symbol_.Release();
 }
-inline void TopOfBookCommand::set_allocated_symbol(::std::string* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001U;
+inline void TopOfBookCommand::set_allocated_symbol(std::string* symbol) {
+  if (symbol != nullptr) {
+    
   } else {
-    _impl_._has_bits_[0] &= ~0x00000001U;
+    
   }
-  _impl_.symbol_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.symbol_.IsDefault()) {
-    _impl_.symbol_.Set("", GetArena());
+  _impl_.symbol_.SetAllocated(symbol, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.symbol_.IsDefault()) {
+    _impl_.symbol_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:toysequencer.TopOfBookCommand.symbol)
 }
 
 // double bid_price = 5;
 inline void TopOfBookCommand::clear_bid_price() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.bid_price_ = 0;
-  _impl_._has_bits_[0] &= ~0x00000008U;
+}
+inline double TopOfBookCommand::_internal_bid_price() const {
+  return _impl_.bid_price_;
 }
 inline double TopOfBookCommand::bid_price() const {
   // @@protoc_insertion_point(field_get:toysequencer.TopOfBookCommand.bid_price)
   return _internal_bid_price();
 }
+inline void TopOfBookCommand::_internal_set_bid_price(double value) {
+  
+  _impl_.bid_price_ = value;
+}
 inline void TopOfBookCommand::set_bid_price(double value) {
   _internal_set_bid_price(value);
-  _impl_._has_bits_[0] |= 0x00000008U;
   // @@protoc_insertion_point(field_set:toysequencer.TopOfBookCommand.bid_price)
 }
-inline double TopOfBookCommand::_internal_bid_price() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.bid_price_;
-}
-inline void TopOfBookCommand::_internal_set_bid_price(double value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.bid_price_ = value;
-}
 
 // uint64 bid_size = 6;
 inline void TopOfBookCommand::clear_bid_size() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.bid_size_ = ::uint64_t{0u};
-  _impl_._has_bits_[0] &= ~0x00000010U;
+  _impl_.bid_size_ = uint64_t{0u};
+}
+inline uint64_t TopOfBookCommand::_internal_bid_size() const {
+  return _impl_.bid_size_;
 }
-inline ::uint64_t TopOfBookCommand::bid_size() const {
+inline uint64_t TopOfBookCommand::bid_size() const {
   // @@protoc_insertion_point(field_get:toysequencer.TopOfBookCommand.bid_size)
   return _internal_bid_size();
 }
-inline void TopOfBookCommand::set_bid_size(::uint64_t value) {
+inline void TopOfBookCommand::_internal_set_bid_size(uint64_t value) {
+  
+  _impl_.bid_size_ = value;
+}
+inline void TopOfBookCommand::set_bid_size(uint64_t value) {
   _internal_set_bid_size(value);
-  _impl_._has_bits_[0] |= 0x00000010U;
   // @@protoc_insertion_point(field_set:toysequencer.TopOfBookCommand.bid_size)
 }
-inline ::uint64_t TopOfBookCommand::_internal_bid_size() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.bid_size_;
-}
-inline void TopOfBookCommand::_internal_set_bid_size(::uint64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.bid_size_ = value;
-}
 
 // double ask_price = 7;
 inline void TopOfBookCommand::clear_ask_price() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.ask_price_ = 0;
-  _impl_._has_bits_[0] &= ~0x00000020U;
+}
+inline double TopOfBookCommand::_internal_ask_price() const {
+  return _impl_.ask_price_;
 }
 inline double TopOfBookCommand::ask_price() const {
   // @@protoc_insertion_point(field_get:toysequencer.TopOfBookCommand.ask_price)
   return _internal_ask_price();
 }
+inline void TopOfBookCommand::_internal_set_ask_price(double value) {
+  
+  _impl_.ask_price_ = value;
+}
 inline void TopOfBookCommand::set_ask_price(double value) {
   _internal_set_ask_price(value);
-  _impl_._has_bits_[0] |= 0x00000020U;
   // @@protoc_insertion_point(field_set:toysequencer.TopOfBookCommand.ask_price)
 }
-inline double TopOfBookCommand::_internal_ask_price() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.ask_price_;
-}
-inline void TopOfBookCommand::_internal_set_ask_price(double value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.ask_price_ = value;
-}
 
 // uint64 ask_size = 8;
 inline void TopOfBookCommand::clear_ask_size() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.ask_size_ = ::uint64_t{0u};
-  _impl_._has_bits_[0] &= ~0x00000040U;
+  _impl_.ask_size_ = uint64_t{0u};
+}
+inline uint64_t TopOfBookCommand::_internal_ask_size() const {
+  return _impl_.ask_size_;
 }
-inline ::uint64_t TopOfBookCommand::ask_size() const {
+inline uint64_t TopOfBookCommand::ask_size() const {
   // @@protoc_insertion_point(field_get:toysequencer.TopOfBookCommand.ask_size)
   return _internal_ask_size();
 }
-inline void TopOfBookCommand::set_ask_size(::uint64_t value) {
+inline void TopOfBookCommand::_internal_set_ask_size(uint64_t value) {
+  
+  _impl_.ask_size_ = value;
+}
+inline void TopOfBookCommand::set_ask_size(uint64_t value) {
   _internal_set_ask_size(value);
-  _impl_._has_bits_[0] |= 0x00000040U;
   // @@protoc_insertion_point(field_set:toysequencer.TopOfBookCommand.ask_size)
 }
-inline ::uint64_t TopOfBookCommand::_internal_ask_size() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.ask_size_;
-}
-inline void TopOfBookCommand::_internal_set_ask_size(::uint64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.ask_size_ = value;
-}
 
 // uint64 exchange_time = 9;
 inline void TopOfBookCommand::clear_exchange_time() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.exchange_time_ = ::uint64_t{0u};
-  _impl_._has_bits_[0] &= ~0x00000080U;
+  _impl_.exchange_time_ = uint64_t{0u};
+}
+inline uint64_t TopOfBookCommand::_internal_exchange_time() const {
+  return _impl_.exchange_time_;
 }
-inline ::uint64_t TopOfBookCommand::exchange_time() const {
+inline uint64_t TopOfBookCommand::exchange_time() const {
   // @@protoc_insertion_point(field_get:toysequencer.TopOfBookCommand.exchange_time)
   return _internal_exchange_time();
 }
-inline void TopOfBookCommand::set_exchange_time(::uint64_t value) {
+inline void TopOfBookCommand::_internal_set_exchange_time(uint64_t value) {
+  
+  _impl_.exchange_time_ = value;
+}
+inline void TopOfBookCommand::set_exchange_time(uint64_t value) {
   _internal_set_exchange_time(value);
-  _impl_._has_bits_[0] |= 0x00000080U;
   // @@protoc_insertion_point(field_set:toysequencer.TopOfBookCommand.exchange_time)
 }
-inline ::uint64_t TopOfBookCommand::_internal_exchange_time() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.exchange_time_;
+
+// uint64 sender_epoch = 14;
+inline void TopOfBookCommand::clear_sender_epoch() {
+  _impl_.sender_epoch_ = uint64_t{0u};
 }
-inline void TopOfBookCommand::_internal_set_exchange_time(::uint64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.exchange_time_ = value;
+inline uint64_t TopOfBookCommand::_internal_sender_epoch() const {
+  return _impl_.sender_epoch_;
+}
+inline uint64_t TopOfBookCommand::sender_epoch() const {
+  // @@protoc_insertion_point(field_get:toysequencer.TopOfBookCommand.sender_epoch)
+  return _internal_sender_epoch();
+}
+inline void TopOfBookCommand::_internal_set_sender_epoch(uint64_t value) {
+  
+  _impl_.sender_epoch_ = value;
+}
+inline void TopOfBookCommand::set_sender_epoch(uint64_t value) {
+  _internal_set_sender_epoch(value);
+  // @@protoc_insertion_point(field_set:toysequencer.TopOfBookCommand.sender_epoch)
+}
+
+// uint64 cseq = 15;
+inline void TopOfBookCommand::clear_cseq() {
+  _impl_.cseq_ = uint64_t{0u};
+}
+inline uint64_t TopOfBookCommand::_internal_cseq() const {
+  return _impl_.cseq_;
+}
+inline uint64_t TopOfBookCommand::cseq() const {
+  // @@protoc_insertion_point(field_get:toysequencer.TopOfBookCommand.cseq)
+  return _internal_cseq();
+}
+inline void TopOfBookCommand::_internal_set_cseq(uint64_t value) {
+  
+  _impl_.cseq_ = value;
+}
+inline void TopOfBookCommand::set_cseq(uint64_t value) {
+  _internal_set_cseq(value);
+  // @@protoc_insertion_point(field_set:toysequencer.TopOfBookCommand.cseq)
 }
 
 // -------------------------------------------------------------------
@@ -1831,332 +1696,319 @@ inline void TopOfBookCommand::_internal_set_exchange_time(::uint64_t value) {
 
 // .toysequencer.MessageType msg_type = 1;
 inline void TopOfBookEvent::clear_msg_type() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.msg_type_ = 0;
-  _impl_._has_bits_[0] &= ~0x00000400U;
+}
+inline ::toysequencer::MessageType TopOfBookEvent::_internal_msg_type() const {
+  return static_cast< ::toysequencer::MessageType >(_impl_.msg_type_);
 }
 inline ::toysequencer::MessageType TopOfBookEvent::msg_type() const {
   // @@protoc_insertion_point(field_get:toysequencer.TopOfBookEvent.msg_type)
   return _internal_msg_type();
 }
+inline void TopOfBookEvent::_internal_set_msg_type(::toysequencer::MessageType value) {
+  
+  _impl_.msg_type_ = value;
+}
 inline void TopOfBookEvent::set_msg_type(::toysequencer::MessageType value) {
   _internal_set_msg_type(value);
-  _impl_._has_bits_[0] |= 0x00000400U;
   // @@protoc_insertion_point(field_set:toysequencer.TopOfBookEvent.msg_type)
 }
-inline ::toysequencer::MessageType TopOfBookEvent::_internal_msg_type() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return static_cast<::toysequencer::MessageType>(_impl_.msg_type_);
-}
-inline void TopOfBookEvent::_internal_set_msg_type(::toysequencer::MessageType value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.msg_type_ = value;
-}
 
 // uint64 seq = 2;
 inline void TopOfBookEvent::clear_seq() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.seq_ = ::uint64_t{0u};
-  _impl_._has_bits_[0] &= ~0x00000002U;
+  _impl_.seq_ = uint64_t{0u};
 }
-inline ::uint64_t TopOfBookEvent::seq() const {
+inline uint64_t TopOfBookEvent::_internal_seq() const {
+  return _impl_.seq_;
+}
+inline uint64_t TopOfBookEvent::seq() const {
   // @@protoc_insertion_point(field_get:toysequencer.TopOfBookEvent.seq)
   return _internal_seq();
 }
-inline void TopOfBookEvent::set_seq(::uint64_t value) {
+inline void TopOfBookEvent::_internal_set_seq(uint64_t value) {
+  
+  _impl_.seq_ = value;
+}
+inline void TopOfBookEvent::set_seq(uint64_t value) {
   _internal_set_seq(value);
-  _impl_._has_bits_[0] |= 0x00000002U;
   // @@protoc_insertion_point(field_set:toysequencer.TopOfBookEvent.seq)
 }
-inline ::uint64_t TopOfBookEvent::_internal_seq() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.seq_;
-}
-inline void TopOfBookEvent::_internal_set_seq(::uint64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.seq_ = value;
-}
 
 // uint64 timestamp = 3;
 inline void TopOfBookEvent::clear_timestamp() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.timestamp_ = ::uint64_t{0u};
-  _impl_._has_bits_[0] &= ~0x00000004U;
+  _impl_.timestamp_ = uint64_t{0u};
 }
-inline ::uint64_t TopOfBookEvent::timestamp() const {
+inline uint64_t TopOfBookEvent::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline uint64_t TopOfBookEvent::timestamp() const {
   // @@protoc_insertion_point(field_get:toysequencer.TopOfBookEvent.timestamp)
   return _internal_timestamp();
 }
-inline void TopOfBookEvent::set_timestamp(::uint64_t value) {
+inline void TopOfBookEvent::_internal_set_timestamp(uint64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void TopOfBookEvent::set_timestamp(uint64_t value) {
   _internal_set_timestamp(value);
-  _impl_._has_bits_[0] |= 0x00000004U;
   // @@protoc_insertion_point(field_set:toysequencer.TopOfBookEvent.timestamp)
 }
-inline ::uint64_t TopOfBookEvent::_internal_timestamp() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.timestamp_;
-}
-inline void TopOfBookEvent::_internal_set_timestamp(::uint64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.timestamp_ = value;
-}
 
 // uint64 sid = 4;
 inline void TopOfBookEvent::clear_sid() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.sid_ = ::uint64_t{0u};
-  _impl_._has_bits_[0] &= ~0x00000008U;
+  _impl_.sid_ = uint64_t{0u};
 }
-inline ::uint64_t TopOfBookEvent::sid() const {
+inline uint64_t TopOfBookEvent::_internal_sid() const {
+  return _impl_.sid_;
+}
+inline uint64_t TopOfBookEvent::sid() const {
   // @@protoc_insertion_point(field_get:toysequencer.TopOfBookEvent.sid)
   return _internal_sid();
 }
-inline void TopOfBookEvent::set_sid(::uint64_t value) {
+inline void TopOfBookEvent::_internal_set_sid(uint64_t value) {
+  
+  _impl_.sid_ = value;
+}
+inline void TopOfBookEvent::set_sid(uint64_t value) {
   _internal_set_sid(value);
-  _impl_._has_bits_[0] |= 0x00000008U;
   // @@protoc_insertion_point(field_set:toysequencer.TopOfBookEvent.sid)
 }
-inline ::uint64_t TopOfBookEvent::_internal_sid() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.sid_;
-}
-inline void TopOfBookEvent::_internal_set_sid(::uint64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.sid_ = value;
-}
 
 // uint64 tin = 5;
 inline void TopOfBookEvent::clear_tin() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.tin_ = ::uint64_t{0u};
-  _impl_._has_bits_[0] &= ~0x00000010U;
+  _impl_.tin_ = uint64_t{0u};
 }
-inline ::uint64_t TopOfBookEvent::tin() const {
+inline uint64_t TopOfBookEvent::_internal_tin() const {
+  return _impl_.tin_;
+}
+inline uint64_t TopOfBookEvent::tin() const {
   // @@protoc_insertion_point(field_get:toysequencer.TopOfBookEvent.tin)
   return _internal_tin();
 }
-inline void TopOfBookEvent::set_tin(::uint64_t value) {
+inline void TopOfBookEvent::_internal_set_tin(uint64_t value) {
+  
+  _impl_.tin_ = value;
+}
+inline void TopOfBookEvent::set_tin(uint64_t value) {
   _internal_set_tin(value);
-  _impl_._has_bits_[0] |= 0x00000010U;
   // @@protoc_insertion_point(field_set:toysequencer.TopOfBookEvent.tin)
 }
-inline ::uint64_t TopOfBookEvent::_internal_tin() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.tin_;
-}
-inline void TopOfBookEvent::_internal_set_tin(::uint64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.tin_ = value;
-}
 
 // string symbol = 6;
 inline void TopOfBookEvent::clear_symbol() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.symbol_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001U;
 }
-inline const ::std::string& TopOfBookEvent::symbol() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+inline const std::string& TopOfBookEvent::symbol() const {
   // @@protoc_insertion_point(field_get:toysequencer.TopOfBookEvent.symbol)
   return _internal_symbol();
 }
-template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void TopOfBookEvent::set_symbol(Arg_&& arg, Args_... args) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001U;
-  _impl_.symbol_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TopOfBookEvent::set_symbol(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.symbol_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:toysequencer.TopOfBookEvent.symbol)
 }
-inline ::std::string* PROTOBUF_NONNULL TopOfBookEvent::mutable_symbol()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::std::string* _s = _internal_mutable_symbol();
+inline std::string* TopOfBookEvent::mutable_symbol() {
+  std::string* _s = _internal_mutable_symbol();
   // @@protoc_insertion_point(field_mutable:toysequencer.TopOfBookEvent.symbol)
   return _s;
 }
-inline const ::std::string& TopOfBookEvent::_internal_symbol() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
+inline const std::string& TopOfBookEvent::_internal_symbol() const {
   return _impl_.symbol_.Get();
 }
-inline void TopOfBookEvent::_internal_set_symbol(const ::std::string& value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001U;
-  _impl_.symbol_.Set(value, GetArena());
+inline void TopOfBookEvent::_internal_set_symbol(const std::string& value) {
+  
+  _impl_.symbol_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PROTOBUF_NONNULL TopOfBookEvent::_internal_mutable_symbol() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001U;
-  return _impl_.symbol_.Mutable( GetArena());
+inline std::string* TopOfBookEvent::_internal_mutable_symbol() {
+  
+  return _impl_.symbol_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PROTOBUF_NULLABLE TopOfBookEvent::release_symbol() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
+inline std::string* TopOfBookEvent::release_symbol() {
   // @@protoc_insertion_point(field_release:toysequencer.TopOfBookEvent.symbol)
-  if ((_impl_._has_bits_[0] & 0x00000001U) == 0) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001U;
-  auto* released = _impl_.symbol_.Release();
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.symbol_.Set("", GetArena());
-  }
-  return released;
+  return _impl_.symbol_.Release();
 }
-inline void TopOfBookEvent::set_allocated_symbol(::std::string* PROTOBUF_NULLABLE value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001U;
+inline void TopOfBookEvent::set_allocated_symbol(std::string* symbol) {
+  if (symbol != nullptr) {
+    
   } else {
-    _impl_._has_bits_[0] &= ~0x00000001U;
+    
   }
-  _impl_.symbol_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.symbol_.IsDefault()) {
-    _impl_.symbol_.Set("", GetArena());
+  _impl_.symbol_.SetAllocated(symbol, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.symbol_.IsDefault()) {
+    _impl_.symbol_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:toysequencer.TopOfBookEvent.symbol)
 }
 
 // double bid_price = 7;
 inline void TopOfBookEvent::clear_bid_price() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.bid_price_ = 0;
-  _impl_._has_bits_[0] &= ~0x00000020U;
+}
+inline double TopOfBookEvent::_internal_bid_price() const {
+  return _impl_.bid_price_;
 }
 inline double TopOfBookEvent::bid_price() const {
   // @@protoc_insertion_point(field_get:toysequencer.TopOfBookEvent.bid_price)
   return _internal_bid_price();
 }
+inline void TopOfBookEvent::_internal_set_bid_price(double value) {
+  
+  _impl_.bid_price_ = value;
+}
 inline void TopOfBookEvent::set_bid_price(double value) {
   _internal_set_bid_price(value);
-  _impl_._has_bits_[0] |= 0x00000020U;
   // @@protoc_insertion_point(field_set:toysequencer.TopOfBookEvent.bid_price)
 }
-inline double TopOfBookEvent::_internal_bid_price() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.bid_price_;
-}
-inline void TopOfBookEvent::_internal_set_bid_price(double value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.bid_price_ = value;
-}
 
 // uint64 bid_size = 8;
 inline void TopOfBookEvent::clear_bid_size() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.bid_size_ = ::uint64_t{0u};
-  _impl_._has_bits_[0] &= ~0x00000040U;
+  _impl_.bid_size_ = uint64_t{0u};
+}
+inline uint64_t TopOfBookEvent::_internal_bid_size() const {
+  return _impl_.bid_size_;
 }
-inline ::uint64_t TopOfBookEvent::bid_size() const {
+inline uint64_t TopOfBookEvent::bid_size() const {
   // @@protoc_insertion_point(field_get:toysequencer.TopOfBookEvent.bid_size)
   return _internal_bid_size();
 }
-inline void TopOfBookEvent::set_bid_size(::uint64_t value) {
+inline void TopOfBookEvent::_internal_set_bid_size(uint64_t value) {
+  
+  _impl_.bid_size_ = value;
+}
+inline void TopOfBookEvent::set_bid_size(uint64_t value) {
   _internal_set_bid_size(value);
-  _impl_._has_bits_[0] |= 0x00000040U;
   // @@protoc_insertion_point(field_set:toysequencer.TopOfBookEvent.bid_size)
 }
-inline ::uint64_t TopOfBookEvent::_internal_bid_size() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.bid_size_;
-}
-inline void TopOfBookEvent::_internal_set_bid_size(::uint64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.bid_size_ = value;
-}
 
 // double ask_price = 9;
 inline void TopOfBookEvent::clear_ask_price() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
   _impl_.ask_price_ = 0;
-  _impl_._has_bits_[0] &= ~0x00000080U;
+}
+inline double TopOfBookEvent::_internal_ask_price() const {
+  return _impl_.ask_price_;
 }
 inline double TopOfBookEvent::ask_price() const {
   // @@protoc_insertion_point(field_get:toysequencer.TopOfBookEvent.ask_price)
   return _internal_ask_price();
 }
+inline void TopOfBookEvent::_internal_set_ask_price(double value) {
+  
+  _impl_.ask_price_ = value;
+}
 inline void TopOfBookEvent::set_ask_price(double value) {
   _internal_set_ask_price(value);
-  _impl_._has_bits_[0] |= 0x00000080U;
   // @@protoc_insertion_point(field_set:toysequencer.TopOfBookEvent.ask_price)
 }
-inline double TopOfBookEvent::_internal_ask_price() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.ask_price_;
-}
-inline void TopOfBookEvent::_internal_set_ask_price(double value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.ask_price_ = value;
-}
 
 // uint64 ask_size = 10;
 inline void TopOfBookEvent::clear_ask_size() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.ask_size_ = ::uint64_t{0u};
-  _impl_._has_bits_[0] &= ~0x00000100U;
+  _impl_.ask_size_ = uint64_t{0u};
+}
+inline uint64_t TopOfBookEvent::_internal_ask_size() const {
+  return _impl_.ask_size_;
 }
-inline ::uint64_t TopOfBookEvent::ask_size() const {
+inline uint64_t TopOfBookEvent::ask_size() const {
   // @@protoc_insertion_point(field_get:toysequencer.TopOfBookEvent.ask_size)
   return _internal_ask_size();
 }
-inline void TopOfBookEvent::set_ask_size(::uint64_t value) {
+inline void TopOfBookEvent::_internal_set_ask_size(uint64_t value) {
+  
+  _impl_.ask_size_ = value;
+}
+inline void TopOfBookEvent::set_ask_size(uint64_t value) {
   _internal_set_ask_size(value);
-  _impl_._has_bits_[0] |= 0x00000100U;
   // @@protoc_insertion_point(field_set:toysequencer.TopOfBookEvent.ask_size)
 }
-inline ::uint64_t TopOfBookEvent::_internal_ask_size() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.ask_size_;
-}
-inline void TopOfBookEvent::_internal_set_ask_size(::uint64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.ask_size_ = value;
-}
 
 // uint64 exchange_time = 11;
 inline void TopOfBookEvent::clear_exchange_time() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.exchange_time_ = ::uint64_t{0u};
-  _impl_._has_bits_[0] &= ~0x00000200U;
+  _impl_.exchange_time_ = uint64_t{0u};
+}
+inline uint64_t TopOfBookEvent::_internal_exchange_time() const {
+  return _impl_.exchange_time_;
 }
-inline ::uint64_t TopOfBookEvent::exchange_time() const {
+inline uint64_t TopOfBookEvent::exchange_time() const {
   // @@protoc_insertion_point(field_get:toysequencer.TopOfBookEvent.exchange_time)
   return _internal_exchange_time();
 }
-inline void TopOfBookEvent::set_exchange_time(::uint64_t value) {
+inline void TopOfBookEvent::_internal_set_exchange_time(uint64_t value) {
+  
+  _impl_.exchange_time_ = value;
+}
+inline void TopOfBookEvent::set_exchange_time(uint64_t value) {
   _internal_set_exchange_time(value);
-  _impl_._has_bits_[0] |= 0x00000200U;
   // @@protoc_insertion_point(field_set:toysequencer.TopOfBookEvent.exchange_time)
 }
-inline ::uint64_t TopOfBookEvent::_internal_exchange_time() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.exchange_time_;
+
+// uint64 epoch = 14;
+inline void TopOfBookEvent::clear_epoch() {
+  _impl_.epoch_ = uint64_t{0u};
 }
-inline void TopOfBookEvent::_internal_set_exchange_time(::uint64_t value) {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.exchange_time_ = value;
+inline uint64_t TopOfBookEvent::_internal_epoch() const {
+  return _impl_.epoch_;
+}
+inline uint64_t TopOfBookEvent::epoch() const {
+  // @@protoc_insertion_point(field_get:toysequencer.TopOfBookEvent.epoch)
+  return _internal_epoch();
+}
+inline void TopOfBookEvent::_internal_set_epoch(uint64_t value) {
+  
+  _impl_.epoch_ = value;
+}
+inline void TopOfBookEvent::set_epoch(uint64_t value) {
+  _internal_set_epoch(value);
+  // @@protoc_insertion_point(field_set:toysequencer.TopOfBookEvent.epoch)
+}
+
+// uint64 cseq = 15;
+inline void TopOfBookEvent::clear_cseq() {
+  _impl_.cseq_ = uint64_t{0u};
+}
+inline uint64_t TopOfBookEvent::_internal_cseq() const {
+  return _impl_.cseq_;
+}
+inline uint64_t TopOfBookEvent::cseq() const {
+  // @@protoc_insertion_point(field_get:toysequencer.TopOfBookEvent.cseq)
+  return _internal_cseq();
+}
+inline void TopOfBookEvent::_internal_set_cseq(uint64_t value) {
+  
+  _impl_.cseq_ = value;
+}
+inline void TopOfBookEvent::set_cseq(uint64_t value) {
+  _internal_set_cseq(value);
+  // @@protoc_insertion_point(field_set:toysequencer.TopOfBookEvent.cseq)
 }
 
 #ifdef __GNUC__
-#pragma GCC diagnostic pop
+  #pragma GCC diagnostic pop
 #endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
-}  // namespace toysequencer
 
+}  // namespace toysequencer
 
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
+template <> struct is_proto_enum< ::toysequencer::MessageType> : ::std::true_type {};
 template <>
-struct is_proto_enum<::toysequencer::MessageType> : std::true_type {};
-template <>
-inline const EnumDescriptor* PROTOBUF_NONNULL GetEnumDescriptor<::toysequencer::MessageType>() {
+inline const EnumDescriptor* GetEnumDescriptor< ::toysequencer::MessageType>() {
   return ::toysequencer::MessageType_descriptor();
 }
 
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#include "google/protobuf/port_undef.inc"
-
-#endif  // messages_2eproto_2epb_2eh
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_messages_2eproto
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+class ThreadUtils {
+public:
+  // Pins the calling thread to one CPU; false where pinning is unsupported or the CPU is invalid
+  static bool pin_current_thread(int cpu) {
+#if defined(__linux__)
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+      return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+  }
+
+  // "2,3,4,5" -> {2, 3, 4, 5}; entries that are not numbers become -1 (unpinned)
+  static std::vector<int> parse_cpu_list(const std::string &list) {
+    std::vector<int> cpus;
+    size_t begin = 0;
+    while (begin <= list.size() && !list.empty()) {
+      size_t end = list.find(',', begin);
+      if (end == std::string::npos) {
+        end = list.size();
+      }
+      const std::string item = list.substr(begin, end - begin);
+      char *parsed_end = nullptr;
+      const long cpu = std::strtol(item.c_str(), &parsed_end, 10);
+      cpus.push_back(item.empty() || *parsed_end != '\0' ? -1 : static_cast<int>(cpu));
+      begin = end + 1;
+    }
+    return cpus;
+  }
+};
@@ -0,0 +1,144 @@
+// Client sequence numbers: ClientSeqTable verdicts, drop notices, and ICommandSender settling its
+// retransmit window on acks and drop notices (run with MCAST_IF_ADDR=127.0.0.1)
+
+#include "core/client_seq.hpp"
+#include "core/command_sender.hpp"
+#include "core/wire_peek.hpp"
+#include "unit_test.hpp"
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+namespace {
+
+class TestSender : public ICommandSender<TestSender> {
+public:
+  TestSender() : ICommandSender<TestSender>("239.255.77.93", 47193, 1) {}
+};
+
+// Numbers a minimal command (field 1 = 1) and returns the cseq it was given
+uint64_t send_one(TestSender &sender, SendBuffer &buf, size_t len = 2) {
+  uint8_t *out = buf.prepare(len);
+  std::memset(out, 0, len);
+  out[0] = 0x08; // field 1, varint
+  out[1] = 0x01;
+  if (len > 2) {
+    out[2] = 0x12; // field 2, bytes, padding the command out to len
+    out[3] = static_cast<uint8_t>(len - 4);
+  }
+  CHECK(sender.send_numbered(buf));
+  uint64_t cseq = 0;
+  CHECK(wire::find_varint_field(buf.data(), buf.size(), client_seq::kField, cseq));
+  return cseq;
+}
+
+} // namespace
+
+TEST(client_seq_table_keeps_a_window_per_sid) {
+  ClientSeqTable table;
+  CHECK(table.check(1, 7, 5) == ClientSeqTable::Verdict::Accept);
+  CHECK(table.check(2, 7, 5) == ClientSeqTable::Verdict::Accept);
+  CHECK(table.check(1, 7, 5) == ClientSeqTable::Verdict::Duplicate);
+  // Sids past the direct table go to the overflow map and behave the same
+  CHECK(table.check(1u << 20, 7, 5) == ClientSeqTable::Verdict::Accept);
+  CHECK(table.check(1u << 20, 7, 5) == ClientSeqTable::Verdict::Duplicate);
+  CHECK(table.check(1u << 20, 7, 6) == ClientSeqTable::Verdict::Accept);
+}
+
+TEST(client_seq_table_always_accepts_unnumbered_commands) {
+  ClientSeqTable table;
+  CHECK(table.check(1, 7, 0) == ClientSeqTable::Verdict::Accept);
+  CHECK(table.check(1, 7, 0) == ClientSeqTable::Verdict::Accept);
+}
+
+// Two processes of one app type share a sid: the one started later numbers far higher, and neither makes the
+// other's commands look stale
+TEST(client_seq_table_keeps_senders_sharing_a_sid_apart) {
+  ClientSeqTable table;
+  const uint64_t early = client_seq::initial();
+  const uint64_t late = early + (uint64_t{5000} << 20);
+  for (uint64_t i = 0; i < 3; ++i) {
+    CHECK(table.check(1, 100, early + i) == ClientSeqTable::Verdict::Accept);
+    CHECK(table.check(1, 200, late + i) == ClientSeqTable::Verdict::Accept);
+  }
+  CHECK(table.check(1, 100, early + 3) == ClientSeqTable::Verdict::Accept);
+  CHECK(table.check(1, 100, early + 1) == ClientSeqTable::Verdict::Duplicate);
+  CHECK(table.check(1, 200, late + 1) == ClientSeqTable::Verdict::Duplicate);
+  // A restart of the earlier one takes over the direct slot; both older windows are kept
+  CHECK(table.check(1, 300, early + 1) == ClientSeqTable::Verdict::Accept);
+  CHECK(table.check(1, 200, late + 3) == ClientSeqTable::Verdict::Accept);
+  CHECK(table.check(1, 100, early + 2) == ClientSeqTable::Verdict::Duplicate);
+}
+
+// Windows beyond the direct table are bounded; the least recently used is the one to go
+TEST(client_seq_table_bounds_its_overflow) {
+  ClientSeqTable table;
+  const uint64_t sid = 1u << 20;
+  for (uint64_t epoch = 1; epoch <= ClientSeqTable::kMaxOverflow + 10; ++epoch) {
+    CHECK(table.check(sid, epoch, 5) == ClientSeqTable::Verdict::Accept);
+    CHECK(table.check(sid, 1, 5) == ClientSeqTable::Verdict::Duplicate); // kept in use throughout
+  }
+  CHECK_EQ(table.overflow_size(), ClientSeqTable::kMaxOverflow);
+  CHECK(table.check(sid, 2, 5) == ClientSeqTable::Verdict::Accept); // evicted, so seen as new
+}
+
+TEST(stamp_appends_the_sender_epoch_and_cseq) {
+  SendBuffer buf(64);
+  uint8_t *out = buf.prepare(2);
+  out[0] = 0x08;
+  out[1] = 0x01;
+  CHECK(client_seq::stamp(buf, 123456789, 987654321));
+  uint64_t epoch = 0;
+  uint64_t cseq = 0;
+  CHECK(wire::find_varint_field(buf.data(), buf.size(), client_seq::kEpochField, epoch));
+  CHECK(wire::find_varint_field(buf.data(), buf.size(), client_seq::kField, cseq));
+  CHECK_EQ(epoch, 123456789u);
+  CHECK_EQ(cseq, 987654321u);
+}
+
+TEST(drop_notice_round_trips_and_is_not_an_event) {
+  uint8_t buf[client_seq::kDropSize];
+  client_seq::encode_drop(42, 1234567, client_seq::DropReason::Conflated, buf);
+  uint64_t sid = 0;
+  uint64_t cseq = 0;
+  client_seq::DropReason reason = client_seq::DropReason::None;
+  CHECK(client_seq::decode_drop(buf, sizeof(buf), sid, cseq, reason));
+  CHECK_EQ(sid, 42u);
+  CHECK_EQ(cseq, 1234567u);
+  CHECK(reason == client_seq::DropReason::Conflated);
+  CHECK(!client_seq::peek_event(buf, sizeof(buf), sid, cseq));
+  CHECK(!client_seq::decode_drop(buf, sizeof(buf) - 1, sid, cseq, reason));
+}
+
+// Acks and drop notices both free the slot; without either the command is resent until max_attempts
+TEST(sender_settles_acked_and_dropped_commands) {
+  TestSender sender;
+  RetransmitConfig config;
+  config.interval = std::chrono::milliseconds(5);
+  config.max_attempts = 2;
+  config.window = 8;
+  config.slot_bytes = 64;
+  sender.enable_retransmit(config);
+  SendBuffer buf(256);
+
+  const uint64_t acked = send_one(sender, buf);
+  const uint64_t dropped = send_one(sender, buf);
+  send_one(sender, buf); // never answered
+  CHECK_EQ(sender.get_unacked(), 3u);
+  sender.ack(acked);
+  sender.dropped(dropped);
+  sender.dropped(dropped); // a second notice for the same cseq changes nothing
+  CHECK_EQ(sender.get_unacked(), 1u);
+
+  // Too large for a slot: sent once, not kept
+  send_one(sender, buf, 100);
+  CHECK_EQ(sender.get_unacked(), 1u);
+
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+  while (sender.get_unacked() > 0 && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  CHECK_EQ(sender.get_unacked(), 0u);
+}
+
+UNIT_TEST_MAIN()
@@ -0,0 +1,141 @@
+// Journal recovery and segment rolling
+
+#include "core/journal.hpp"
+#include "unit_test.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+namespace {
+
+struct TempDir {
+  std::filesystem::path path;
+
+  explicit TempDir(const std::string &name)
+      : path(std::filesystem::temp_directory_path() / (name + "." + std::to_string(::getpid()))) {
+    std::filesystem::remove_all(path);
+  }
+  ~TempDir() { std::filesystem::remove_all(path); }
+};
+
+JournalConfig small_segments(const TempDir &dir) {
+  JournalConfig config;
+  config.directory = dir.path.string();
+  config.segment_bytes = 4096; // rounded up to the page size
+  return config;
+}
+
+void append_range(Journal &journal, uint64_t first, uint64_t last) {
+  uint8_t payload[100];
+  for (uint64_t seq = first; seq <= last; ++seq) {
+    std::memset(payload, static_cast<int>(seq & 0xff), sizeof(payload));
+    CHECK(journal.append(seq, payload, sizeof(payload)));
+  }
+}
+
+// Every seq in segment index order, read straight from the files
+std::vector<uint64_t> seqs_on_disk(const TempDir &dir) {
+  std::vector<std::filesystem::path> files;
+  for (const auto &entry : std::filesystem::directory_iterator(dir.path)) {
+    files.push_back(entry.path());
+  }
+  std::sort(files.begin(), files.end());
+  std::vector<uint64_t> seqs;
+  for (const auto &file : files) {
+    std::ifstream in(file, std::ios::binary);
+    std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    size_t offset = 0;
+    while (offset + 16 <= bytes.size()) {
+      uint32_t length = 0;
+      uint64_t seq = 0;
+      std::memcpy(&length, bytes.data() + offset, sizeof(length));
+      std::memcpy(&seq, bytes.data() + offset + 8, sizeof(seq));
+      if (length == 0) {
+        break;
+      }
+      seqs.push_back(seq);
+      offset += (16 + length + 7) & ~static_cast<size_t>(7);
+    }
+  }
+  return seqs;
+}
+
+} // namespace
+
+TEST(empty_journal_recovers_zero) {
+  TempDir dir("journal_test_empty");
+  { Journal journal(small_segments(dir)); }
+  Journal journal(small_segments(dir));
+  CHECK_EQ(journal.last_seq(), 0u);
+}
+
+TEST(recovers_last_seq_within_one_segment) {
+  TempDir dir("journal_test_one");
+  {
+    Journal journal(small_segments(dir));
+    append_range(journal, 1, 10);
+  }
+  Journal journal(small_segments(dir));
+  CHECK_EQ(journal.last_seq(), 10u);
+}
+
+TEST(torn_record_is_end_of_journal) {
+  TempDir dir("journal_test_torn");
+  {
+    Journal journal(small_segments(dir));
+    append_range(journal, 1, 3);
+  }
+  // Corrupt the third record's payload; recovery stops at the second
+  const auto path = dir.path / "journal-00000000.seg";
+  std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+  file.seekp(2 * 120 + 16);
+  file.put('\x7f');
+  file.close();
+  Journal journal(small_segments(dir));
+  CHECK_EQ(journal.last_seq(), 2u);
+}
+
+// Rolls through many segments while the background thread is too slow to have the standby ready, so most
+// rolls happen inline and the background keeps preparing segments the writer has already moved past. The
+// segments must still hold the records in index order, and a restart must resume from the true tail.
+TEST(inline_rolls_keep_segments_in_order) {
+  TempDir dir("journal_test_rolls");
+  JournalConfig config = small_segments(dir);
+  config.prepare_delay = std::chrono::microseconds(2000);
+  uint64_t inline_rolls = 0;
+  {
+    Journal journal(config);
+    for (uint64_t seq = 1; seq <= 600; seq += 60) {
+      append_range(journal, seq, seq + 59);
+      std::this_thread::sleep_for(std::chrono::microseconds(700));
+    }
+    inline_rolls = journal.get_stats().inline_rolls;
+    CHECK(journal.get_stats().segments_rolled >= 10);
+  }
+  CHECK(inline_rolls > 0);
+
+  {
+    Journal journal(config);
+    CHECK_EQ(journal.last_seq(), 600u);
+    append_range(journal, 601, 700);
+  }
+  Journal journal(config);
+  CHECK_EQ(journal.last_seq(), 700u);
+
+  const std::vector<uint64_t> seqs = seqs_on_disk(dir);
+  CHECK_EQ(seqs.size(), 700u);
+  for (size_t i = 0; i < seqs.size(); ++i) {
+    CHECK_EQ(seqs[i], i + 1);
+  }
+}
+
+UNIT_TEST_MAIN()
@@ -0,0 +1,166 @@
+// MulticastReceiver batching over loopback multicast (run with MCAST_IF_ADDR=127.0.0.1)
+
+#include "core/multicast_receiver.hpp"
+#include "core/multicast_sender.hpp"
+#include "unit_test.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+namespace {
+
+// Waits up to `limit` for `count` datagrams; returns how long it took, or limit if they never came
+std::chrono::milliseconds wait_for(const std::atomic<uint64_t> &received, uint64_t count,
+                                   std::chrono::milliseconds limit) {
+  const auto start = std::chrono::steady_clock::now();
+  while (received.load() < count) {
+    const auto waited = std::chrono::steady_clock::now() - start;
+    if (waited >= limit) {
+      return limit;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+}
+
+// Test stream for seq dedup: seq then epoch, as two native u64s
+bool peek_seq_epoch(const uint8_t *data, size_t len, uint64_t &seq, uint64_t &epoch) {
+  if (len != 2 * sizeof(uint64_t)) {
+    return false;
+  }
+  std::memcpy(&seq, data, sizeof(seq));
+  std::memcpy(&epoch, data + sizeof(seq), sizeof(epoch));
+  return true;
+}
+
+void send_seq(MulticastSender &sender, uint64_t seq, uint64_t epoch) {
+  uint64_t datagram[2] = {seq, epoch};
+  sender.send_m(reinterpret_cast<const uint8_t *>(datagram), sizeof(datagram));
+}
+
+} // namespace
+
+// A lone datagram on a quiet stream comes out once the linger expires, not when the batch fills
+TEST(partial_batch_is_delivered_after_linger) {
+  const std::string group = "239.255.77.90";
+  const uint16_t port = 47190;
+  MulticastReceiver receiver(group, port, Transport::Classic);
+  receiver.set_batch_size(64);
+  receiver.set_batch_timeout(std::chrono::milliseconds(50));
+  std::atomic<uint64_t> received{0};
+  receiver.subscribe([&](const uint8_t *, size_t) { received.fetch_add(1); });
+  receiver.start();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  MulticastSender sender(group, port, 1, Transport::Classic);
+  const uint8_t first[] = {1, 2, 3};
+  sender.send_m(first, sizeof(first));
+  CHECK(wait_for(received, 1, std::chrono::milliseconds(2000)) < std::chrono::milliseconds(1000));
+
+  // Still bounded on the next batch
+  const uint8_t second[] = {4, 5, 6};
+  sender.send_m(second, sizeof(second));
+  CHECK(wait_for(received, 2, std::chrono::milliseconds(2000)) < std::chrono::milliseconds(1000));
+  receiver.stop();
+}
+
+// A burst that arrives within the linger is delivered in full
+TEST(burst_within_linger_is_delivered) {
+  const std::string group = "239.255.77.91";
+  const uint16_t port = 47191;
+  MulticastReceiver receiver(group, port, Transport::Classic);
+  receiver.set_batch_size(16);
+  receiver.set_batch_timeout(std::chrono::milliseconds(20));
+  std::atomic<uint64_t> received{0};
+  receiver.subscribe([&](const uint8_t *, size_t) { received.fetch_add(1); });
+  receiver.start();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  MulticastSender sender(group, port, 1, Transport::Classic);
+  for (uint64_t i = 0; i < 40; ++i) {
+    sender.send_m(reinterpret_cast<const uint8_t *>(&i), sizeof(i));
+  }
+  CHECK(wait_for(received, 40, std::chrono::milliseconds(2000)) < std::chrono::milliseconds(2000));
+  receiver.stop();
+}
+
+// The idle tick keeps firing on a stream that never sends anything, and carries on after traffic stops
+TEST(idle_tick_fires_on_a_quiet_stream) {
+  const std::string group = "239.255.77.92";
+  const uint16_t port = 47192;
+  MulticastReceiver receiver(group, port, Transport::Classic);
+  std::atomic<uint64_t> ticks{0};
+  std::atomic<uint64_t> received{0};
+  receiver.set_idle_tick(std::chrono::milliseconds(10), [&] { ticks.fetch_add(1); });
+  receiver.subscribe([&](const uint8_t *, size_t) { received.fetch_add(1); });
+  receiver.start();
+  CHECK(wait_for(ticks, 3, std::chrono::milliseconds(2000)) < std::chrono::milliseconds(2000));
+
+  MulticastSender sender(group, port, 1, Transport::Classic);
+  const uint8_t payload[] = {7};
+  sender.send_m(payload, sizeof(payload));
+  CHECK(wait_for(received, 1, std::chrono::milliseconds(2000)) < std::chrono::milliseconds(2000));
+  const uint64_t after = ticks.load();
+  CHECK(wait_for(ticks, after + 3, std::chrono::milliseconds(2000)) < std::chrono::milliseconds(2000));
+  receiver.stop();
+}
+
+// io_uring on both ends (each falls back to the classic transport where the kernel refuses): a batch flushed as
+// one submission arrives whole, and the receive loop's wait timeout drives the idle tick
+TEST(io_uring_batch_and_idle_tick) {
+  const std::string group = "239.255.77.94";
+  const uint16_t port = 47194;
+  MulticastReceiver receiver(group, port, Transport::IoUring);
+  receiver.set_batch_size(16);
+  std::atomic<uint64_t> ticks{0};
+  std::atomic<uint64_t> received{0};
+  receiver.set_idle_tick(std::chrono::milliseconds(10), [&] { ticks.fetch_add(1); });
+  receiver.subscribe([&](const uint8_t *, size_t) { received.fetch_add(1); });
+  receiver.start();
+  CHECK(wait_for(ticks, 3, std::chrono::milliseconds(2000)) < std::chrono::milliseconds(2000));
+
+  MulticastSender sender(group, port, 1, Transport::IoUring);
+  SendBatchPolicy policy;
+  policy.max_batch = 200;
+  policy.use_gso = false;
+  sender.set_batch_policy(policy);
+  for (uint64_t i = 0; i < 100; ++i) {
+    CHECK(sender.enqueue(reinterpret_cast<const uint8_t *>(&i), sizeof(i)));
+  }
+  CHECK(sender.flush());
+  CHECK(wait_for(received, 100, std::chrono::milliseconds(2000)) < std::chrono::milliseconds(2000));
+  receiver.stop();
+}
+
+// Repeats of a seq are dropped, and a stream that restarts numbering under a higher epoch is delivered in full
+// rather than taken for repeats of the old run
+TEST(seq_dedup_follows_a_restarted_stream) {
+  const std::string group = "239.255.77.95";
+  const uint16_t port = 47195;
+  MulticastReceiver receiver(group, port, Transport::Classic);
+  receiver.set_seq_dedup(&peek_seq_epoch);
+  std::atomic<uint64_t> received{0};
+  receiver.subscribe([&](const uint8_t *, size_t) { received.fetch_add(1); });
+  receiver.start();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  MulticastSender sender(group, port, 1, Transport::Classic);
+  for (uint64_t seq = 1; seq <= 5; ++seq) {
+    send_seq(sender, seq, 100);
+  }
+  send_seq(sender, 3, 100);
+  CHECK(wait_for(received, 5, std::chrono::milliseconds(2000)) < std::chrono::milliseconds(2000));
+
+  for (uint64_t seq = 1; seq <= 5; ++seq) {
+    send_seq(sender, seq, 200);
+  }
+  send_seq(sender, 4, 200);
+  CHECK(wait_for(received, 10, std::chrono::milliseconds(2000)) < std::chrono::milliseconds(2000));
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  CHECK_EQ(received.load(), 10u);
+  receiver.stop();
+}
+
+UNIT_TEST_MAIN()
@@ -0,0 +1,161 @@
+// Pass-through frames: header round-trip and rejection, and EventReceiver rebuilding the event a protobuf-mode
+// sequencer would have sent from the header plus the original command bytes (run with MCAST_IF_ADDR=127.0.0.1)
+
+#include "core/event_receiver.hpp"
+#include "core/passthrough.hpp"
+#include "generated/messages.pb.h"
+#include "unit_test.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<uint8_t> frame(const passthrough::Header &header, const std::string &payload) {
+  std::vector<uint8_t> out(passthrough::kHeaderSize + payload.size());
+  passthrough::write_header(out.data(), header);
+  std::copy(payload.begin(), payload.end(), out.begin() + passthrough::kHeaderSize);
+  return out;
+}
+
+passthrough::Header header_for(toysequencer::MessageType msg_type, const std::string &payload) {
+  passthrough::Header header;
+  header.msg_type = static_cast<uint16_t>(msg_type);
+  header.payload_len = static_cast<uint32_t>(payload.size());
+  header.seq = 0x0102030405060708ull;
+  header.timestamp = 1700000000123456ull;
+  header.epoch = 0xFEDCBA9876543210ull;
+  return header;
+}
+
+// Keeps the last event of each type it is handed
+class Capture : public EventReceiver<Capture> {
+public:
+  Capture() : EventReceiver<Capture>(1, "239.255.77.106", 47206) {}
+
+  void on_event(const toysequencer::TextEvent &event) {
+    text = event;
+    ++count;
+  }
+  void on_event(const toysequencer::TopOfBookEvent &event) {
+    quote = event;
+    ++count;
+  }
+
+  toysequencer::TextEvent text;
+  toysequencer::TopOfBookEvent quote;
+  int count = 0;
+};
+
+} // namespace
+
+TEST(header_round_trips_every_field) {
+  const std::string payload = "command bytes";
+  const passthrough::Header in = header_for(toysequencer::TEXT_EVENT, payload);
+  const std::vector<uint8_t> bytes = frame(in, payload);
+  CHECK(passthrough::is_passthrough(bytes.data(), bytes.size()));
+
+  passthrough::Header out;
+  CHECK(passthrough::read_header(bytes.data(), bytes.size(), out));
+  CHECK_EQ(out.msg_type, in.msg_type);
+  CHECK_EQ(out.payload_len, in.payload_len);
+  CHECK_EQ(out.seq, in.seq);
+  CHECK_EQ(out.timestamp, in.timestamp);
+  CHECK_EQ(out.epoch, in.epoch);
+  // Little-endian on the wire whatever the host
+  CHECK_EQ(bytes[8], 0x08);
+  CHECK_EQ(bytes[15], 0x01);
+}
+
+TEST(malformed_frames_are_rejected) {
+  const std::string payload = "command bytes";
+  const std::vector<uint8_t> good = frame(header_for(toysequencer::TEXT_EVENT, payload), payload);
+  passthrough::Header out;
+
+  std::vector<uint8_t> old_version = good;
+  old_version[1] = passthrough::kVersion - 1;
+  CHECK(!passthrough::read_header(old_version.data(), old_version.size(), out));
+
+  // payload_len must account for exactly the bytes after the header
+  CHECK(!passthrough::read_header(good.data(), good.size() - 1, out));
+  std::vector<uint8_t> longer = good;
+  longer.push_back(0);
+  CHECK(!passthrough::read_header(longer.data(), longer.size(), out));
+
+  CHECK(!passthrough::is_passthrough(good.data(), passthrough::kHeaderSize - 1));
+
+  // A protobuf event starts with the msg_type tag, never the magic
+  toysequencer::TextEvent event;
+  event.set_msg_type(toysequencer::TEXT_EVENT);
+  event.set_seq(1);
+  const std::string proto = event.SerializeAsString();
+  CHECK(!passthrough::is_passthrough(reinterpret_cast<const uint8_t *>(proto.data()), proto.size()));
+}
+
+TEST(text_event_is_rebuilt_from_the_command) {
+  toysequencer::TextCommand command;
+  command.set_msg_type(toysequencer::TEXT_COMMAND);
+  command.set_sid(42);
+  command.set_tin(7);
+  command.set_cseq(3);
+  command.set_text("hello");
+  const std::string payload = command.SerializeAsString();
+  const passthrough::Header header = header_for(toysequencer::TEXT_EVENT, payload);
+  const std::vector<uint8_t> bytes = frame(header, payload);
+
+  Capture capture;
+  capture.on_passthrough<toysequencer::TextEvent>(toysequencer::TEXT_EVENT, bytes.data(), bytes.size());
+  CHECK_EQ(capture.count, 1);
+
+  toysequencer::TextEvent expected =
+      adapters::TextCommandToTextEvent().make_event(command, header.seq, command.sid(), header.timestamp);
+  expected.set_epoch(header.epoch);
+  CHECK(capture.text.SerializeAsString() == expected.SerializeAsString());
+}
+
+TEST(top_of_book_event_is_rebuilt_from_the_command) {
+  toysequencer::TopOfBookCommand command;
+  command.set_msg_type(toysequencer::TOB_COMMAND);
+  command.set_sid(9);
+  command.set_tin(11);
+  command.set_cseq(5);
+  command.set_symbol("BTCUSDT");
+  command.set_bid_price(100.5);
+  command.set_bid_size(2.0);
+  command.set_ask_price(101.0);
+  command.set_ask_size(3.5);
+  command.set_exchange_time(123456789);
+  const std::string payload = command.SerializeAsString();
+  const passthrough::Header header = header_for(toysequencer::TOB_EVENT, payload);
+  const std::vector<uint8_t> bytes = frame(header, payload);
+
+  Capture capture;
+  capture.on_passthrough<toysequencer::TopOfBookEvent>(toysequencer::TOB_EVENT, bytes.data(), bytes.size());
+  CHECK_EQ(capture.count, 1);
+
+  toysequencer::TopOfBookEvent expected = adapters::TopOfBookCommandToTopOfBookEvent().make_event(
+      command, header.seq, command.sid(), header.timestamp);
+  expected.set_epoch(header.epoch);
+  CHECK(capture.quote.SerializeAsString() == expected.SerializeAsString());
+}
+
+// A frame for another event type, or one whose payload does not parse, produces nothing
+TEST(mismatched_or_corrupt_frames_are_not_delivered) {
+  toysequencer::TextCommand command;
+  command.set_msg_type(toysequencer::TEXT_COMMAND);
+  command.set_text("hello");
+  const std::string payload = command.SerializeAsString();
+  const std::vector<uint8_t> bytes = frame(header_for(toysequencer::TEXT_EVENT, payload), payload);
+
+  Capture capture;
+  capture.on_passthrough<toysequencer::TopOfBookEvent>(toysequencer::TOB_EVENT, bytes.data(), bytes.size());
+  CHECK_EQ(capture.count, 0);
+
+  const std::string garbage(16, '\xff');
+  const std::vector<uint8_t> corrupt = frame(header_for(toysequencer::TEXT_EVENT, garbage), garbage);
+  capture.on_passthrough<toysequencer::TextEvent>(toysequencer::TEXT_EVENT, corrupt.data(), corrupt.size());
+  CHECK_EQ(capture.count, 0);
+}
+
+UNIT_TEST_MAIN()
@@ -0,0 +1,231 @@
+// ReorderBuffer: in-order delivery, gap NACKs and recovery, retries and give-up on tick, window overflow
+
+#include "core/reorder_buffer.hpp"
+#include "unit_test.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Feeds seqs whose payload is the seq itself and records what comes out
+struct Harness {
+  explicit Harness(ReorderBuffer::Config config) : buffer(config) {}
+
+  auto deliver_fn() {
+    return [this](const uint8_t *data, size_t) {
+      uint64_t seq = 0;
+      std::memcpy(&seq, data, sizeof(seq));
+      delivered.push_back(seq);
+    };
+  }
+
+  auto nack_fn() {
+    return [this](uint64_t from_seq, uint64_t to_seq) { nacks.emplace_back(from_seq, to_seq); };
+  }
+
+  void offer(uint64_t seq, size_t len = sizeof(uint64_t)) {
+    std::vector<uint8_t> payload(len);
+    std::memcpy(payload.data(), &seq, sizeof(seq));
+    buffer.offer(seq, payload.data(), payload.size(), deliver_fn(), nack_fn());
+  }
+
+  void tick() { buffer.tick(deliver_fn(), nack_fn()); }
+
+  void restart() { buffer.restart(deliver_fn()); }
+
+  ReorderBuffer buffer;
+  std::vector<uint64_t> delivered;
+  std::vector<std::pair<uint64_t, uint64_t>> nacks;
+};
+
+ReorderBuffer::Config config(std::chrono::milliseconds interval, uint32_t retries, size_t window = 16) {
+  ReorderBuffer::Config c;
+  c.window = window;
+  c.slot_bytes = 64;
+  c.nack_interval = interval;
+  c.max_retries = retries;
+  return c;
+}
+
+} // namespace
+
+TEST(in_order_events_pass_straight_through) {
+  Harness h(config(std::chrono::milliseconds(20), 5));
+  for (uint64_t seq = 7; seq <= 10; ++seq) {
+    h.offer(seq);
+  }
+  CHECK(h.delivered == (std::vector<uint64_t>{7, 8, 9, 10}));
+  CHECK(h.nacks.empty());
+  CHECK_EQ(h.buffer.expected(), 11u);
+  CHECK_EQ(h.buffer.depth(), 0u);
+}
+
+TEST(gap_is_nacked_and_recovered_in_order) {
+  Harness h(config(std::chrono::milliseconds(20), 5));
+  h.offer(1);
+  h.offer(4);
+  h.offer(5);
+  CHECK(h.delivered == (std::vector<uint64_t>{1}));
+  CHECK_EQ(h.nacks.size(), 1u);
+  CHECK_EQ(h.nacks[0].first, 2u);
+  CHECK_EQ(h.nacks[0].second, 3u);
+
+  h.offer(3);
+  CHECK_EQ(h.delivered.size(), 1u);
+  h.offer(2);
+  CHECK(h.delivered == (std::vector<uint64_t>{1, 2, 3, 4, 5}));
+  const GapStats stats = h.buffer.get_stats();
+  CHECK_EQ(stats.gaps, 1u);
+  CHECK_EQ(stats.recovered, 3u);
+  CHECK_EQ(stats.lost, 0u);
+  CHECK_EQ(h.buffer.depth(), 0u);
+}
+
+TEST(filling_one_hole_nacks_the_next) {
+  Harness h(config(std::chrono::milliseconds(20), 5));
+  h.offer(1);
+  h.offer(3);
+  h.offer(6);
+  h.offer(2);
+  CHECK(h.delivered == (std::vector<uint64_t>{1, 2, 3}));
+  CHECK_EQ(h.nacks.back().first, 4u);
+  CHECK_EQ(h.nacks.back().second, 5u);
+}
+
+TEST(duplicates_are_dropped) {
+  Harness h(config(std::chrono::milliseconds(20), 5));
+  h.offer(1);
+  h.offer(1);
+  h.offer(3);
+  h.offer(3);
+  CHECK(h.delivered == (std::vector<uint64_t>{1}));
+  CHECK_EQ(h.buffer.get_stats().duplicates, 2u);
+  CHECK_EQ(h.buffer.depth(), 1u);
+}
+
+// A hole at the tail of a burst, with nothing arriving after it, is retried and then skipped by tick() alone
+TEST(tick_retries_then_skips_a_tail_gap) {
+  Harness h(config(std::chrono::milliseconds(2), 2));
+  h.offer(1);
+  h.offer(3);
+  h.offer(4);
+  CHECK_EQ(h.nacks.size(), 1u);
+
+  h.tick(); // too soon after the first NACK
+  CHECK_EQ(h.nacks.size(), 1u);
+  for (int i = 0; i < 2; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    h.tick();
+  }
+  CHECK_EQ(h.nacks.size(), 3u);
+  CHECK(h.delivered == (std::vector<uint64_t>{1}));
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  h.tick();
+  CHECK(h.delivered == (std::vector<uint64_t>{1, 3, 4}));
+  CHECK_EQ(h.buffer.get_stats().lost, 1u);
+  CHECK_EQ(h.buffer.expected(), 5u);
+
+  h.tick(); // nothing held any more
+  CHECK_EQ(h.nacks.size(), 3u);
+}
+
+// An event beyond the window pushes the oldest holes out, delivering what was held among them
+TEST(overflow_skips_the_oldest_holes) {
+  Harness h(config(std::chrono::milliseconds(20), 5, 4));
+  h.offer(1);
+  h.offer(3);
+  h.offer(4);
+  h.offer(7); // window is 2..5, so 2 is given up on
+  CHECK(h.delivered == (std::vector<uint64_t>{1, 3, 4}));
+  CHECK_EQ(h.buffer.expected(), 5u);
+  CHECK_EQ(h.buffer.get_stats().lost, 1u);
+  h.offer(5);
+  h.offer(6);
+  CHECK(h.delivered == (std::vector<uint64_t>{1, 3, 4, 5, 6, 7}));
+}
+
+// The window's slots are reused as it moves on
+TEST(slots_are_reused_across_the_window) {
+  Harness h(config(std::chrono::milliseconds(20), 5, 4));
+  std::vector<uint64_t> expected;
+  for (uint64_t base = 1; base < 40; base += 3) {
+    h.offer(base);
+    h.offer(base + 2);
+    h.offer(base + 1);
+    expected.insert(expected.end(), {base, base + 1, base + 2});
+  }
+  CHECK(h.delivered == expected);
+  CHECK_EQ(h.buffer.get_stats().lost, 0u);
+}
+
+// Too large to hold out of order: left as a hole, and taken once it is next in line
+TEST(oversized_event_is_left_for_the_nack) {
+  Harness h(config(std::chrono::milliseconds(20), 5));
+  h.offer(1);
+  h.offer(2);
+  h.offer(4, 256);
+  CHECK_EQ(h.buffer.get_stats().oversized, 1u);
+  h.offer(5);
+  h.offer(3);
+  CHECK(h.delivered == (std::vector<uint64_t>{1, 2, 3}));
+  h.offer(4, 256);
+  CHECK(h.delivered == (std::vector<uint64_t>{1, 2, 3, 4, 5}));
+}
+
+// One corrupt seq far ahead is dropped and the stream carries on as if it never came
+TEST(lone_far_jump_is_ignored) {
+  Harness h(config(std::chrono::milliseconds(20), 5));
+  h.offer(1);
+  h.offer(uint64_t{1} << 62);
+  h.offer(2);
+  CHECK(h.delivered == (std::vector<uint64_t>{1, 2}));
+  CHECK(h.nacks.empty());
+  CHECK_EQ(h.buffer.get_stats().implausible, 1u);
+  CHECK_EQ(h.buffer.get_stats().lost, 0u);
+}
+
+// A stream that really moved on is followed once a second seq lands near the first, and the jump is counted as
+// lost without walking it seq by seq
+TEST(confirmed_far_jump_is_skipped_in_one_step) {
+  Harness h(config(std::chrono::milliseconds(20), 5));
+  const uint64_t far = uint64_t{1} << 62;
+  h.offer(1);
+  h.offer(3);
+  h.offer(far);
+  h.offer(far + 1);
+  CHECK(h.delivered == (std::vector<uint64_t>{1, 3}));
+  CHECK_EQ(h.buffer.get_stats().implausible, 1u);
+  CHECK_EQ(h.nacks.back().first, far);
+  CHECK_EQ(h.nacks.back().second, far);
+  h.offer(far);
+  CHECK(h.delivered == (std::vector<uint64_t>{1, 3, far, far + 1}));
+  CHECK_EQ(h.buffer.get_stats().lost, far - 3);
+}
+
+// A restarted sequencer numbers from 1 again: what was held from the old run comes out, then the new run is
+// followed from its first seq
+TEST(restart_flushes_the_old_run_and_rejoins) {
+  Harness h(config(std::chrono::milliseconds(20), 5));
+  for (uint64_t seq = 1; seq <= 5; ++seq) {
+    h.offer(seq);
+  }
+  h.offer(8);
+  h.offer(9);
+  h.restart();
+  CHECK(h.delivered == (std::vector<uint64_t>{1, 2, 3, 4, 5, 8, 9}));
+  CHECK_EQ(h.buffer.get_stats().lost, 2u);
+  CHECK_EQ(h.buffer.depth(), 0u);
+  CHECK_EQ(h.buffer.expected(), 0u);
+
+  h.offer(1);
+  h.offer(2);
+  CHECK(h.delivered == (std::vector<uint64_t>{1, 2, 3, 4, 5, 8, 9, 1, 2}));
+  CHECK_EQ(h.buffer.get_stats().duplicates, 0u);
+}
+
+UNIT_TEST_MAIN()
@@ -0,0 +1,64 @@
+// SeqWindow: accepting each number once, stale numbers below the window, sliding, and starting over
+
+#include "core/seq_window.hpp"
+#include "unit_test.hpp"
+#include <cstdint>
+
+namespace {
+
+using Verdict = SeqWindow<64>::Verdict;
+
+} // namespace
+
+TEST(seq_window_accepts_each_number_once) {
+  SeqWindow<64> window;
+  CHECK(window.check(10) == Verdict::Accept);
+  CHECK(window.check(10) == Verdict::Duplicate);
+  CHECK(window.check(12) == Verdict::Accept);
+  CHECK(window.check(11) == Verdict::Accept); // late, but inside the window
+  CHECK(window.check(11) == Verdict::Duplicate);
+  CHECK_EQ(window.high(), 12u);
+}
+
+TEST(seq_window_rejects_numbers_below_it_as_stale) {
+  SeqWindow<64> window;
+  CHECK(window.check(100) == Verdict::Accept);
+  CHECK(window.check(37) == Verdict::Accept);
+  CHECK(window.check(36) == Verdict::Stale);
+  CHECK(window.check(164) == Verdict::Accept);
+  CHECK(window.check(100) == Verdict::Stale);
+}
+
+// The bits a jump slides past are cleared, so a number sharing a bit with an old one is still accepted once
+TEST(seq_window_clears_the_bits_it_slides_past) {
+  SeqWindow<64> window;
+  for (uint64_t n = 1; n <= 20; ++n) {
+    CHECK(window.check(n) == Verdict::Accept);
+  }
+  CHECK(window.check(75) == Verdict::Accept);
+  for (uint64_t n = 21; n < 75; ++n) {
+    CHECK(window.check(n) == Verdict::Accept);
+  }
+  CHECK(window.check(74) == Verdict::Duplicate);
+  CHECK(window.check(11) == Verdict::Stale);
+  CHECK(window.check(1000) == Verdict::Accept);
+  CHECK(window.check(999) == Verdict::Accept);
+  CHECK(window.check(999) == Verdict::Duplicate);
+}
+
+// A stream that numbers from 1 again is accepted in full once the window is reset
+TEST(seq_window_reset_forgets_everything_seen) {
+  SeqWindow<64> window;
+  for (uint64_t n = 1; n <= 10; ++n) {
+    CHECK(window.check(n) == Verdict::Accept);
+  }
+  CHECK(window.check(3) == Verdict::Duplicate);
+  window.reset();
+  CHECK_EQ(window.high(), 0u);
+  for (uint64_t n = 1; n <= 10; ++n) {
+    CHECK(window.check(n) == Verdict::Accept);
+  }
+  CHECK(window.check(3) == Verdict::Duplicate);
+}
+
+UNIT_TEST_MAIN()
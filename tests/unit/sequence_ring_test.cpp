@@ -0,0 +1,191 @@
+// SequenceRing and SequenceBarrier: publication order, gating on the slowest stage, shutdown while waiting, and
+// a threaded producer -> stage -> stage chain in both producer modes
+
+#include "core/sequence_ring.hpp"
+#include "unit_test.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Entry {
+  uint64_t value = 0;
+  bool doubled = false;
+};
+
+// One or more producers feed `total` values through a doubling stage and a checking stage; returns how many
+// entries the checking stage saw out of order or not yet through the first stage
+uint64_t run_chain(ProducerMode mode, size_t producers, uint64_t total) {
+  SequenceRing<Entry> ring(64, mode);
+  Sequence doubled;
+  Sequence checked;
+  ring.add_gating_sequence(&checked);
+  std::atomic<bool> running{true};
+  std::atomic<uint64_t> bad{0};
+
+  std::thread first([&] {
+    uint64_t next = 0;
+    while (next < total) {
+      const uint64_t available = ring.wait_for(next, running);
+      for (; next < available; ++next) {
+        ring[next].value *= 2;
+        ring[next].doubled = true;
+      }
+      doubled.set(next);
+    }
+  });
+  std::thread second([&] {
+    SequenceBarrier barrier({&doubled});
+    uint64_t next = 0;
+    uint64_t sum = 0;
+    while (next < total) {
+      const uint64_t available = barrier.wait_for(next, running);
+      for (; next < available; ++next) {
+        if (!ring[next].doubled || (producers == 1 && ring[next].value != 2 * next)) {
+          bad.fetch_add(1);
+        }
+        sum += ring[next].value;
+        ring[next].doubled = false;
+      }
+      checked.set(next);
+    }
+    // Every value went through exactly once, whatever the interleaving of the producers
+    if (sum != total * (total - 1)) {
+      bad.fetch_add(1);
+    }
+  });
+
+  std::vector<std::thread> feeders;
+  std::atomic<uint64_t> next_value{0};
+  for (size_t p = 0; p < producers; ++p) {
+    feeders.emplace_back([&] {
+      for (;;) {
+        const uint64_t value = next_value.fetch_add(1);
+        if (value >= total) {
+          return;
+        }
+        const uint64_t slot = ring.claim(running);
+        ring[slot].value = producers == 1 ? slot : value;
+        ring.publish(slot);
+      }
+    });
+  }
+  for (std::thread &t : feeders) {
+    t.join();
+  }
+  first.join();
+  second.join();
+  return bad.load();
+}
+
+} // namespace
+
+TEST(first_stage_sees_only_published_entries) {
+  SequenceRing<Entry> ring(8);
+  std::atomic<bool> running{true};
+  const uint64_t a = ring.claim(running);
+  const uint64_t b = ring.claim(running);
+  CHECK_EQ(a, 0u);
+  CHECK_EQ(b, 1u);
+  ring.publish(a);
+  CHECK_EQ(ring.wait_for(0, running), 1u);
+  ring.publish(b);
+  CHECK_EQ(ring.wait_for(1, running), 2u);
+}
+
+// A later slot published first stays invisible until the gap before it is published too
+TEST(multi_producer_publishes_a_contiguous_run_only) {
+  SequenceRing<Entry> ring(4, ProducerMode::Multi);
+  std::atomic<bool> running{true};
+  std::atomic<bool> stopped{false};
+  for (int i = 0; i < 3; ++i) {
+    ring.claim(running);
+  }
+  ring.publish(1);
+  ring.publish(2);
+  CHECK_EQ(ring.wait_for(0, stopped), 0u);
+  ring.publish(0);
+  CHECK_EQ(ring.wait_for(0, running), 3u);
+}
+
+// A slot's published flag from the previous lap does not count for the current one
+TEST(multi_producer_tells_laps_apart) {
+  SequenceRing<Entry> ring(2, ProducerMode::Multi);
+  Sequence done;
+  ring.add_gating_sequence(&done);
+  std::atomic<bool> running{true};
+  std::atomic<bool> stopped{false};
+  ring.publish(ring.claim(running));
+  ring.publish(ring.claim(running));
+  CHECK_EQ(ring.wait_for(0, running), 2u);
+  done.set(2);
+  const uint64_t third = ring.claim(running);
+  CHECK_EQ(third, 2u);
+  CHECK_EQ(ring.wait_for(2, stopped), 2u);
+  ring.publish(third);
+  CHECK_EQ(ring.wait_for(2, running), 3u);
+}
+
+// The producer never laps the slowest gating stage, and gives up when told to stop while the ring is full
+TEST(producer_waits_for_the_slowest_gating_stage) {
+  SequenceRing<Entry> ring(4);
+  Sequence fast;
+  Sequence slow;
+  ring.add_gating_sequence(&fast);
+  ring.add_gating_sequence(&slow);
+  std::atomic<bool> running{true};
+  for (int i = 0; i < 4; ++i) {
+    ring.publish(ring.claim(running));
+  }
+  CHECK_EQ(ring.depth(), 4u);
+  fast.set(4);
+
+  std::atomic<bool> stopped{false};
+  CHECK_EQ(ring.claim(stopped), SequenceRing<Entry>::kNoEntry);
+
+  std::atomic<uint64_t> claimed{SequenceRing<Entry>::kNoEntry};
+  bool waited = false;
+  std::thread producer([&] { claimed.store(ring.claim(running, &waited)); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  CHECK_EQ(claimed.load(), SequenceRing<Entry>::kNoEntry);
+  slow.set(1);
+  producer.join();
+  CHECK_EQ(claimed.load(), 4u);
+  CHECK(waited);
+}
+
+TEST(barrier_follows_its_slowest_dependency) {
+  Sequence a;
+  Sequence b;
+  a.set(5);
+  b.set(3);
+  SequenceBarrier barrier({&a, &b});
+  std::atomic<bool> running{true};
+  CHECK_EQ(barrier.wait_for(0, running), 3u);
+  b.set(7);
+  CHECK_EQ(barrier.wait_for(3, running), 5u);
+}
+
+// A stage blocked on its barrier returns what it had processed once the pipeline stops
+TEST(barrier_wait_returns_on_shutdown) {
+  Sequence upstream;
+  upstream.set(2);
+  SequenceBarrier barrier({&upstream});
+  std::atomic<bool> running{true};
+  std::atomic<uint64_t> result{0};
+  std::thread stage([&] { result.store(barrier.wait_for(2, running) + 100); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  CHECK_EQ(result.load(), 0u);
+  running.store(false);
+  stage.join();
+  CHECK_EQ(result.load(), 102u);
+}
+
+TEST(single_producer_chain_keeps_order) { CHECK_EQ(run_chain(ProducerMode::Single, 1, 20000), 0u); }
+
+TEST(multi_producer_chain_delivers_every_entry_once) { CHECK_EQ(run_chain(ProducerMode::Multi, 3, 20000), 0u); }
+
+UNIT_TEST_MAIN()
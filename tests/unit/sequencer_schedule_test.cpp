@@ -0,0 +1,229 @@
+// Sequence-stage scheduling: per-sid token buckets, the order deficit round-robin gives a batch across sids, and
+// the priority and conflating lanes (run with MCAST_IF_ADDR=127.0.0.1)
+
+#include "applications/sequencer/sequencer.hpp"
+#include "core/wire_peek.hpp"
+#include "generated/messages.pb.h"
+#include "unit_test.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr uint64_t kSecond = 1000000000;
+
+// A pipelined sequencer fed straight through ingest() before it starts, so the sequence stage sees every
+// command in one batch, and a listener on its events group recording the tin of each event in seq order
+class Harness {
+public:
+  Harness(const std::string &cmd_group, uint16_t cmd_port, const std::string &events_group, uint16_t events_port,
+          const PipelineConfig &config)
+      : sequencer_(cmd_group, cmd_port, events_group, events_port, 1),
+        listener_(events_group, events_port, Transport::Classic) {
+    sequencer_.subscribe<toysequencer::TextCommand>(toysequencer::TEXT_COMMAND);
+    sequencer_.subscribe<toysequencer::TopOfBookCommand>(toysequencer::TOB_COMMAND);
+    sequencer_.enable_pipeline(config);
+    listener_.subscribe([this](const uint8_t *data, size_t len) { this->record(data, len); });
+    listener_.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+
+  ~Harness() {
+    sequencer_.stop();
+    listener_.stop();
+  }
+
+  static std::string text(uint64_t sid, uint64_t tin, size_t text_len = 40) {
+    toysequencer::TextCommand cmd;
+    cmd.set_msg_type(toysequencer::TEXT_COMMAND);
+    cmd.set_sid(sid);
+    cmd.set_tin(tin);
+    cmd.set_text(std::string(text_len, 'x'));
+    return cmd.SerializeAsString();
+  }
+
+  static std::string quote(uint64_t sid, uint64_t tin, const std::string &symbol) {
+    toysequencer::TopOfBookCommand cmd;
+    cmd.set_msg_type(toysequencer::TOB_COMMAND);
+    cmd.set_sid(sid);
+    cmd.set_tin(tin);
+    cmd.set_symbol(symbol);
+    cmd.set_bid_price(1.0);
+    cmd.set_ask_price(2.0);
+    return cmd.SerializeAsString();
+  }
+
+  void ingest(const std::string &cmd) {
+    sequencer_.ingest(reinterpret_cast<const uint8_t *>(cmd.data()), cmd.size());
+  }
+
+  // Starts the sequencer and returns the tins of the `count` events it publishes, in seq order
+  std::vector<uint64_t> run(size_t count) {
+    sequencer_.start();
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+    while (received() < count && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50)); // anything beyond `count` shows up as well
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::sort(events_.begin(), events_.end());
+    std::vector<uint64_t> tins;
+    for (const auto &event : events_) {
+      tins.push_back(event.second);
+    }
+    return tins;
+  }
+
+private:
+  size_t received() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return events_.size();
+  }
+
+  void record(const uint8_t *data, size_t len) {
+    uint64_t msg_type = 0;
+    if (!wire::find_varint_field(data, len, 1, msg_type)) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (msg_type == toysequencer::TEXT_EVENT) {
+      toysequencer::TextEvent event;
+      if (event.ParseFromArray(data, static_cast<int>(len))) {
+        events_.emplace_back(event.seq(), event.tin());
+      }
+    } else if (msg_type == toysequencer::TOB_EVENT) {
+      toysequencer::TopOfBookEvent event;
+      if (event.ParseFromArray(data, static_cast<int>(len))) {
+        events_.emplace_back(event.seq(), event.tin());
+      }
+    }
+  }
+
+  Sequencer sequencer_;
+  MulticastReceiver listener_;
+  std::mutex mutex_;
+  std::vector<std::pair<uint64_t, uint64_t>> events_; // (seq, tin)
+};
+
+} // namespace
+
+TEST(token_bucket_admits_its_burst_then_its_rate) {
+  TokenBucket bucket(10, 3);
+  const uint64_t t0 = kSecond;
+  CHECK(bucket.take(t0));
+  CHECK(bucket.take(t0));
+  CHECK(bucket.take(t0));
+  CHECK(!bucket.take(t0));
+  CHECK(!bucket.take(t0 + kSecond / 20));
+  CHECK(bucket.take(t0 + kSecond / 10));
+  // Idle for long enough refills to the burst and no further
+  CHECK(bucket.take(t0 + 10 * kSecond));
+  CHECK(bucket.take(t0 + 10 * kSecond));
+  CHECK(bucket.take(t0 + 10 * kSecond));
+  CHECK(!bucket.take(t0 + 10 * kSecond));
+}
+
+TEST(token_bucket_without_a_rate_is_unlimited) {
+  TokenBucket bucket;
+  for (int i = 0; i < 1000; ++i) {
+    CHECK(bucket.take(kSecond));
+  }
+}
+
+// Below one command a second with no burst set: one command every two seconds, not none at all
+TEST(token_bucket_with_a_fractional_rate_still_admits) {
+  TokenBucket bucket(0.5, 0);
+  const uint64_t t0 = kSecond;
+  CHECK(bucket.take(t0));
+  CHECK(!bucket.take(t0 + kSecond));
+  CHECK(bucket.take(t0 + 2 * kSecond));
+  CHECK(!bucket.take(t0 + 2 * kSecond));
+}
+
+TEST(limit_list_parses_rate_and_optional_burst) {
+  const auto limits = AdmissionConfig::parse_limits("7:100:20,9:0.5,bad,11:");
+  CHECK_EQ(limits.size(), 3u);
+  CHECK(limits.at(7).rate == 100.0 && limits.at(7).burst == 20.0);
+  CHECK(limits.at(9).rate == 0.5 && limits.at(9).burst == 0.0);
+  CHECK(limits.at(11).rate == 0.0);
+}
+
+// One sender's backlog does not hold up another's: with a quantum of one command, the batch alternates between
+// the sids until the busy one is the only one left
+TEST(fair_queueing_interleaves_senders) {
+  PipelineConfig config;
+  config.enabled = true;
+  config.admission.fair = true;
+  config.admission.quantum_bytes = Harness::text(1, 1).size();
+  Harness h("239.255.77.96", 47196, "239.255.77.97", 47197, config);
+  for (uint64_t tin = 1; tin <= 5; ++tin) {
+    h.ingest(Harness::text(1, tin));
+  }
+  h.ingest(Harness::text(2, 101));
+  h.ingest(Harness::text(2, 102));
+  CHECK(h.run(7) == (std::vector<uint64_t>{1, 101, 2, 102, 3, 4, 5}));
+}
+
+// A sid over its own limit loses what exceeds its burst; other sids are untouched
+TEST(sid_over_its_rate_is_rejected) {
+  PipelineConfig config;
+  config.enabled = true;
+  config.admission.limits[3] = {1, 2};
+  Harness h("239.255.77.98", 47198, "239.255.77.99", 47199, config);
+  for (uint64_t tin = 1; tin <= 5; ++tin) {
+    h.ingest(Harness::text(3, tin));
+  }
+  h.ingest(Harness::text(4, 100));
+  CHECK(h.run(3) == (std::vector<uint64_t>{1, 2, 100}));
+}
+
+// Lanes: everything but quotes goes ahead of the quotes in a batch, each lane in arrival order
+TEST(priority_lane_goes_ahead_of_quotes) {
+  PipelineConfig config;
+  config.enabled = true;
+  config.lanes = true;
+  Harness h("239.255.77.100", 47200, "239.255.77.101", 47201, config);
+  h.ingest(Harness::quote(5, 1, "AAA"));
+  h.ingest(Harness::text(6, 10));
+  h.ingest(Harness::quote(5, 2, "BBB"));
+  h.ingest(Harness::text(6, 11));
+  CHECK(h.run(4) == (std::vector<uint64_t>{10, 11, 1, 2}));
+}
+
+// A batch deeper than conflate_depth keeps only the newest quote per symbol
+TEST(deep_batch_conflates_quotes_per_symbol) {
+  PipelineConfig config;
+  config.enabled = true;
+  config.lanes = true;
+  config.conflate_depth = 2;
+  Harness h("239.255.77.102", 47202, "239.255.77.103", 47203, config);
+  h.ingest(Harness::quote(5, 1, "AAA"));
+  h.ingest(Harness::quote(5, 2, "BBB"));
+  h.ingest(Harness::quote(5, 3, "AAA"));
+  h.ingest(Harness::text(6, 10));
+  h.ingest(Harness::quote(5, 4, "AAA"));
+  h.ingest(Harness::quote(5, 5, "BBB"));
+  CHECK(h.run(3) == (std::vector<uint64_t>{10, 4, 5}));
+}
+
+// A shallow batch is left alone: every quote goes out
+TEST(shallow_batch_keeps_every_quote) {
+  PipelineConfig config;
+  config.enabled = true;
+  config.lanes = true;
+  config.conflate_depth = 16;
+  Harness h("239.255.77.104", 47204, "239.255.77.105", 47205, config);
+  h.ingest(Harness::quote(5, 1, "AAA"));
+  h.ingest(Harness::quote(5, 2, "AAA"));
+  h.ingest(Harness::quote(5, 3, "AAA"));
+  CHECK(h.run(3) == (std::vector<uint64_t>{1, 2, 3}));
+}
+
+UNIT_TEST_MAIN()
@@ -0,0 +1,101 @@
+// SseFramer: data lines split across reads, CRLF endings, overlong-line discard and non-200 responses
+
+#include "applications/md/impl/sse_framer.hpp"
+#include "unit_test.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+const std::string kOk = "HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\n\r\n";
+
+// Feeds `text` the way the source's recv loop does, at most `chunk` bytes per read, draining after each one.
+// Payloads are copied out since the views die with the next commit.
+struct Harness {
+  explicit Harness(size_t capacity = 64 * 1024) : framer(capacity) {}
+
+  SseFramer::Status feed(const std::string &text, size_t chunk = SIZE_MAX) {
+    size_t pos = 0;
+    while (pos < text.size()) {
+      const size_t n = std::min({chunk, text.size() - pos, framer.write_space()});
+      std::memcpy(framer.write_ptr(), text.data() + pos, n);
+      framer.commit(n);
+      pos += n;
+      const SseFramer::Status status =
+          framer.drain([this](std::string_view payload) { events.emplace_back(payload); });
+      if (status != SseFramer::Status::Ok) {
+        return status;
+      }
+    }
+    return SseFramer::Status::Ok;
+  }
+
+  SseFramer framer;
+  std::vector<std::string> events;
+};
+
+} // namespace
+
+TEST(data_lines_are_delivered_and_other_fields_skipped) {
+  Harness h;
+  CHECK(h.feed(kOk + "data: {\"a\":1}\n\n: keepalive\nevent: quote\nid: 7\nDATA:{\"b\":2}\ndata:\n") ==
+        SseFramer::Status::Ok);
+  CHECK(h.events == (std::vector<std::string>{"{\"a\":1}", "{\"b\":2}", ""}));
+}
+
+// One byte per read splits the status line, the headers and every data line
+TEST(lines_split_across_reads_are_reassembled) {
+  const std::string stream = kOk + "data: {\"seq\":1}\n\ndata: {\"seq\":2}\n\ndata: {\"seq\":3}";
+  Harness whole;
+  Harness split;
+  CHECK(whole.feed(stream) == SseFramer::Status::Ok);
+  CHECK(split.feed(stream, 1) == SseFramer::Status::Ok);
+  CHECK(split.events == (std::vector<std::string>{"{\"seq\":1}", "{\"seq\":2}"}));
+  CHECK(split.events == whole.events);
+  // The last line completes once its newline arrives
+  CHECK(split.feed("\n") == SseFramer::Status::Ok);
+  CHECK_EQ(split.events.size(), 3u);
+}
+
+TEST(crlf_line_endings_are_stripped) {
+  Harness h;
+  CHECK(h.feed(kOk + "data: one\r\n\r\ndata: two\r\n", 3) == SseFramer::Status::Ok);
+  CHECK(h.events == (std::vector<std::string>{"one", "two"}));
+}
+
+// A line that does not fit in the buffer is dropped whole, including what arrives after the buffer filled;
+// the lines around it are unaffected
+TEST(overlong_line_is_discarded) {
+  Harness h(64);
+  const std::string stream = kOk + "data: short\n" + "data: " + std::string(300, 'x') + "\n" + "data: after\n";
+  CHECK(h.feed(stream, 16) == SseFramer::Status::Ok);
+  CHECK(h.events == (std::vector<std::string>{"short", "after"}));
+}
+
+TEST(non_200_status_is_an_error) {
+  Harness h;
+  CHECK(h.feed("HTTP/1.1 503 Service Unavailable\r\nRetry-After: 1\r\n\r\ndata: {}\n") ==
+        SseFramer::Status::HttpError);
+  CHECK(h.events.empty());
+}
+
+// Until the headers are complete the status is not known, so a partial response is not an error
+TEST(status_is_judged_once_headers_are_complete) {
+  Harness h;
+  CHECK(h.feed("HTTP/1.1 404 Not Found\r\n") == SseFramer::Status::Ok);
+  CHECK(h.feed("\r\n") == SseFramer::Status::HttpError);
+}
+
+// A reconnect starts over with a fresh response; leftovers of the old stream are gone
+TEST(reset_expects_a_new_response) {
+  Harness h;
+  CHECK(h.feed(kOk + "data: old\ndata: partial") == SseFramer::Status::Ok);
+  h.framer.reset();
+  CHECK(h.feed(kOk + "data: new\n") == SseFramer::Status::Ok);
+  CHECK(h.events == (std::vector<std::string>{"old", "new"}));
+}
+
+UNIT_TEST_MAIN()
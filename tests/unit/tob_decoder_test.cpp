@@ -0,0 +1,102 @@
+// TobDecoder: mdapi's field order, any other order, malformed quotes, and bursts with a malformed quote in the
+// middle of the document stream
+
+#include "applications/md/utils/tob_decoder.hpp"
+#include "unit_test.hpp"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+constexpr uint64_t kInstance = 77;
+
+std::string ordered(const std::string &symbol, double bid, double ask) {
+  return "{\"symbol\":\"" + symbol + "\",\"bid_price\":" + std::to_string(bid) + ",\"bid_size\":3,\"ask_price\":" +
+         std::to_string(ask) + ",\"ask_size\":4,\"timestamp\":1700000000.25}";
+}
+
+std::string unordered(const std::string &symbol, double bid, double ask) {
+  return "{\"timestamp\":1700000000.25,\"ask_size\":4,\"ask_price\":" + std::to_string(ask) +
+         ",\"symbol\":\"" + symbol + "\",\"bid_size\":3,\"bid_price\":" + std::to_string(bid) + "}";
+}
+
+// Decodes a burst through decode_many and returns the symbols in the order on_command saw them
+std::vector<std::string> decode_burst(const std::vector<std::string> &quotes, size_t &decoded) {
+  std::vector<std::string_view> views(quotes.begin(), quotes.end());
+  toysequencer::TopOfBookCommand out;
+  std::vector<std::string> symbols;
+  decoded = TobDecoder::for_thread().decode_many(views.data(), views.size(), kInstance, out,
+                                                 [&symbols](const toysequencer::TopOfBookCommand &command) {
+                                                   symbols.push_back(command.symbol());
+                                                 });
+  return symbols;
+}
+
+} // namespace
+
+TEST(ordered_quote_fills_every_field) {
+  toysequencer::TopOfBookCommand out;
+  CHECK(TobDecoder::for_thread().decode(ordered("BTCUSDT", 100.5, 101.25), kInstance, out));
+  CHECK(out.msg_type() == toysequencer::TOB_COMMAND);
+  CHECK_EQ(out.sid(), kInstance);
+  CHECK_EQ(out.tin(), kInstance);
+  CHECK(out.symbol() == "BTCUSDT");
+  CHECK(out.bid_price() == 100.5);
+  CHECK_EQ(out.bid_size(), 3u);
+  CHECK(out.ask_price() == 101.25);
+  CHECK_EQ(out.ask_size(), 4u);
+  CHECK_EQ(out.exchange_time(), 1700000000250000u);
+}
+
+// Another field order falls back to unordered lookups and decodes to the same command
+TEST(unordered_quote_decodes_the_same) {
+  toysequencer::TopOfBookCommand a;
+  toysequencer::TopOfBookCommand b;
+  CHECK(TobDecoder::for_thread().decode(ordered("ETHUSDT", 10.5, 11.0), kInstance, a));
+  CHECK(TobDecoder::for_thread().decode(unordered("ETHUSDT", 10.5, 11.0), kInstance, b));
+  CHECK(a.SerializeAsString() == b.SerializeAsString());
+}
+
+TEST(malformed_quotes_are_rejected) {
+  toysequencer::TopOfBookCommand out;
+  TobDecoder &decoder = TobDecoder::for_thread();
+  CHECK(!decoder.decode("not json", kInstance, out));
+  CHECK(!decoder.decode("{\"symbol\":\"A\",\"bid_price\":1", kInstance, out));
+  CHECK(!decoder.decode("{\"symbol\":\"A\",\"bid_price\":1,\"bid_size\":1,\"ask_price\":2,\"ask_size\":1}", kInstance,
+                        out));
+  CHECK(!decoder.decode("{\"symbol\":\"A\",\"bid_price\":1,\"bid_size\":-1,\"ask_price\":2,\"ask_size\":1,"
+                        "\"timestamp\":1}",
+                        kInstance, out));
+  // The decoder is still usable afterwards
+  CHECK(decoder.decode(ordered("OK", 1, 2), kInstance, out));
+  CHECK(out.symbol() == "OK");
+}
+
+TEST(burst_of_mixed_orders_decodes_in_order) {
+  size_t decoded = 0;
+  const auto symbols =
+      decode_burst({ordered("A", 1, 2), unordered("B", 1, 2), ordered("C", 1, 2), unordered("D", 1, 2)}, decoded);
+  CHECK_EQ(decoded, 4u);
+  CHECK(symbols == (std::vector<std::string>{"A", "B", "C", "D"}));
+}
+
+// A malformed quote mid-burst throws the document stream off; the quotes after it are still decoded one by one,
+// in order, and only the bad one is lost
+TEST(malformed_quote_in_a_burst_falls_back) {
+  const std::vector<std::vector<std::string>> bursts = {
+      {ordered("A", 1, 2), "{\"symbol\":\"X\",\"bid_price\":", ordered("B", 1, 2), unordered("C", 1, 2)},
+      {ordered("A", 1, 2), "not json", ordered("B", 1, 2), unordered("C", 1, 2)},
+      {ordered("A", 1, 2), "{} {}", ordered("B", 1, 2), unordered("C", 1, 2)},
+      {ordered("A", 1, 2), "{\"symbol\":\"X\"}", ordered("B", 1, 2), unordered("C", 1, 2)},
+  };
+  for (const auto &burst : bursts) {
+    size_t decoded = 0;
+    const auto symbols = decode_burst(burst, decoded);
+    CHECK_EQ(decoded, 3u);
+    CHECK(symbols == (std::vector<std::string>{"A", "B", "C"}));
+  }
+}
+
+UNIT_TEST_MAIN()
@@ -0,0 +1,75 @@
+#pragma once
+
+// Minimal unit test support: TEST(name) registers a case, CHECK/CHECK_EQ fail it by throwing, and
+// UNIT_TEST_MAIN() runs every case and exits non-zero if any failed. Checks stay on in Release builds.
+
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace unit_test {
+
+struct Case {
+  const char *name;
+  std::function<void()> body;
+};
+
+inline std::vector<Case> &cases() {
+  static std::vector<Case> all;
+  return all;
+}
+
+struct Register {
+  Register(const char *name, std::function<void()> body) { cases().push_back({name, std::move(body)}); }
+};
+
+inline int run_all() {
+  int failed = 0;
+  for (const Case &c : cases()) {
+    try {
+      c.body();
+      std::cout << "PASS " << c.name << std::endl;
+    } catch (const std::exception &e) {
+      std::cout << "FAIL " << c.name << ": " << e.what() << std::endl;
+      failed++;
+    }
+  }
+  std::cout << cases().size() - failed << "/" << cases().size() << " passed" << std::endl;
+  return failed == 0 ? 0 : 1;
+}
+
+} // namespace unit_test
+
+#define UNIT_TEST_CONCAT_(a, b) a##b
+#define UNIT_TEST_CONCAT(a, b) UNIT_TEST_CONCAT_(a, b)
+
+#define TEST(NAME)                                                                                                     \
+  static void NAME();                                                                                                  \
+  static const unit_test::Register UNIT_TEST_CONCAT(register_, NAME)(#NAME, NAME);                                    \
+  static void NAME()
+
+#define CHECK(COND)                                                                                                    \
+  do {                                                                                                                 \
+    if (!(COND)) {                                                                                                     \
+      throw std::runtime_error(std::string(__FILE__) + ":" + std::to_string(__LINE__) + ": CHECK(" #COND ") failed"); \
+    }                                                                                                                  \
+  } while (0)
+
+#define CHECK_EQ(A, B)                                                                                                 \
+  do {                                                                                                                 \
+    const auto &unit_test_a = (A);                                                                                     \
+    const auto &unit_test_b = (B);                                                                                     \
+    if (!(unit_test_a == unit_test_b)) {                                                                               \
+      std::ostringstream unit_test_msg;                                                                                \
+      unit_test_msg << __FILE__ << ":" << __LINE__ << ": CHECK_EQ(" #A ", " #B ") failed: " << unit_test_a            \
+                    << " != " << unit_test_b;                                                                          \
+      throw std::runtime_error(unit_test_msg.str());                                                                   \
+    }                                                                                                                  \
+  } while (0)
+
+#define UNIT_TEST_MAIN()                                                                                               \
+  int main() { return unit_test::run_all(); }